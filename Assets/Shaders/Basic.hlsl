@@ -9,7 +9,7 @@
 // Scene constant buffer (set once per frame via Renderer::BeginScene)
 cbuffer SceneData : register(b0)
 {
-    matrix u_ViewProjection;
+    matrix u_ViewProjection;    // Column-major, uploaded as-is from glm (use mul(M, v))
 };
 
 // -----------------------------------------------------------------------------
@@ -38,7 +38,7 @@ VSOutput VSMain(float3 position : POSITION, float4 color : COLOR, float2 texCoor
     VSOutput output;
 
     // Transform vertex position by ViewProjection matrix
-    output.Position = mul(float4(position, 1.0f), u_ViewProjection);
+    output.Position = mul(u_ViewProjection, float4(position, 1.0f));
     output.Color = color;
     output.TexCoord = texCoord;
 
@@ -1,7 +1,7 @@
 // =============================================================================
 // Renderer2D Shader for NanSu Engine
-// Single texture shader for 2D quad rendering
-// Color-only quads use 1x1 white texture multiplied by color
+// Batched quad rendering with up to 16 textures per draw call
+// Color-only quads use 1x1 white texture (slot 0) multiplied by color
 // =============================================================================
 
 // -----------------------------------------------------------------------------
@@ -11,15 +11,17 @@
 // Scene constant buffer (slot b0) - set once per BeginScene()
 cbuffer SceneData : register(b0)
 {
-    matrix u_ViewProjection;
+    matrix u_ViewProjection;    // Column-major, uploaded as-is from glm (use mul(M, v))
+    float u_PremultiplyAlpha;   // 1 in BlendMode::Multiply batches, which blend premultiplied color
 };
 
 // -----------------------------------------------------------------------------
 // Textures and Samplers
 // -----------------------------------------------------------------------------
 
-Texture2D u_Texture : register(t0);
-SamplerState u_Sampler : register(s0);
+// Slot count must match Renderer2DData::MaxTextureSlots
+Texture2D u_Textures[16] : register(t0);
+SamplerState u_Sampler : register(s0);    // Set by the pipeline state
 
 // -----------------------------------------------------------------------------
 // Vertex Shader Input
@@ -30,7 +32,7 @@ struct VSInput
     float3 Position : POSITION;
     float4 Color : COLOR;
     float2 TexCoord : TEXCOORD;
-    float TexIndex : TEXINDEX;          // Reserved for future batching
+    float TexIndex : TEXINDEX;          // Texture slot in the batch
     float TilingFactor : TILINGFACTOR;
 };
 
@@ -43,6 +45,7 @@ struct VSOutput
     float4 Position : SV_POSITION;
     float4 Color : COLOR;
     float2 TexCoord : TEXCOORD0;
+    nointerpolation uint TexIndex : TEXINDEX;
 };
 
 // =============================================================================
@@ -54,9 +57,10 @@ VSOutput VSMain(VSInput input)
     VSOutput output;
 
     // Transform vertex position by ViewProjection matrix
-    output.Position = mul(float4(input.Position, 1.0f), u_ViewProjection);
+    output.Position = mul(u_ViewProjection, float4(input.Position, 1.0f));
     output.Color = input.Color;
     output.TexCoord = input.TexCoord * input.TilingFactor;
+    output.TexIndex = (uint)(input.TexIndex + 0.5f);
 
     return output;
 }
@@ -65,10 +69,37 @@ VSOutput VSMain(VSInput input)
 // Pixel Shader
 // =============================================================================
 
+// Texture arrays cannot be indexed by a non-uniform value in SM 5.0,
+// so select the slot with a switch (compiled to a jump table)
+float4 SampleTexture(uint index, float2 texCoord)
+{
+    switch (index)
+    {
+        case 0:  return u_Textures[0].Sample(u_Sampler, texCoord);
+        case 1:  return u_Textures[1].Sample(u_Sampler, texCoord);
+        case 2:  return u_Textures[2].Sample(u_Sampler, texCoord);
+        case 3:  return u_Textures[3].Sample(u_Sampler, texCoord);
+        case 4:  return u_Textures[4].Sample(u_Sampler, texCoord);
+        case 5:  return u_Textures[5].Sample(u_Sampler, texCoord);
+        case 6:  return u_Textures[6].Sample(u_Sampler, texCoord);
+        case 7:  return u_Textures[7].Sample(u_Sampler, texCoord);
+        case 8:  return u_Textures[8].Sample(u_Sampler, texCoord);
+        case 9:  return u_Textures[9].Sample(u_Sampler, texCoord);
+        case 10: return u_Textures[10].Sample(u_Sampler, texCoord);
+        case 11: return u_Textures[11].Sample(u_Sampler, texCoord);
+        case 12: return u_Textures[12].Sample(u_Sampler, texCoord);
+        case 13: return u_Textures[13].Sample(u_Sampler, texCoord);
+        case 14: return u_Textures[14].Sample(u_Sampler, texCoord);
+        default: return u_Textures[15].Sample(u_Sampler, texCoord);
+    }
+}
+
 float4 PSMain(VSOutput input) : SV_TARGET
 {
     // Sample texture and multiply with vertex color (tint)
     // For color-only quads, texture is 1x1 white, so result = color
-    float4 texColor = u_Texture.Sample(u_Sampler, input.TexCoord);
-    return texColor * input.Color;
+    float4 texColor = SampleTexture(input.TexIndex, input.TexCoord);
+    float4 color = texColor * input.Color;
+    color.rgb *= (u_PremultiplyAlpha != 0.0f) ? color.a : 1.0f;
+    return color;
 }
@@ -0,0 +1,79 @@
+// =============================================================================
+// Renderer2D Circle Shader for NanSu Engine
+// Batched circles and rings, shape evaluated per pixel from quad-local position
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// Constant Buffers
+// -----------------------------------------------------------------------------
+
+// Scene constant buffer (slot b0) - shared with Renderer2D.hlsl, layouts must match
+cbuffer SceneData : register(b0)
+{
+    matrix u_ViewProjection;    // Column-major, uploaded as-is from glm (use mul(M, v))
+    float u_PremultiplyAlpha;   // 1 in BlendMode::Multiply batches, which blend premultiplied color
+};
+
+// -----------------------------------------------------------------------------
+// Vertex Shader Input
+// -----------------------------------------------------------------------------
+
+struct VSInput
+{
+    float3 WorldPosition : WORLDPOSITION;
+    float3 LocalPosition : LOCALPOSITION;   // -1..1 across the bounding quad
+    float4 Color : COLOR;
+    float Thickness : THICKNESS;            // 1 = filled disc
+    float Fade : FADE;
+};
+
+// -----------------------------------------------------------------------------
+// Vertex Shader Output / Pixel Shader Input
+// -----------------------------------------------------------------------------
+
+struct VSOutput
+{
+    float4 Position : SV_POSITION;
+    float2 LocalPosition : LOCALPOSITION;
+    float4 Color : COLOR;
+    nointerpolation float Thickness : THICKNESS;
+    nointerpolation float Fade : FADE;
+};
+
+// =============================================================================
+// Vertex Shader
+// =============================================================================
+
+VSOutput VSMain(VSInput input)
+{
+    VSOutput output;
+
+    output.Position = mul(u_ViewProjection, float4(input.WorldPosition, 1.0f));
+    output.LocalPosition = input.LocalPosition.xy;
+    output.Color = input.Color;
+    output.Thickness = input.Thickness;
+    output.Fade = input.Fade;
+
+    return output;
+}
+
+// =============================================================================
+// Pixel Shader
+// =============================================================================
+
+float4 PSMain(VSOutput input) : SV_TARGET
+{
+    // 1 at the center, 0 on the rim, negative outside
+    float distance = 1.0f - length(input.LocalPosition);
+
+    // Keep at least one pixel of fade so edges are anti-aliased at any zoom
+    float fade = max(input.Fade, fwidth(distance));
+
+    float alpha = smoothstep(0.0f, fade, distance);
+    alpha *= smoothstep(input.Thickness + fade, input.Thickness, distance);
+
+    clip(alpha - 0.001f);
+    float4 color = float4(input.Color.rgb, input.Color.a * alpha);
+    color.rgb *= (u_PremultiplyAlpha != 0.0f) ? color.a : 1.0f;
+    return color;
+}
@@ -0,0 +1,60 @@
+// =============================================================================
+// Renderer2D Line Shader for NanSu Engine
+// Batched line segments, expanded to quads on the CPU
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// Constant Buffers
+// -----------------------------------------------------------------------------
+
+// Scene constant buffer (slot b0) - shared with Renderer2D.hlsl, layouts must match
+cbuffer SceneData : register(b0)
+{
+    matrix u_ViewProjection;    // Column-major, uploaded as-is from glm (use mul(M, v))
+    float u_PremultiplyAlpha;   // 1 in BlendMode::Multiply batches, which blend premultiplied color
+};
+
+// -----------------------------------------------------------------------------
+// Vertex Shader Input
+// -----------------------------------------------------------------------------
+
+struct VSInput
+{
+    float3 Position : POSITION;
+    float4 Color : COLOR;
+};
+
+// -----------------------------------------------------------------------------
+// Vertex Shader Output / Pixel Shader Input
+// -----------------------------------------------------------------------------
+
+struct VSOutput
+{
+    float4 Position : SV_POSITION;
+    float4 Color : COLOR;
+};
+
+// =============================================================================
+// Vertex Shader
+// =============================================================================
+
+VSOutput VSMain(VSInput input)
+{
+    VSOutput output;
+
+    output.Position = mul(u_ViewProjection, float4(input.Position, 1.0f));
+    output.Color = input.Color;
+
+    return output;
+}
+
+// =============================================================================
+// Pixel Shader
+// =============================================================================
+
+float4 PSMain(VSOutput input) : SV_TARGET
+{
+    float4 color = input.Color;
+    color.rgb *= (u_PremultiplyAlpha != 0.0f) ? color.a : 1.0f;
+    return color;
+}
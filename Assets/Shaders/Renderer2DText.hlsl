@@ -0,0 +1,107 @@
+// =============================================================================
+// Renderer2D Text Shader for NanSu Engine
+// Batched signed-distance-field glyphs, up to 16 font atlas pages per draw call
+// Glyph atlases store the distance to the outline in alpha (0.5 = on the edge)
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// Constant Buffers
+// -----------------------------------------------------------------------------
+
+// Scene constant buffer (slot b0) - shared with Renderer2D.hlsl, layouts must match
+cbuffer SceneData : register(b0)
+{
+    matrix u_ViewProjection;    // Column-major, uploaded as-is from glm (use mul(M, v))
+    float u_PremultiplyAlpha;   // 1 in BlendMode::Multiply batches, which blend premultiplied color
+};
+
+// -----------------------------------------------------------------------------
+// Textures and Samplers
+// -----------------------------------------------------------------------------
+
+// Slot count must match Renderer2DData::MaxTextureSlots
+Texture2D u_Textures[16] : register(t0);
+SamplerState u_Sampler : register(s0);    // Set by the pipeline state (linear filtering)
+
+// -----------------------------------------------------------------------------
+// Vertex Shader Input
+// -----------------------------------------------------------------------------
+
+struct VSInput
+{
+    float3 Position : POSITION;
+    float4 Color : COLOR;
+    float2 TexCoord : TEXCOORD;
+    float TexIndex : TEXINDEX;          // Atlas page slot in the batch
+};
+
+// -----------------------------------------------------------------------------
+// Vertex Shader Output / Pixel Shader Input
+// -----------------------------------------------------------------------------
+
+struct VSOutput
+{
+    float4 Position : SV_POSITION;
+    float4 Color : COLOR;
+    float2 TexCoord : TEXCOORD0;
+    nointerpolation uint TexIndex : TEXINDEX;
+};
+
+// =============================================================================
+// Vertex Shader
+// =============================================================================
+
+VSOutput VSMain(VSInput input)
+{
+    VSOutput output;
+
+    output.Position = mul(u_ViewProjection, float4(input.Position, 1.0f));
+    output.Color = input.Color;
+    output.TexCoord = input.TexCoord;
+    output.TexIndex = (uint)(input.TexIndex + 0.5f);
+
+    return output;
+}
+
+// =============================================================================
+// Pixel Shader
+// =============================================================================
+
+// Texture arrays cannot be indexed by a non-uniform value in SM 5.0,
+// so select the slot with a switch (compiled to a jump table)
+float4 SampleTexture(uint index, float2 texCoord)
+{
+    switch (index)
+    {
+        case 0:  return u_Textures[0].Sample(u_Sampler, texCoord);
+        case 1:  return u_Textures[1].Sample(u_Sampler, texCoord);
+        case 2:  return u_Textures[2].Sample(u_Sampler, texCoord);
+        case 3:  return u_Textures[3].Sample(u_Sampler, texCoord);
+        case 4:  return u_Textures[4].Sample(u_Sampler, texCoord);
+        case 5:  return u_Textures[5].Sample(u_Sampler, texCoord);
+        case 6:  return u_Textures[6].Sample(u_Sampler, texCoord);
+        case 7:  return u_Textures[7].Sample(u_Sampler, texCoord);
+        case 8:  return u_Textures[8].Sample(u_Sampler, texCoord);
+        case 9:  return u_Textures[9].Sample(u_Sampler, texCoord);
+        case 10: return u_Textures[10].Sample(u_Sampler, texCoord);
+        case 11: return u_Textures[11].Sample(u_Sampler, texCoord);
+        case 12: return u_Textures[12].Sample(u_Sampler, texCoord);
+        case 13: return u_Textures[13].Sample(u_Sampler, texCoord);
+        case 14: return u_Textures[14].Sample(u_Sampler, texCoord);
+        default: return u_Textures[15].Sample(u_Sampler, texCoord);
+    }
+}
+
+float4 PSMain(VSOutput input) : SV_TARGET
+{
+    float distance = SampleTexture(input.TexIndex, input.TexCoord).a;
+
+    // Anti-alias over one screen pixel, whatever the zoom level
+    float width = max(fwidth(distance), 0.0001f);
+    float alpha = smoothstep(0.5f - width, 0.5f + width, distance);
+
+    clip(alpha - 0.001f);
+    float4 color = float4(input.Color.rgb, input.Color.a * alpha);
+    color.rgb *= (u_PremultiplyAlpha != 0.0f) ? color.a : 1.0f;
+    return color;
+}
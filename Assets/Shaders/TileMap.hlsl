@@ -0,0 +1,65 @@
+// =============================================================================
+// TileMap Shader for NanSu Engine
+// Static per-chunk tile geometry, all tiles sampled from one texture
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// Constant Buffers
+// -----------------------------------------------------------------------------
+
+// Scene constant buffer (slot b0) - shared with Renderer2D.hlsl, layouts must match
+cbuffer SceneData : register(b0)
+{
+    matrix u_ViewProjection;    // Column-major, uploaded as-is from glm (use mul(M, v))
+    float u_PremultiplyAlpha;   // Unused here, declared to keep the layouts identical
+};
+
+// -----------------------------------------------------------------------------
+// Textures and Samplers
+// -----------------------------------------------------------------------------
+
+Texture2D u_TileSet : register(t0);
+SamplerState u_Sampler : register(s0);    // Set by the pipeline state
+
+// -----------------------------------------------------------------------------
+// Vertex Shader Input
+// -----------------------------------------------------------------------------
+
+struct VSInput
+{
+    float3 Position : POSITION;
+    float2 TexCoord : TEXCOORD;
+};
+
+// -----------------------------------------------------------------------------
+// Vertex Shader Output / Pixel Shader Input
+// -----------------------------------------------------------------------------
+
+struct VSOutput
+{
+    float4 Position : SV_POSITION;
+    float2 TexCoord : TEXCOORD0;
+};
+
+// =============================================================================
+// Vertex Shader
+// =============================================================================
+
+VSOutput VSMain(VSInput input)
+{
+    VSOutput output;
+
+    output.Position = mul(u_ViewProjection, float4(input.Position, 1.0f));
+    output.TexCoord = input.TexCoord;
+
+    return output;
+}
+
+// =============================================================================
+// Pixel Shader
+// =============================================================================
+
+float4 PSMain(VSOutput input) : SV_TARGET
+{
+    return u_TileSet.Sample(u_Sampler, input.TexCoord);
+}
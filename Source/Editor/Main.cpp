@@ -2,13 +2,22 @@
 #include "Core/EntryPoint.h"
 #include "Core/Layer.h"
 #include "Core/Input.h"
+#include "Input/InputActionMap.h"
 #include "Renderer/Renderer.h"
 #include "Renderer/Renderer2D.h"
 #include "Renderer/Shader.h"
 #include "Renderer/Buffer.h"
 #include "Renderer/Texture.h"
+#include "Renderer/TextureAtlas.h"
+#include "Renderer/Font.h"
+#include "Renderer/TextRenderer.h"
+#include "Renderer/TileMap.h"
+#include "Renderer/ParticleSystem.h"
+#include "Renderer/Framebuffer.h"
 #include "Renderer/OrthographicCamera.h"
 #include <imgui.h>
+#include <algorithm>
+#include <cmath>
 #include <vector>
 #include <string>
 
@@ -18,7 +27,10 @@ public:
     EditorLayer()
         : Layer("EditorLayer")
         , m_Camera(-1.6f, 1.6f, -0.9f, 0.9f)  // 16:9 aspect ratio
+        , m_OverviewCamera(-6.4f, 6.4f, -3.6f, 3.6f)
     {
+        // Input is polled from Input::GetState(); no events needed
+        SetEventInterest(NanSu::EventTypeMask::None());
     }
 
     void OnAttach() override
@@ -53,15 +65,76 @@ public:
         m_Shader = NanSu::Shader::Create("../../Assets/Shaders/Basic.hlsl");
         m_Shader->SetInputLayout(m_VertexBuffer->GetLayout());
 
+        // Input actions (looked up by id every frame, rebindable at runtime)
+        m_MoveXAction = m_Actions.AddAction("MoveX");
+        m_MoveYAction = m_Actions.AddAction("MoveY");
+        m_RotateAction = m_Actions.AddAction("Rotate");
+        m_ToggleAnimationAction = m_Actions.AddAction("ToggleAnimation");
+        BindMovement(false);
+        m_Actions.BindAxis(m_RotateAction, NanSu::KeyCode::E, NanSu::KeyCode::Q);
+        m_Actions.Bind(m_ToggleAnimationAction, { NanSu::KeyCode::Space });
+
         // Load all test textures
         LoadTextures();
 
+        // Pack generated sprites into a shared atlas page
+        BuildSpriteAtlas();
+
+        // Large tile map built from the atlas sprites
+        BuildTileMap();
+
+        // Particle fountain (additive sparks)
+        NanSu::ParticleEmitterProps sparks;
+        sparks.Position = { 0.0f, -0.5f, 0.05f };
+        sparks.Velocity = { 0.0f, 1.2f };
+        sparks.VelocityVariation = { 0.6f, 0.3f };
+        sparks.Acceleration = { 0.0f, -1.5f };
+        sparks.LifeTime = 1.5f;
+        sparks.LifeTimeVariation = 0.5f;
+        sparks.Size = 0.03f;
+        sparks.SizeVariation = 0.01f;
+        sparks.EmitRate = 2000.0f;
+        sparks.MaxParticles = 5000;
+        sparks.Blend = NanSu::BlendMode::Additive;
+        sparks.ColorOverLife.Reset({ 1.0f, 0.9f, 0.4f, 1.0f });
+        sparks.ColorOverLife.AddKey(1.0f, { 1.0f, 0.2f, 0.0f, 0.0f });
+        sparks.SizeOverLife.AddKey(1.0f, 0.2f);
+        m_Particles.CreateEmitter(sparks);
+
+        // SDF font for world-space labels (system font, no font asset is shipped yet)
+        m_Font = new NanSu::Font("C:/Windows/Fonts/segoeui.ttf");
+
+        // Off-screen overview of the scene (render-to-texture test)
+        m_Overview = NanSu::Framebuffer::Create({ 320, 180,
+            { NanSu::FramebufferFormat::RGBA8, NanSu::FramebufferFormat::Depth24Stencil8 } });
+
         // Initialize Renderer2D
         NanSu::Renderer2D::Init();
 
         NS_INFO("EditorLayer: Textured quad rendering initialized");
     }
 
+    void BindMovement(bool useIJKL)
+    {
+        m_Actions.ClearBindings(m_MoveXAction);
+        m_Actions.ClearBindings(m_MoveYAction);
+
+        if (useIJKL)
+        {
+            m_Actions.BindAxis(m_MoveXAction, NanSu::KeyCode::J, NanSu::KeyCode::L);
+            m_Actions.BindAxis(m_MoveYAction, NanSu::KeyCode::K, NanSu::KeyCode::I);
+        }
+        else
+        {
+            m_Actions.BindAxis(m_MoveXAction, NanSu::KeyCode::A, NanSu::KeyCode::D);
+            m_Actions.BindAxis(m_MoveYAction, NanSu::KeyCode::S, NanSu::KeyCode::W);
+        }
+
+        // Arrow keys always work
+        m_Actions.BindAxis(m_MoveXAction, NanSu::KeyCode::Left, NanSu::KeyCode::Right);
+        m_Actions.BindAxis(m_MoveYAction, NanSu::KeyCode::Down, NanSu::KeyCode::Up);
+    }
+
     void LoadTextures()
     {
         // List of textures to load
@@ -91,6 +164,72 @@ public:
         m_CurrentTextureIndex = 0;
     }
 
+    void BuildSpriteAtlas()
+    {
+        constexpr NanSu::uint32 spriteSize = 16;
+
+        m_Atlas = new NanSu::TextureAtlas(512);
+        m_AtlasSprites.clear();
+
+        // Small radial blobs with varying hue, each its own "image"
+        std::vector<NanSu::uint32> pixels(spriteSize * spriteSize);
+        for (NanSu::uint32 i = 0; i < ATLAS_SPRITE_COUNT; ++i)
+        {
+            NanSu::uint8 r = static_cast<NanSu::uint8>(64 + (i * 37) % 192);
+            NanSu::uint8 g = static_cast<NanSu::uint8>(64 + (i * 71) % 192);
+            NanSu::uint8 b = static_cast<NanSu::uint8>(64 + (i * 113) % 192);
+
+            for (NanSu::uint32 y = 0; y < spriteSize; ++y)
+            {
+                for (NanSu::uint32 x = 0; x < spriteSize; ++x)
+                {
+                    NanSu::float32 dx = (x + 0.5f) / spriteSize - 0.5f;
+                    NanSu::float32 dy = (y + 0.5f) / spriteSize - 0.5f;
+                    NanSu::float32 falloff = 1.0f - std::min(1.0f, std::sqrt(dx * dx + dy * dy) * 2.0f);
+                    NanSu::uint8 a = static_cast<NanSu::uint8>(falloff * 255.0f);
+                    pixels[y * spriteSize + x] = r | (g << 8) | (b << 16) | (static_cast<NanSu::uint32>(a) << 24);
+                }
+            }
+
+            m_AtlasSprites.push_back(m_Atlas->Add("Sprite" + std::to_string(i),
+                                                  pixels.data(), spriteSize, spriteSize));
+        }
+
+        m_Atlas->Upload();
+    }
+
+    void BuildTileMap()
+    {
+        constexpr NanSu::uint32 mapSize = 4096;
+        constexpr NanSu::uint32 tileTypes = 8;
+
+        constexpr NanSu::float32 tileSize = 0.05f;
+        constexpr NanSu::float32 halfExtent = mapSize * tileSize * 0.5f;
+
+        // Centered on the world origin, just in front of the background quad
+        m_TileMap = new NanSu::TileMap(mapSize, mapSize, tileSize);
+        m_TileMap->SetOrigin({ -halfExtent, -halfExtent, -0.05f });
+
+        NanSu::uint16 tiles[tileTypes] = {};
+        for (NanSu::uint32 i = 0; i < tileTypes; ++i)
+        {
+            tiles[i] = m_AtlasSprites[i] ? m_TileMap->AddTile(*m_AtlasSprites[i]) : NanSu::TileMap::EMPTY_TILE;
+        }
+
+        // Sparse pseudo-random scatter so the rest of the scene stays readable
+        for (NanSu::uint32 y = 0; y < mapSize; ++y)
+        {
+            for (NanSu::uint32 x = 0; x < mapSize; ++x)
+            {
+                NanSu::uint32 hash = (x * 73856093u) ^ (y * 19349663u);
+                if (hash % 7 == 0)
+                {
+                    m_TileMap->SetTile(x, y, tiles[(hash >> 8) % tileTypes]);
+                }
+            }
+        }
+    }
+
     void OnDetach() override
     {
         // Shutdown Renderer2D
@@ -104,6 +243,19 @@ public:
         m_Textures.clear();
         m_TextureNames.clear();
 
+        delete m_Atlas;
+        m_Atlas = nullptr;
+        m_AtlasSprites.clear();
+
+        delete m_Font;
+        m_Font = nullptr;
+
+        delete m_TileMap;
+        m_TileMap = nullptr;
+
+        delete m_Overview;
+        m_Overview = nullptr;
+
         delete m_Shader;
         delete m_IndexBuffer;
         delete m_VertexBuffer;
@@ -115,46 +267,64 @@ public:
 
     void OnUpdate() override
     {
-        // Camera movement with keyboard input
+        // Evaluate all bound actions once against this frame's input snapshot
+        m_Actions.Update(NanSu::Input::GetState());
+
+        // Camera movement and rotation (axes in [-1, 1])
         NanSu::float32 speed = 0.05f;
+        m_CameraPosition.x += m_Actions.GetValue(m_MoveXAction) * speed;
+        m_CameraPosition.y += m_Actions.GetValue(m_MoveYAction) * speed;
+        m_CameraRotation += m_Actions.GetValue(m_RotateAction) * 1.0f;
 
-        if (NanSu::Input::IsKeyPressed(NanSu::KeyCode::A) ||
-            NanSu::Input::IsKeyPressed(NanSu::KeyCode::Left))
-        {
-            m_CameraPosition.x -= speed;
-        }
-        if (NanSu::Input::IsKeyPressed(NanSu::KeyCode::D) ||
-            NanSu::Input::IsKeyPressed(NanSu::KeyCode::Right))
-        {
-            m_CameraPosition.x += speed;
-        }
-        if (NanSu::Input::IsKeyPressed(NanSu::KeyCode::W) ||
-            NanSu::Input::IsKeyPressed(NanSu::KeyCode::Up))
+        // Toggle the scene animation once per press
+        if (m_Actions.WasPressed(m_ToggleAnimationAction))
         {
-            m_CameraPosition.y += speed;
-        }
-        if (NanSu::Input::IsKeyPressed(NanSu::KeyCode::S) ||
-            NanSu::Input::IsKeyPressed(NanSu::KeyCode::Down))
-        {
-            m_CameraPosition.y -= speed;
+            m_Animate = !m_Animate;
         }
 
-        // Camera rotation with Q/E
-        if (NanSu::Input::IsKeyPressed(NanSu::KeyCode::Q))
+        // Update camera transform
+        m_Camera.SetPosition(m_CameraPosition);
+        m_Camera.SetRotation(m_CameraRotation);
+
+        // Keep rendering while the camera is driven by held keys (power-saving mode)
+        if (m_CameraPosition != m_LastCameraPosition || m_CameraRotation != m_LastCameraRotation)
         {
-            m_CameraRotation += 1.0f;
+            RequestRedraw();
+            m_LastCameraPosition = m_CameraPosition;
+            m_LastCameraRotation = m_CameraRotation;
         }
-        if (NanSu::Input::IsKeyPressed(NanSu::KeyCode::E))
+
+        if (m_Animate)
         {
-            m_CameraRotation -= 1.0f;
+            // Update rotation for animated quad
+            m_QuadRotation += 0.01f;
+
+            m_Particles.OnUpdate(static_cast<NanSu::float32>(NanSu::Application::Get().GetTimestep()));
+
+            RequestRedraw();
         }
 
-        // Update camera transform
-        m_Camera.SetPosition(m_CameraPosition);
-        m_Camera.SetRotation(m_CameraRotation);
+        NanSu::Renderer2D::ResetStats();
 
-        // Update rotation for animated quad
-        m_QuadRotation += 0.01f;
+        // =========================================================================
+        // Render-to-Texture Test (zoomed-out overview, drawn into the scene below)
+        // =========================================================================
+        if (m_Overview)
+        {
+            m_OverviewCamera.SetPosition(m_CameraPosition);
+
+            m_Overview->Bind();
+            m_Overview->Clear({ 0.05f, 0.05f, 0.1f, 1.0f });
+            NanSu::Renderer2D::BeginScene(m_OverviewCamera);
+            if (m_TileMap)
+            {
+                m_TileMap->Render(m_OverviewCamera);
+            }
+            NanSu::Renderer2D::DrawRect(m_CameraPosition, { 3.2f, 1.8f }, { 1.0f, 1.0f, 1.0f, 1.0f }, 0.04f);
+            m_Particles.OnRender();
+            NanSu::Renderer2D::EndScene();
+            m_Overview->Unbind();
+        }
 
         // =========================================================================
         // Renderer2D Test
@@ -165,6 +335,12 @@ public:
         NanSu::Renderer2D::DrawQuad({ 0.0f, 0.0f, -0.1f }, { 5.0f, 5.0f },
             { 0.2f, 0.2f, 0.3f, 1.0f });
 
+        // Tile map (only chunks in view are drawn)
+        if (m_TileMap)
+        {
+            m_TileMap->Render(m_Camera);
+        }
+
         // Color-only quads (testing single shader strategy)
         NanSu::Renderer2D::DrawQuad({ -1.0f, 0.0f }, { 0.5f, 0.5f },
             { 1.0f, 0.0f, 0.0f, 1.0f });  // Red
@@ -191,6 +367,55 @@ public:
                 currentTexture, { 1.0f, 0.5f, 0.5f, 1.0f });  // Red tint
         }
 
+        // Additive glow (separate batch, testing per-batch blend modes)
+        NanSu::Renderer2D::SetBlendMode(NanSu::BlendMode::Additive);
+        NanSu::Renderer2D::DrawQuad({ -0.75f, 0.0f }, { 0.6f, 0.6f },
+            { 0.5f, 0.5f, 0.5f, 0.5f });
+        NanSu::Renderer2D::SetBlendMode(NanSu::BlendMode::Alpha);
+
+        // Atlas sprites (all share one texture slot)
+        constexpr NanSu::uint32 columns = 16;
+        for (NanSu::uint32 i = 0; i < static_cast<NanSu::uint32>(m_AtlasSprites.size()); ++i)
+        {
+            if (!m_AtlasSprites[i])
+            {
+                continue;
+            }
+
+            NanSu::float32 x = 1.3f + static_cast<NanSu::float32>(i % columns) * 0.02f;
+            NanSu::float32 y = -0.85f + static_cast<NanSu::float32>(i / columns) * 0.02f;
+            NanSu::Renderer2D::DrawQuad({ x, y }, { 0.02f, 0.02f }, *m_AtlasSprites[i]);
+        }
+
+        // Debug shapes (one draw per primitive type)
+        NanSu::Renderer2D::DrawCircle({ 0.0f, -0.5f, 0.0f }, 0.15f, { 0.3f, 0.8f, 1.0f, 1.0f });
+        NanSu::Renderer2D::DrawCircle({ 0.0f, -0.5f, 0.0f }, 0.25f, { 1.0f, 1.0f, 1.0f, 0.8f }, 0.1f);
+        NanSu::Renderer2D::DrawRect({ 0.8f, 0.0f, 0.0f }, { 0.8f, 0.8f }, { 1.0f, 1.0f, 0.0f, 1.0f });
+        for (NanSu::uint32 i = 0; i <= 20; ++i)
+        {
+            NanSu::float32 x = -1.6f + i * 0.16f;
+            NanSu::Renderer2D::DrawLine({ x, -0.9f, 0.0f }, { x, -0.85f, 0.0f }, { 0.6f, 0.6f, 0.6f, 1.0f }, 0.005f);
+        }
+
+        // Particles (one sprite stream per emitter)
+        m_Particles.OnRender();
+
+        // World-space text (scales with the camera, one draw call for all labels)
+        if (m_Font && m_Font->IsLoaded())
+        {
+            NanSu::TextRenderer::DrawString("NanSu Engine", m_Font, { -1.5f, -0.6f, 0.0f }, 0.15f);
+            NanSu::TextRenderer::DrawString("SDF text\nstays sharp when zoomed", m_Font,
+                { -1.5f, -0.72f, 0.0f }, 0.06f, { 1.0f, 0.8f, 0.3f, 1.0f });
+        }
+
+        // Overview picture-in-picture (framebuffer color attachment as a texture)
+        if (m_Overview)
+        {
+            NanSu::vec3 overviewPosition = m_CameraPosition + NanSu::vec3(-1.2f, 0.65f, 0.1f);
+            NanSu::Renderer2D::DrawQuad(overviewPosition, { 0.32f, 0.18f }, m_Overview->GetColorAttachment());
+            NanSu::Renderer2D::DrawRect(overviewPosition, { 0.32f, 0.18f }, { 0.8f, 0.8f, 0.8f, 1.0f }, 0.004f);
+        }
+
         NanSu::Renderer2D::EndScene();
     }
 
@@ -226,6 +451,41 @@ public:
 
         ImGui::Separator();
 
+        // Batching statistics
+        const auto& stats = NanSu::Renderer2D::GetStats();
+        ImGui::Text("Renderer2D");
+        ImGui::Text("Draw Calls: %u", stats.DrawCalls);
+        ImGui::Text("Quads: %u", stats.QuadCount);
+        ImGui::Text("Glyphs: %u", stats.GlyphCount);
+        ImGui::Text("Circles: %u, Lines: %u", stats.CircleCount, stats.LineCount);
+        ImGui::Text("Particles: %u", m_Particles.GetAliveCount());
+        if (m_TileMap)
+        {
+            const auto& mapStats = m_TileMap->GetStats();
+            ImGui::Text("TileMap: %u visible chunks, %u draws, %u rebuilt",
+                        mapStats.VisibleChunks, mapStats.DrawCalls, mapStats.RebuiltChunks);
+            ImGui::Text("TileMap: %u resident chunks (%.1f MB)",
+                        mapStats.ResidentChunks, mapStats.ResidentBytes / (1024.0f * 1024.0f));
+        }
+        if (m_Atlas)
+        {
+            ImGui::Text("Atlas: %zu sprites, %u page(s)", m_Atlas->GetImageCount(), m_Atlas->GetPageCount());
+        }
+        if (m_Overview)
+        {
+            // Synchronous readback of the overview's center pixel
+            if (ImGui::Button("Read Overview Pixel"))
+            {
+                const auto& spec = m_Overview->GetSpecification();
+                m_Overview->ReadPixels(0, spec.Width / 2, spec.Height / 2, 1, 1, m_OverviewPixel);
+            }
+            ImGui::SameLine();
+            ImGui::Text("RGBA(%u, %u, %u, %u)", m_OverviewPixel[0], m_OverviewPixel[1],
+                        m_OverviewPixel[2], m_OverviewPixel[3]);
+        }
+
+        ImGui::Separator();
+
         // Camera controls
         ImGui::Text("Camera");
         ImGui::Text("Position: (%.2f, %.2f, %.2f)",
@@ -234,8 +494,13 @@ public:
 
         ImGui::Separator();
         ImGui::Text("Controls:");
-        ImGui::BulletText("WASD / Arrows: Move camera");
+        ImGui::BulletText(m_UseIJKL ? "IJKL / Arrows: Move camera" : "WASD / Arrows: Move camera");
         ImGui::BulletText("Q/E: Rotate camera");
+        ImGui::BulletText("Space: Toggle animation");
+        if (ImGui::Checkbox("Move with IJKL", &m_UseIJKL))
+        {
+            BindMovement(m_UseIJKL);
+        }
 
         if (ImGui::Button("Reset Camera"))
         {
@@ -243,6 +508,75 @@ public:
             m_CameraRotation = 0.0f;
         }
 
+        ImGui::Separator();
+
+        // Power saving (frames are only rendered on input, requests or the idle rate)
+        NanSu::Application& app = NanSu::Application::Get();
+        ImGui::Text("Power Saving");
+        bool powerSaving = app.IsPowerSaving();
+        if (ImGui::Checkbox("Enabled", &powerSaving))
+        {
+            app.SetPowerSaving(powerSaving);
+        }
+        ImGui::Checkbox("Animate", &m_Animate);
+        NanSu::float32 idleFrameRate = app.GetIdleFrameRate();
+        if (ImGui::SliderFloat("Idle FPS", &idleFrameRate, 0.0f, 30.0f, "%.1f"))
+        {
+            app.SetIdleFrameRate(idleFrameRate);
+        }
+        ImGui::Text("Frames rendered: %llu", static_cast<unsigned long long>(app.GetFrameCount()));
+
+        ImGui::Separator();
+
+        // Present mode and frame pacing
+        NanSu::GraphicsContext& context = app.GetGraphicsContext();
+        const char* presentModes[] = { "VSync", "Immediate", "Capped" };
+        int presentMode = static_cast<int>(context.GetPresentMode().Mode);
+        bool presentChanged = ImGui::Combo("Present Mode", &presentMode, presentModes, IM_ARRAYSIZE(presentModes));
+        if (presentMode == static_cast<int>(NanSu::PresentMode::Type::Capped))
+        {
+            presentChanged |= ImGui::SliderFloat("Frame Cap", &m_FrameCap, 10.0f, 240.0f, "%.0f FPS");
+        }
+        if (presentChanged)
+        {
+            switch (static_cast<NanSu::PresentMode::Type>(presentMode))
+            {
+                case NanSu::PresentMode::Type::VSync:       context.SetPresentMode(NanSu::PresentMode::VSync()); break;
+                case NanSu::PresentMode::Type::Immediate:   context.SetPresentMode(NanSu::PresentMode::Immediate()); break;
+                case NanSu::PresentMode::Type::Capped:      context.SetPresentMode(NanSu::PresentMode::Capped(m_FrameCap)); break;
+            }
+        }
+
+        const NanSu::FrameStatistics& frameStats = context.GetFrameStatistics();
+        ImGui::Text("Frame: %.2f ms avg (%.2f - %.2f), %.1f FPS",
+                    frameStats.AverageFrameTime * 1000.0, frameStats.MinFrameTime * 1000.0,
+                    frameStats.MaxFrameTime * 1000.0, frameStats.GetFramesPerSecond());
+        ImGui::Text("Latency: %.2f ms avg, present %.2f ms, limiter %.2f ms",
+                    frameStats.AverageLatency * 1000.0, frameStats.PresentTime * 1000.0,
+                    frameStats.WaitTime * 1000.0);
+
+        ImGui::Separator();
+
+        // Event recording (replay with --replay <file>)
+        ImGui::Text("Recording");
+        if (app.IsReplaying())
+        {
+            ImGui::Text("Replaying event log...");
+        }
+        else if (app.IsRecording())
+        {
+            if (ImGui::Button("Stop Recording"))
+            {
+                app.StopRecording();
+            }
+            ImGui::SameLine();
+            ImGui::Text("%llu frames", static_cast<unsigned long long>(app.GetRecordedFrameCount()));
+        }
+        else if (ImGui::Button("Record Session"))
+        {
+            app.StartRecording("Session.nsevents");
+        }
+
         ImGui::End();
     }
 
@@ -260,8 +594,99 @@ private:
     std::vector<std::string> m_TextureNames;
     int m_CurrentTextureIndex = 0;
 
+    // Input actions
+    NanSu::InputActionMap m_Actions;
+    NanSu::InputActionID m_MoveXAction = NanSu::INVALID_INPUT_ACTION;
+    NanSu::InputActionID m_MoveYAction = NanSu::INVALID_INPUT_ACTION;
+    NanSu::InputActionID m_RotateAction = NanSu::INVALID_INPUT_ACTION;
+    NanSu::InputActionID m_ToggleAnimationAction = NanSu::INVALID_INPUT_ACTION;
+    bool m_UseIJKL = false;
+
+    NanSu::vec3 m_LastCameraPosition = { 0.0f, 0.0f, 0.0f };
+    NanSu::float32 m_LastCameraRotation = 0.0f;
+
     // Renderer2D test
     NanSu::float32 m_QuadRotation = 0.0f;
+    bool m_Animate = true;
+    NanSu::float32 m_FrameCap = 60.0f;
+
+    // Texture atlas test
+    static constexpr NanSu::uint32 ATLAS_SPRITE_COUNT = 256;
+    NanSu::TextureAtlas* m_Atlas = nullptr;
+    std::vector<const NanSu::SubTexture2D*> m_AtlasSprites;
+
+    // Text rendering test
+    NanSu::Font* m_Font = nullptr;
+
+    // Tile map test
+    NanSu::TileMap* m_TileMap = nullptr;
+
+    // Particle test
+    NanSu::ParticleSystem m_Particles;
+
+    // Framebuffer test
+    NanSu::OrthographicCamera m_OverviewCamera;
+    NanSu::Framebuffer* m_Overview = nullptr;
+    NanSu::uint8 m_OverviewPixel[4] = {};
+};
+
+// =============================================================================
+// HudLayer - cached layer test (redrawn only when its text changes)
+// =============================================================================
+
+class HudLayer : public NanSu::Layer
+{
+public:
+    HudLayer()
+        : Layer("HudLayer")
+        , m_Camera(-1.6f, 1.6f, -0.9f, 0.9f)
+    {
+        SetCached(true);
+        SetEventInterest(NanSu::EventTypeMask::None());
+    }
+
+    void OnAttach() override
+    {
+        m_Font = new NanSu::Font("C:/Windows/Fonts/segoeui.ttf");
+    }
+
+    void OnDetach() override
+    {
+        delete m_Font;
+        m_Font = nullptr;
+    }
+
+    void OnUpdate() override
+    {
+        // The label only changes once a second (at 60 Hz), so the cache is reused in between
+        ++m_FrameCount;
+        if (m_FrameCount % 60 == 0)
+        {
+            MarkDirty();
+        }
+    }
+
+    void OnRender() override
+    {
+        NanSu::Renderer2D::BeginScene(m_Camera);
+
+        NanSu::Renderer2D::DrawQuad({ 1.15f, 0.75f }, { 0.8f, 0.22f }, { 0.0f, 0.0f, 0.0f, 0.6f });
+        NanSu::Renderer2D::DrawRect({ 1.15f, 0.75f, 0.0f }, { 0.8f, 0.22f }, { 1.0f, 1.0f, 1.0f, 0.8f }, 0.005f);
+
+        if (m_Font && m_Font->IsLoaded())
+        {
+            std::string label = "Frame " + std::to_string(m_FrameCount / 60 * 60) +
+                                "\nHUD redraws: " + std::to_string(GetCacheRenderCount() + 1);
+            NanSu::TextRenderer::DrawString(label, m_Font, { 0.8f, 0.79f, 0.0f }, 0.06f);
+        }
+
+        NanSu::Renderer2D::EndScene();
+    }
+
+private:
+    NanSu::OrthographicCamera m_Camera;
+    NanSu::Font* m_Font = nullptr;
+    NanSu::uint64 m_FrameCount = 0;
 };
 
 class EditorApplication : public NanSu::Application
@@ -271,6 +696,10 @@ public:
     {
         NS_INFO("EditorApplication created");
         PushLayer(new EditorLayer());
+        PushLayer(new HudLayer());
+
+        // Redraw only on input, animation or at the idle rate
+        SetPowerSaving(true);
     }
 
     ~EditorApplication()
@@ -0,0 +1,130 @@
+#include "EnginePCH.h"
+#include "Asset/AssetPack.h"
+#include "Asset/Compression.h"
+
+namespace NanSu
+{
+    bool AssetPack::Open(const std::string& filePath)
+    {
+        Close();
+
+        if (!m_File.Open(filePath))
+        {
+            return false;
+        }
+
+        const byte* data = m_File.GetData();
+        usize size = m_File.GetSize();
+
+        if (size < sizeof(AssetPackHeader))
+        {
+            NS_ENGINE_ERROR("Asset pack too small: {}", filePath);
+            Close();
+            return false;
+        }
+
+        const auto* header = reinterpret_cast<const AssetPackHeader*>(data);
+        if (header->Magic != ASSET_PACK_MAGIC || header->Version != ASSET_PACK_VERSION)
+        {
+            NS_ENGINE_ERROR("Invalid or outdated asset pack: {}", filePath);
+            Close();
+            return false;
+        }
+
+        // Subtraction form: offsets and sizes are untrusted and must not wrap
+        usize tocEnd = sizeof(AssetPackHeader) + sizeof(AssetPackEntry) * static_cast<usize>(header->EntryCount);
+        if (tocEnd > size || header->StringTableOffset > size ||
+            header->StringTableSize > size - header->StringTableOffset)
+        {
+            NS_ENGINE_ERROR("Corrupt asset pack table of contents: {}", filePath);
+            Close();
+            return false;
+        }
+
+        m_Entries = { reinterpret_cast<const AssetPackEntry*>(data + sizeof(AssetPackHeader)), header->EntryCount };
+        m_StringTable = reinterpret_cast<const char*>(data + header->StringTableOffset);
+
+        for (usize i = 0; i < m_Entries.size(); ++i)
+        {
+            const AssetPackEntry& entry = m_Entries[i];
+
+            bool isCompressed = (entry.Flags & AssetPackEntryFlags_Compressed) != 0;
+            bool validSize = isCompressed
+                ? entry.OriginalSize <= Compression::GetDecompressBound(static_cast<usize>(entry.StoredSize))
+                : entry.OriginalSize == entry.StoredSize;
+
+            if (entry.Offset > size || entry.StoredSize > size - entry.Offset || !validSize ||
+                static_cast<uint64>(entry.NameOffset) + entry.NameLength > header->StringTableSize)
+            {
+                NS_ENGINE_ERROR("Corrupt asset pack entry in: {}", filePath);
+                Close();
+                return false;
+            }
+
+            // Find() binary-searches by hash
+            if (i > 0 && m_Entries[i - 1].PathHash > entry.PathHash)
+            {
+                NS_ENGINE_ERROR("Asset pack table of contents is not sorted by path hash: {}", filePath);
+                Close();
+                return false;
+            }
+        }
+
+        m_FilePath = filePath;
+        return true;
+    }
+
+    void AssetPack::Close()
+    {
+        m_File.Close();
+        m_Entries = {};
+        m_StringTable = nullptr;
+        m_FilePath.clear();
+    }
+
+    const AssetPackEntry* AssetPack::Find(std::string_view normalizedPath) const
+    {
+        uint64 hash = HashAssetPath(normalizedPath);
+
+        auto it = std::lower_bound(m_Entries.begin(), m_Entries.end(), hash,
+            [](const AssetPackEntry& entry, uint64 value) { return entry.PathHash < value; });
+
+        // Walk all entries sharing the hash and confirm by name
+        for (; it != m_Entries.end() && it->PathHash == hash; ++it)
+        {
+            if (GetEntryName(*it) == normalizedPath)
+            {
+                return &*it;
+            }
+        }
+
+        return nullptr;
+    }
+
+    std::span<const byte> AssetPack::GetStoredData(const AssetPackEntry& entry) const
+    {
+        return { m_File.GetData() + entry.Offset, static_cast<usize>(entry.StoredSize) };
+    }
+
+    std::string_view AssetPack::GetEntryName(const AssetPackEntry& entry) const
+    {
+        return { m_StringTable + entry.NameOffset, entry.NameLength };
+    }
+
+    bool AssetPack::Decompress(const AssetPackEntry& entry, std::vector<byte>& outData) const
+    {
+        NS_ENGINE_ASSERT(entry.Flags & AssetPackEntryFlags_Compressed, "Asset pack entry is not compressed");
+
+        outData.resize(static_cast<usize>(entry.OriginalSize));
+        std::span<const byte> stored = GetStoredData(entry);
+
+        if (!Compression::DecompressBlock(stored.data(), stored.size(), outData.data(), outData.size()))
+        {
+            NS_ENGINE_ERROR("Failed to decompress asset '{}'", GetEntryName(entry));
+            outData.clear();
+            return false;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Core/MappedFile.h"
+#include "Asset/AssetPackFormat.h"
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NanSu
+{
+    /**
+     * @brief Read-only view of a memory-mapped asset pack (.nspak)
+     *
+     * Lookups binary-search the hash-sorted table of contents; uncompressed
+     * entries are returned as spans pointing directly into the mapping.
+     *
+     * Usage:
+     *   AssetPack pack;
+     *   if (pack.Open("Assets.nspak"))
+     *   {
+     *       if (const AssetPackEntry* entry = pack.Find("shaders/renderer2d.hlsl"))
+     *           auto bytes = pack.GetStoredData(*entry);
+     *   }
+     */
+    class AssetPack
+    {
+    public:
+        AssetPack() = default;
+        ~AssetPack() = default;
+
+        // Non-copyable
+        AssetPack(const AssetPack&) = delete;
+        AssetPack& operator=(const AssetPack&) = delete;
+
+        /**
+         * @brief Map and validate a pack file
+         *
+         * Rejects packs whose entries point outside the file, whose sizes
+         * are inconsistent with their compression, or whose table of
+         * contents is not sorted by path hash.
+         *
+         * @param filePath Path to the .nspak file
+         * @return true if the pack was mapped and its table of contents is valid
+         */
+        bool Open(const std::string& filePath);
+
+        /**
+         * @brief Unmap the pack; all previously returned spans become invalid
+         */
+        void Close();
+
+        bool IsOpen() const { return m_File.IsOpen(); }
+        uint32 GetEntryCount() const { return static_cast<uint32>(m_Entries.size()); }
+        const std::string& GetFilePath() const { return m_FilePath; }
+
+        /**
+         * @brief Find an entry by its normalized path (see NormalizeAssetPath)
+         * @return The entry, or nullptr if the pack does not contain the path
+         */
+        const AssetPackEntry* Find(std::string_view normalizedPath) const;
+
+        /**
+         * @brief Get the entry payload exactly as stored (zero-copy)
+         */
+        std::span<const byte> GetStoredData(const AssetPackEntry& entry) const;
+
+        /**
+         * @brief Get the normalized path of an entry
+         */
+        std::string_view GetEntryName(const AssetPackEntry& entry) const;
+
+        /**
+         * @brief Decompress a compressed entry into an owned buffer
+         * @param entry Entry flagged with AssetPackEntryFlags_Compressed
+         * @param outData Receives OriginalSize bytes
+         * @return false if the payload is corrupt
+         */
+        bool Decompress(const AssetPackEntry& entry, std::vector<byte>& outData) const;
+
+    private:
+        std::string m_FilePath;
+        MappedFile m_File;
+        std::span<const AssetPackEntry> m_Entries;
+        const char* m_StringTable = nullptr;
+    };
+}
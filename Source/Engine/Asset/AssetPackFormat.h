@@ -0,0 +1,124 @@
+#pragma once
+
+#include "Core/Types.h"
+
+#include <string>
+#include <string_view>
+
+namespace NanSu
+{
+    // =========================================================================
+    // Asset Pack Format (.nspak)
+    // =========================================================================
+    //
+    // Single archive built offline by the AssetPacker tool from the Assets/
+    // tree. The runtime memory-maps the file and serves entries in place.
+    //
+    // File layout:
+    //   [AssetPackHeader]
+    //   [AssetPackEntry x EntryCount]   sorted by PathHash (binary search)
+    //   [String table]                  normalized paths, not null-terminated
+    //   [Payloads, each aligned to ASSET_PACK_PAYLOAD_ALIGNMENT]
+    //
+    // Entry paths are relative to the Assets/ directory, use forward slashes
+    // and are lower-case (e.g. "shaders/renderer2d.hlsl").
+    // =========================================================================
+
+    constexpr uint32 ASSET_PACK_MAGIC = 0x4B50534E;    // "NSPK" (little-endian)
+    constexpr uint32 ASSET_PACK_VERSION = 1;
+    constexpr uint32 ASSET_PACK_PAYLOAD_ALIGNMENT = 64;
+    constexpr const char* ASSET_PACK_EXTENSION = ".nspak";
+
+    /**
+     * @brief Per-entry storage flags
+     */
+    enum AssetPackEntryFlags : uint32
+    {
+        AssetPackEntryFlags_None = 0,
+        AssetPackEntryFlags_Compressed = 1 << 0     // Payload is an LZ4 block (see Asset/Compression.h)
+    };
+
+    /**
+     * @brief Header at the start of every asset pack
+     */
+    struct AssetPackHeader
+    {
+        uint32 Magic = ASSET_PACK_MAGIC;
+        uint32 Version = ASSET_PACK_VERSION;
+        uint32 EntryCount = 0;
+        uint32 StringTableSize = 0;
+        uint64 StringTableOffset = 0;
+        uint64 Reserved = 0;
+    };
+
+    /**
+     * @brief Table of contents entry describing one packed asset
+     */
+    struct AssetPackEntry
+    {
+        uint64 PathHash = 0;            // HashAssetPath() of the normalized path
+        uint64 Offset = 0;              // Byte offset of the payload from the start of the file
+        uint64 StoredSize = 0;          // Payload size inside the pack
+        uint64 OriginalSize = 0;        // Size after decompression (== StoredSize if uncompressed)
+        uint32 NameOffset = 0;          // Offset into the string table
+        uint32 NameLength = 0;
+        uint32 Flags = AssetPackEntryFlags_None;
+        uint32 Reserved = 0;
+    };
+
+    static_assert(sizeof(AssetPackHeader) == 32, "AssetPackHeader layout changed");
+    static_assert(sizeof(AssetPackEntry) == 48, "AssetPackEntry layout changed");
+
+    /**
+     * @brief Normalize a file path to its asset pack key
+     * @param filePath Any path containing an "Assets/" directory, or an already relative path
+     * @return Lower-case path relative to Assets/ with forward slashes
+     *
+     * Example: "../../Assets/Shaders/Renderer2D.hlsl" -> "shaders/renderer2d.hlsl"
+     */
+    inline std::string NormalizeAssetPath(std::string_view filePath)
+    {
+        std::string result;
+        result.reserve(filePath.size());
+        for (char c : filePath)
+        {
+            if (c == '\\')
+            {
+                c = '/';
+            }
+            else if (c >= 'A' && c <= 'Z')
+            {
+                c = static_cast<char>(c - 'A' + 'a');
+            }
+            result.push_back(c);
+        }
+
+        constexpr std::string_view ASSETS_ROOT = "assets/";
+        usize root = result.rfind(ASSETS_ROOT);
+        if (root != std::string::npos && (root == 0 || result[root - 1] == '/'))
+        {
+            result.erase(0, root + ASSETS_ROOT.size());
+        }
+
+        while (result.rfind("./", 0) == 0)
+        {
+            result.erase(0, 2);
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief 64-bit FNV-1a hash of a normalized asset path
+     */
+    constexpr uint64 HashAssetPath(std::string_view normalizedPath)
+    {
+        uint64 hash = 0xCBF29CE484222325ull;
+        for (char c : normalizedPath)
+        {
+            hash ^= static_cast<uint8>(c);
+            hash *= 0x100000001B3ull;
+        }
+        return hash;
+    }
+}
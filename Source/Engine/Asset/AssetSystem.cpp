@@ -0,0 +1,99 @@
+#include "EnginePCH.h"
+#include "Asset/AssetSystem.h"
+#include "Asset/AssetPack.h"
+
+#include <filesystem>
+
+namespace NanSu
+{
+    std::unique_ptr<AssetPack> AssetSystem::s_Pack;
+    std::unordered_set<std::string> AssetSystem::s_DiskOverrides;
+
+    void AssetSystem::Initialize(const std::string& packPath)
+    {
+        NS_ENGINE_ASSERT(!s_Pack, "Asset system already initialized");
+
+        s_Pack = std::make_unique<AssetPack>();
+        if (s_Pack->Open(packPath))
+        {
+            NS_ENGINE_INFO("Asset pack mounted: {} ({} entries)", packPath, s_Pack->GetEntryCount());
+        }
+        else
+        {
+            NS_ENGINE_INFO("No asset pack at '{}', loading assets from disk", packPath);
+        }
+    }
+
+    void AssetSystem::Shutdown()
+    {
+        s_Pack.reset();
+        s_DiskOverrides.clear();
+    }
+
+    void AssetSystem::PreferDiskVersion(const std::string& filePath)
+    {
+        s_DiskOverrides.insert(NormalizeAssetPath(filePath));
+    }
+
+    bool AssetSystem::IsPackMounted()
+    {
+        return s_Pack && s_Pack->IsOpen();
+    }
+
+    bool AssetSystem::Exists(const std::string& filePath)
+    {
+        std::string key = NormalizeAssetPath(filePath);
+        if (IsPackMounted() && !s_DiskOverrides.contains(key) && s_Pack->Find(key))
+        {
+            return true;
+        }
+
+        std::error_code ec;
+        return std::filesystem::exists(filePath, ec);
+    }
+
+    AssetData AssetSystem::Load(const std::string& filePath)
+    {
+        AssetData result;
+
+        std::string key = NormalizeAssetPath(filePath);
+        if (IsPackMounted() && !s_DiskOverrides.contains(key))
+        {
+            if (const AssetPackEntry* entry = s_Pack->Find(key))
+            {
+                if (entry->Flags & AssetPackEntryFlags_Compressed)
+                {
+                    if (s_Pack->Decompress(*entry, result.m_Storage))
+                    {
+                        result.m_View = result.m_Storage;
+                    }
+                }
+                else
+                {
+                    result.m_View = s_Pack->GetStoredData(*entry);
+                }
+                return result;
+            }
+        }
+
+        // Fallback: loose file on disk
+        std::ifstream file(filePath, std::ios::in | std::ios::binary | std::ios::ate);
+        if (!file)
+        {
+            return result;
+        }
+
+        std::streamsize size = file.tellg();
+        file.seekg(0, std::ios::beg);
+
+        result.m_Storage.resize(static_cast<usize>(size));
+        if (!file.read(reinterpret_cast<char*>(result.m_Storage.data()), size))
+        {
+            result.m_Storage.clear();
+            return result;
+        }
+
+        result.m_View = result.m_Storage;
+        return result;
+    }
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Core/Types.h"
+
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace NanSu
+{
+    // Forward declaration
+    class AssetPack;
+
+    /**
+     * @brief Bytes of a loaded asset
+     *
+     * Either a zero-copy view into the mapped asset pack, or an owned buffer
+     * (compressed pack entries and loose files read from disk).
+     * Views into the pack stay valid until AssetSystem::Shutdown().
+     */
+    class AssetData
+    {
+    public:
+        AssetData() = default;
+        AssetData(AssetData&&) noexcept = default;
+        AssetData& operator=(AssetData&&) noexcept = default;
+
+        // Non-copyable (the view may point into the owned buffer)
+        AssetData(const AssetData&) = delete;
+        AssetData& operator=(const AssetData&) = delete;
+
+        bool IsValid() const { return m_View.data() != nullptr; }
+        bool IsZeroCopy() const { return IsValid() && m_Storage.empty(); }
+
+        const byte* GetData() const { return m_View.data(); }
+        usize GetSize() const { return m_View.size(); }
+        std::span<const byte> GetSpan() const { return m_View; }
+
+        /**
+         * @brief View the contents as text (e.g. shader source)
+         */
+        std::string_view AsString() const
+        {
+            return { reinterpret_cast<const char*>(m_View.data()), m_View.size() };
+        }
+
+    private:
+        friend class AssetSystem;
+
+        std::span<const byte> m_View;
+        std::vector<byte> m_Storage;
+    };
+
+    /**
+     * @brief Resolves asset paths through the asset pack, falling back to disk
+     *
+     * Paths are accepted in the form the engine already uses
+     * ("../../Assets/Shaders/Renderer2D.hlsl") and normalized to pack keys.
+     * When no pack is mounted, or a path is missing from it, the file is read
+     * from disk so loose assets keep working during development.
+     */
+    class AssetSystem
+    {
+    public:
+        /**
+         * @brief Mount the asset pack (missing packs are not an error)
+         * @param packPath Path to the .nspak file
+         */
+        static void Initialize(const std::string& packPath);
+        static void Shutdown();
+
+        /**
+         * @brief Check whether a path exists in the pack or on disk
+         */
+        static bool Exists(const std::string& filePath);
+
+        /**
+         * @brief Load the contents of an asset
+         * @param filePath Path to the asset
+         * @return The asset bytes; IsValid() is false if the asset was not found
+         */
+        static AssetData Load(const std::string& filePath);
+
+        static bool IsPackMounted();
+
+        /**
+         * @brief Serve a path from disk from now on, even if the pack contains it
+         *
+         * Used by hot reload so edited loose files replace their packed copies.
+         */
+        static void PreferDiskVersion(const std::string& filePath);
+
+    private:
+        static std::unique_ptr<AssetPack> s_Pack;
+        static std::unordered_set<std::string> s_DiskOverrides;
+    };
+
+    // Loose asset root, relative to the executable working directory
+    constexpr const char* ASSET_DEFAULT_DIRECTORY = "../../Assets";
+
+    // Default location of the pack written by the AssetPacker tool
+    constexpr const char* ASSET_PACK_DEFAULT_PATH = "../../Build/Assets.nspak";
+}
@@ -0,0 +1,215 @@
+#include "EnginePCH.h"
+#include "Asset/AssetWatcher.h"
+#include "Asset/AssetSystem.h"
+#include "Asset/AssetPackFormat.h"
+#include "Asset/FileWatchBackend.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+namespace NanSu
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        constexpr uint32 BACKEND_POLL_TIMEOUT_MS = 50;
+
+        struct WatchEntry
+        {
+            uint32 Handle = 0;
+            std::string FilePath;
+            AssetReloadCallback Callback;
+        };
+
+        struct AssetWatcherData
+        {
+            std::thread Thread;
+            std::atomic<bool> Running = false;
+
+            // Shared between the watcher thread and the main thread
+            std::mutex ReadyMutex;
+            std::vector<std::string> ReadyKeys;
+
+            // Main thread only
+            std::unordered_map<std::string, std::vector<WatchEntry>> Watches;
+            std::unordered_map<uint32, std::string> HandleToKey;
+            uint32 NextHandle = 1;
+        };
+
+        AssetWatcherData s_Data;
+
+        void WatcherThread(std::unique_ptr<FileWatchBackend> backend)
+        {
+            // Normalized key -> time of the most recent change
+            std::unordered_map<std::string, Clock::time_point> pending;
+            std::vector<std::string> changed;
+
+            while (s_Data.Running.load(std::memory_order_relaxed))
+            {
+                changed.clear();
+                backend->Poll(BACKEND_POLL_TIMEOUT_MS, changed);
+
+                Clock::time_point now = Clock::now();
+                for (const std::string& path : changed)
+                {
+                    pending[NormalizeAssetPath(path)] = now;
+                }
+
+                // Promote files that have been quiet for the debounce window
+                std::vector<std::string> ready;
+                for (auto it = pending.begin(); it != pending.end(); )
+                {
+                    if (now - it->second >= std::chrono::milliseconds(ASSET_WATCHER_DEBOUNCE_MS))
+                    {
+                        ready.push_back(it->first);
+                        it = pending.erase(it);
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+
+                if (!ready.empty())
+                {
+                    std::lock_guard<std::mutex> lock(s_Data.ReadyMutex);
+                    s_Data.ReadyKeys.insert(s_Data.ReadyKeys.end(), ready.begin(), ready.end());
+                }
+            }
+        }
+    }
+
+    // =========================================================================
+    // Lifecycle
+    // =========================================================================
+
+    void AssetWatcher::Initialize(const std::vector<std::string>& directories)
+    {
+        NS_ENGINE_ASSERT(!IsRunning(), "Asset watcher already initialized");
+
+        std::unique_ptr<FileWatchBackend> backend = FileWatchBackend::Create();
+        if (!backend->Start(directories))
+        {
+            NS_ENGINE_WARN("Native file watching unavailable, falling back to polling");
+            backend = FileWatchBackend::CreatePolling();
+            if (!backend->Start(directories))
+            {
+                NS_ENGINE_WARN("Asset hot reload disabled: no watchable directories");
+                return;
+            }
+        }
+
+        s_Data.Running = true;
+        s_Data.Thread = std::thread(WatcherThread, std::move(backend));
+
+        NS_ENGINE_INFO("Asset watcher started ({} directories)", directories.size());
+    }
+
+    void AssetWatcher::Shutdown()
+    {
+        if (!IsRunning())
+        {
+            return;
+        }
+
+        s_Data.Running = false;
+        s_Data.Thread.join();
+
+        s_Data.ReadyKeys.clear();
+        s_Data.Watches.clear();
+        s_Data.HandleToKey.clear();
+    }
+
+    bool AssetWatcher::IsRunning()
+    {
+        return s_Data.Running.load(std::memory_order_relaxed);
+    }
+
+    // =========================================================================
+    // Registration
+    // =========================================================================
+
+    uint32 AssetWatcher::Watch(const std::string& filePath, AssetReloadCallback callback)
+    {
+        if (!IsRunning())
+        {
+            return 0;
+        }
+
+        std::string key = NormalizeAssetPath(filePath);
+        uint32 handle = s_Data.NextHandle++;
+
+        s_Data.Watches[key].push_back({ handle, filePath, std::move(callback) });
+        s_Data.HandleToKey[handle] = std::move(key);
+        return handle;
+    }
+
+    void AssetWatcher::Unwatch(uint32 handle)
+    {
+        auto keyIt = s_Data.HandleToKey.find(handle);
+        if (keyIt == s_Data.HandleToKey.end())
+        {
+            return;
+        }
+
+        auto watchIt = s_Data.Watches.find(keyIt->second);
+        if (watchIt != s_Data.Watches.end())
+        {
+            auto& entries = watchIt->second;
+            entries.erase(std::remove_if(entries.begin(), entries.end(),
+                [handle](const WatchEntry& entry) { return entry.Handle == handle; }), entries.end());
+
+            if (entries.empty())
+            {
+                s_Data.Watches.erase(watchIt);
+            }
+        }
+
+        s_Data.HandleToKey.erase(keyIt);
+    }
+
+    // =========================================================================
+    // Frame Boundary
+    // =========================================================================
+
+    void AssetWatcher::ProcessPendingReloads()
+    {
+        if (!IsRunning())
+        {
+            return;
+        }
+
+        std::vector<std::string> readyKeys;
+        {
+            std::lock_guard<std::mutex> lock(s_Data.ReadyMutex);
+            readyKeys.swap(s_Data.ReadyKeys);
+        }
+
+        for (const std::string& key : readyKeys)
+        {
+            auto it = s_Data.Watches.find(key);
+            if (it == s_Data.Watches.end())
+            {
+                continue;
+            }
+
+            NS_ENGINE_INFO("Asset changed, reloading: {}", key);
+
+            // The edited loose file now supersedes the copy in the asset pack
+            AssetSystem::PreferDiskVersion(it->second.front().FilePath);
+
+            // Callbacks may (un)register watches, so re-check each handle before calling it
+            std::vector<WatchEntry> entries = it->second;
+            for (const WatchEntry& entry : entries)
+            {
+                if (s_Data.HandleToKey.contains(entry.Handle))
+                {
+                    entry.Callback(entry.FilePath);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Core/Types.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// Hot reload is a development feature; shipping builds never watch files
+#ifndef NS_DISTRIBUTION
+    #define NS_ENABLE_HOT_RELOAD 1
+#else
+    #define NS_ENABLE_HOT_RELOAD 0
+#endif
+
+namespace NanSu
+{
+    /**
+     * @brief Callback invoked on the main thread when a watched file changed
+     * @param filePath The path the callback was registered with
+     */
+    using AssetReloadCallback = std::function<void(const std::string& filePath)>;
+
+    /**
+     * @brief Watches asset directories and schedules reloads at frame boundaries
+     *
+     * A background thread collects change notifications from the OS
+     * (ReadDirectoryChangesW, inotify, or polling as a fallback) and debounces
+     * them, so editors that write a file in several steps trigger one reload.
+     * ProcessPendingReloads() runs the callbacks on the main thread between
+     * frames, where GPU resources can be swapped safely.
+     *
+     * Watch(), Unwatch() and ProcessPendingReloads() must be called from the
+     * main thread. Watch() is a no-op returning 0 when the watcher is not
+     * running (e.g. Distribution builds).
+     *
+     * Usage:
+     *   uint32 handle = AssetWatcher::Watch(path, [this](const std::string&) { Reload(); });
+     *   ...
+     *   AssetWatcher::Unwatch(handle);
+     */
+    class AssetWatcher
+    {
+    public:
+        /**
+         * @brief Start the background watcher thread
+         * @param directories Directories to watch recursively
+         */
+        static void Initialize(const std::vector<std::string>& directories);
+        static void Shutdown();
+
+        static bool IsRunning();
+
+        /**
+         * @brief Register a callback for a file
+         * @param filePath Asset path, in any form accepted by AssetSystem
+         * @param callback Invoked after the file changed on disk
+         * @return Handle for Unwatch(), or 0 if the watcher is not running
+         */
+        static uint32 Watch(const std::string& filePath, AssetReloadCallback callback);
+
+        /**
+         * @brief Remove a callback registered with Watch()
+         */
+        static void Unwatch(uint32 handle);
+
+        /**
+         * @brief Run callbacks for all changes whose debounce period elapsed
+         *
+         * Called once per frame from Application::Run before layers update.
+         */
+        static void ProcessPendingReloads();
+    };
+
+    // Changes to the same file within this window are merged into one reload
+    constexpr uint32 ASSET_WATCHER_DEBOUNCE_MS = 150;
+}
@@ -0,0 +1,214 @@
+#include "EnginePCH.h"
+#include "Asset/Compression.h"
+
+#include <cstring>
+
+namespace NanSu::Compression
+{
+    namespace
+    {
+        // Block format limits (shared with the reference LZ4 decoder)
+        constexpr usize MIN_MATCH = 4;
+        constexpr usize LAST_LITERALS = 5;     // The last 5 bytes are always literals
+        constexpr usize MF_LIMIT = 12;         // The last match must start 12 bytes before the end
+        constexpr usize MAX_OFFSET = 65535;
+
+        constexpr uint32 HASH_LOG = 12;
+        constexpr uint32 HASH_SIZE = 1u << HASH_LOG;
+
+        uint32 Read32(const byte* p)
+        {
+            uint32 value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        uint32 HashSequence(uint32 sequence)
+        {
+            return (sequence * 2654435761u) >> (32 - HASH_LOG);
+        }
+
+        void WriteLength(std::vector<byte>& dst, usize length)
+        {
+            while (length >= 255)
+            {
+                dst.push_back(255);
+                length -= 255;
+            }
+            dst.push_back(static_cast<byte>(length));
+        }
+
+        void EmitSequence(std::vector<byte>& dst, const byte* literals, usize literalLength,
+                          usize offset, usize matchLength)
+        {
+            usize matchCode = matchLength >= MIN_MATCH ? matchLength - MIN_MATCH : 0;
+
+            byte token = static_cast<byte>((std::min<usize>(literalLength, 15) << 4) |
+                                           (matchLength ? std::min<usize>(matchCode, 15) : 0));
+            dst.push_back(token);
+
+            if (literalLength >= 15)
+            {
+                WriteLength(dst, literalLength - 15);
+            }
+            dst.insert(dst.end(), literals, literals + literalLength);
+
+            // Final sequence carries literals only
+            if (matchLength == 0)
+            {
+                return;
+            }
+
+            dst.push_back(static_cast<byte>(offset & 0xFF));
+            dst.push_back(static_cast<byte>(offset >> 8));
+
+            if (matchCode >= 15)
+            {
+                WriteLength(dst, matchCode - 15);
+            }
+        }
+
+        bool ReadLength(const byte*& ip, const byte* ipEnd, usize& length)
+        {
+            byte value;
+            do
+            {
+                if (ip >= ipEnd)
+                {
+                    return false;
+                }
+                value = *ip++;
+                length += value;
+            } while (value == 255);
+            return true;
+        }
+    }
+
+    // =========================================================================
+    // Compression
+    // =========================================================================
+
+    void CompressBlock(const byte* src, usize srcSize, std::vector<byte>& dst)
+    {
+        dst.clear();
+        dst.reserve(GetCompressBound(srcSize));
+
+        usize anchor = 0;
+
+        if (srcSize > MF_LIMIT)
+        {
+            // Positions are stored +1 so zero means "empty slot"
+            std::vector<uint32> table(HASH_SIZE, 0);
+
+            const usize matchLimit = srcSize - LAST_LITERALS;
+            const usize scanLimit = srcSize - MF_LIMIT;
+            usize ip = 0;
+
+            while (ip < scanLimit)
+            {
+                uint32 sequence = Read32(src + ip);
+                uint32 hash = HashSequence(sequence);
+                usize candidate = table[hash];
+                table[hash] = static_cast<uint32>(ip + 1);
+
+                if (candidate == 0 || ip - (candidate - 1) > MAX_OFFSET ||
+                    Read32(src + candidate - 1) != sequence)
+                {
+                    ++ip;
+                    continue;
+                }
+
+                usize ref = candidate - 1;
+                usize matchLength = MIN_MATCH;
+                while (ip + matchLength < matchLimit && src[ref + matchLength] == src[ip + matchLength])
+                {
+                    ++matchLength;
+                }
+
+                EmitSequence(dst, src + anchor, ip - anchor, ip - ref, matchLength);
+
+                ip += matchLength;
+                anchor = ip;
+            }
+        }
+
+        EmitSequence(dst, src + anchor, srcSize - anchor, 0, 0);
+    }
+
+    // =========================================================================
+    // Decompression
+    // =========================================================================
+
+    bool DecompressBlock(const byte* src, usize srcSize, byte* dst, usize dstSize)
+    {
+        const byte* ip = src;
+        const byte* ipEnd = src + srcSize;
+        byte* op = dst;
+        byte* opEnd = dst + dstSize;
+
+        while (ip < ipEnd)
+        {
+            byte token = *ip++;
+
+            // Literals
+            usize literalLength = token >> 4;
+            if (literalLength == 15 && !ReadLength(ip, ipEnd, literalLength))
+            {
+                return false;
+            }
+            if (literalLength > static_cast<usize>(ipEnd - ip) || literalLength > static_cast<usize>(opEnd - op))
+            {
+                return false;
+            }
+            std::memcpy(op, ip, literalLength);
+            ip += literalLength;
+            op += literalLength;
+
+            // The last sequence ends right after its literals
+            if (ip == ipEnd)
+            {
+                break;
+            }
+
+            // Match
+            if (ipEnd - ip < 2)
+            {
+                return false;
+            }
+            usize offset = static_cast<usize>(ip[0]) | (static_cast<usize>(ip[1]) << 8);
+            ip += 2;
+            if (offset == 0 || offset > static_cast<usize>(op - dst))
+            {
+                return false;
+            }
+
+            usize matchLength = token & 0x0F;
+            if (matchLength == 15 && !ReadLength(ip, ipEnd, matchLength))
+            {
+                return false;
+            }
+            matchLength += MIN_MATCH;
+            if (matchLength > static_cast<usize>(opEnd - op))
+            {
+                return false;
+            }
+
+            const byte* match = op - offset;
+            if (offset >= matchLength)
+            {
+                std::memcpy(op, match, matchLength);
+                op += matchLength;
+            }
+            else
+            {
+                // Overlapping copy repeats the last `offset` bytes
+                for (usize i = 0; i < matchLength; ++i)
+                {
+                    *op++ = *match++;
+                }
+            }
+        }
+
+        return op == opEnd;
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Core/Types.h"
+
+#include <vector>
+
+namespace NanSu
+{
+    /**
+     * @brief Fast LZ77 block codec compatible with the LZ4 block format
+     *
+     * Used for asset pack payloads: compression runs offline in the packer,
+     * decompression runs at load time and is bounded by memory bandwidth.
+     * Blocks carry no header; the caller stores the original size.
+     */
+    namespace Compression
+    {
+        /**
+         * @brief Upper bound of the compressed size for a given input size
+         */
+        constexpr usize GetCompressBound(usize srcSize)
+        {
+            return srcSize + srcSize / 255 + 16;
+        }
+
+        /**
+         * @brief Upper bound of the decompressed size of a block of the given size
+         *
+         * A byte of a block expands to at most 255 output bytes (a length
+         * continuation byte), so larger sizes identify a corrupt block.
+         */
+        constexpr usize GetDecompressBound(usize srcSize)
+        {
+            return srcSize * 255;
+        }
+
+        /**
+         * @brief Compress a buffer into a single block
+         * @param src Source data
+         * @param srcSize Source size in bytes
+         * @param dst Receives the compressed block (resized to fit)
+         */
+        void CompressBlock(const byte* src, usize srcSize, std::vector<byte>& dst);
+
+        /**
+         * @brief Decompress a block produced by CompressBlock
+         * @param src Compressed block
+         * @param srcSize Compressed size in bytes
+         * @param dst Destination buffer
+         * @param dstSize Exact original size in bytes
+         * @return false if the block is malformed or does not decode to dstSize bytes
+         */
+        bool DecompressBlock(const byte* src, usize srcSize, byte* dst, usize dstSize);
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Core/Types.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace NanSu
+{
+    /**
+     * @brief OS-specific source of file change notifications
+     *
+     * Driven from the AssetWatcher background thread only. Implementations:
+     *   - Windows: ReadDirectoryChangesW (Platform/Windows/WindowsFileWatchBackend.cpp)
+     *   - Linux:   inotify              (Platform/Linux/LinuxFileWatchBackend.cpp)
+     *   - Others:  timestamp polling    (Asset/PollingFileWatchBackend.cpp)
+     */
+    class FileWatchBackend
+    {
+    public:
+        virtual ~FileWatchBackend() = default;
+
+        /**
+         * @brief Start watching the given directories recursively
+         * @return false if no directory could be watched
+         */
+        virtual bool Start(const std::vector<std::string>& directories) = 0;
+
+        /**
+         * @brief Wait up to timeoutMs for changes
+         * @param timeoutMs Maximum time to block
+         * @param outChangedFiles Receives paths (root-prefixed) of files that changed
+         */
+        virtual void Poll(uint32 timeoutMs, std::vector<std::string>& outChangedFiles) = 0;
+
+        /**
+         * @brief Create the native backend for the current platform
+         */
+        static std::unique_ptr<FileWatchBackend> Create();
+
+        /**
+         * @brief Create the portable timestamp-polling backend
+         */
+        static std::unique_ptr<FileWatchBackend> CreatePolling();
+    };
+}
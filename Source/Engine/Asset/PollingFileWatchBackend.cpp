@@ -0,0 +1,111 @@
+#include "EnginePCH.h"
+#include "Asset/FileWatchBackend.h"
+
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+namespace NanSu
+{
+    namespace
+    {
+        /**
+         * @brief Fallback backend that compares last-write times of all files
+         *
+         * Used on platforms without a native notification API, or when the
+         * native backend fails to start. Every poll rescans the directories,
+         * so files created after Start() are reported like modified ones, and
+         * files that disappear are forgotten so a later recreate is reported
+         * too (as the native backends do).
+         */
+        class PollingFileWatchBackend : public FileWatchBackend
+        {
+        public:
+            bool Start(const std::vector<std::string>& directories) override
+            {
+                m_Directories = directories;
+                m_Files.clear();
+                std::vector<std::string> ignored;
+                Scan(ignored);
+                return !m_Directories.empty();
+            }
+
+            void Poll(uint32 timeoutMs, std::vector<std::string>& outChangedFiles) override
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+                Scan(outChangedFiles);
+            }
+
+        private:
+            struct FileState
+            {
+                std::filesystem::file_time_type WriteTime;
+                uint64 ScanIndex = 0;
+            };
+
+            void Scan(std::vector<std::string>& outChangedFiles)
+            {
+                namespace fs = std::filesystem;
+
+                ++m_ScanIndex;
+                bool complete = true;
+
+                for (const std::string& directory : m_Directories)
+                {
+                    std::error_code ec;
+                    for (auto it = fs::recursive_directory_iterator(directory, ec);
+                         !ec && it != fs::recursive_directory_iterator(); it.increment(ec))
+                    {
+                        // Separate error code: a file vanishing mid-scan must not end the iteration
+                        std::error_code fileEc;
+                        if (!it->is_regular_file(fileEc))
+                        {
+                            continue;
+                        }
+
+                        fs::file_time_type writeTime = it->last_write_time(fileEc);
+                        if (fileEc)
+                        {
+                            continue;
+                        }
+
+                        std::string path = it->path().generic_string();
+
+                        auto [entry, inserted] = m_Files.try_emplace(path, FileState{ writeTime, m_ScanIndex });
+                        if (inserted || entry->second.WriteTime != writeTime)
+                        {
+                            entry->second.WriteTime = writeTime;
+                            outChangedFiles.push_back(std::move(path));
+                        }
+                        entry->second.ScanIndex = m_ScanIndex;
+                    }
+
+                    complete &= !ec;
+                }
+
+                // A failed scan may have missed files that still exist; keep them until the next one
+                if (complete)
+                {
+                    std::erase_if(m_Files, [this](const auto& file) { return file.second.ScanIndex != m_ScanIndex; });
+                }
+            }
+
+        private:
+            std::vector<std::string> m_Directories;
+            std::unordered_map<std::string, FileState> m_Files;
+            uint64 m_ScanIndex = 0;
+        };
+    }
+
+    std::unique_ptr<FileWatchBackend> FileWatchBackend::CreatePolling()
+    {
+        return std::make_unique<PollingFileWatchBackend>();
+    }
+
+#if !defined(NS_PLATFORM_WINDOWS) && !defined(__linux__)
+    std::unique_ptr<FileWatchBackend> FileWatchBackend::Create()
+    {
+        return CreatePolling();
+    }
+#endif
+}
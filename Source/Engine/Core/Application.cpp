@@ -2,11 +2,23 @@
 #include "Core/Application.h"
 #include "Core/Input.h"
 #include "Events/EventDispatcher.h"
+#include "Events/EventBus.h"
 #include "UI/ImGuiLayer.h"
 #include "Renderer/Renderer.h"
+#include "Renderer/Renderer2D.h"
+#include "Renderer/OrthographicCamera.h"
+#include "Renderer/ShaderCache.h"
+#include "Asset/AssetSystem.h"
+#include "Asset/AssetWatcher.h"
 
 namespace NanSu
 {
+    namespace
+    {
+        // ImGui needs a few frames after input to settle hover and animations
+        constexpr uint32 REDRAW_FRAMES_AFTER_EVENT = 3;
+    }
+
     Application* Application::s_Instance = nullptr;
 
     Application::Application()
@@ -16,11 +28,14 @@ namespace NanSu
 
         // Create the main window
         m_Window = std::unique_ptr<Window>(Window::Create());
-        m_Window->SetEventCallback(NS_BIND_EVENT_FN(Application::OnEvent));
+        m_Window->SetEventCallback(NS_BIND_EVENT_FN(Application::QueueWindowEvent));
 
         // Initialize input system
         Input::Initialize();
 
+        // Events enqueued on the bus are published once per frame by Run()
+        EventBus::Initialize();
+
         // Create and initialize graphics context
         m_GraphicsContext = std::unique_ptr<GraphicsContext>(
             GraphicsContext::Create(
@@ -35,6 +50,14 @@ namespace NanSu
             NS_ENGINE_CRITICAL("Failed to initialize graphics context!");
         }
 
+        // Asset sources and the shader cache must be ready before any shader/texture is loaded
+        AssetSystem::Initialize(ASSET_PACK_DEFAULT_PATH);
+        ShaderCache::Initialize(SHADER_CACHE_DEFAULT_DIRECTORY);
+
+#if NS_ENABLE_HOT_RELOAD
+        AssetWatcher::Initialize({ ASSET_DEFAULT_DIRECTORY });
+#endif
+
         // Initialize renderer
         Renderer::Init();
 
@@ -48,12 +71,21 @@ namespace NanSu
         // Shutdown renderer before graphics context
         Renderer::Shutdown();
 
+#if NS_ENABLE_HOT_RELOAD
+        AssetWatcher::Shutdown();
+#endif
+
+        // Release asset sources after all resources created from them are gone
+        ShaderCache::Shutdown();
+        AssetSystem::Shutdown();
+
         // Shutdown graphics context before window is destroyed
         if (m_GraphicsContext)
         {
             m_GraphicsContext->Shutdown();
         }
 
+        EventBus::Shutdown();
         Input::Shutdown();
         s_Instance = nullptr;
     }
@@ -62,10 +94,46 @@ namespace NanSu
     {
         NS_ENGINE_INFO("Application starting main loop");
 
+        m_FrameStart = Clock::now();
+
         while (m_Running)
         {
-            // Process window messages
-            m_Window->OnUpdate();
+            if (m_Replayer.IsReplaying())
+            {
+                // Recorded events replace live input; frames run back to back
+                m_Window->OnUpdate();
+                FlushWindowEvents();
+                if (!ReplayFrame())
+                {
+                    break;
+                }
+            }
+            else if (m_PowerSaving)
+            {
+                // Sleep until an event, a redraw request or the idle frame
+                WaitForRedraw();
+            }
+            else
+            {
+                // Process window messages
+                m_Window->OnUpdate();
+                FlushWindowEvents();
+            }
+
+            // Events enqueued since the last frame, after this frame's window events
+            EventBus::DispatchQueued();
+
+            // At most one swap-chain resize per frame, however long the drag
+            ApplyPendingResize();
+
+            // Input seen by all layers this frame
+            Input::BeginFrame();
+            UpdateTimestep();
+
+#if NS_ENABLE_HOT_RELOAD
+            // Swap changed shaders/textures between frames, never mid-frame
+            AssetWatcher::ProcessPendingReloads();
+#endif
 
             // Skip update logic if minimized
             if (!m_Minimized)
@@ -78,6 +146,11 @@ namespace NanSu
                 for (Layer* layer : m_LayerStack)
                 {
                     layer->OnUpdate();
+
+                    if (layer->IsCached())
+                    {
+                        CompositeCachedLayer(*layer);
+                    }
                 }
 
                 // ImGui render pass
@@ -90,9 +163,13 @@ namespace NanSu
 
                 // Present the frame
                 m_GraphicsContext->SwapBuffers();
+
+                m_LastFrameTime = Clock::now();
+                ++m_FrameCount;
             }
         }
 
+        m_Recorder.Stop();
         NS_ENGINE_INFO("Application exiting main loop");
     }
 
@@ -106,19 +183,222 @@ namespace NanSu
         m_LayerStack.PushOverlay(overlay);
     }
 
+    void Application::SetPowerSaving(bool enabled)
+    {
+        m_PowerSaving = enabled;
+        RequestRedraw();
+    }
+
+    void Application::RequestRedraw()
+    {
+        m_PendingRedraws = std::max(m_PendingRedraws, 1u);
+    }
+
+    void Application::RequestRedraw(float64 delaySeconds)
+    {
+        if (delaySeconds <= 0.0)
+        {
+            RequestRedraw();
+            return;
+        }
+
+        Clock::time_point wakeTime = Clock::now() +
+            std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float64>(delaySeconds));
+        m_WakeTime = std::min(m_WakeTime, wakeTime);
+    }
+
+    void Application::WaitForRedraw()
+    {
+        // Messages queued since the last frame are handled without blocking
+        m_Window->OnUpdate();
+        FlushWindowEvents();
+
+        while (m_Running && m_PendingRedraws == 0)
+        {
+            Clock::time_point now = Clock::now();
+
+            // Minimized windows render nothing, so the idle frame is not due
+            // (m_LastFrameTime stops advancing and would never block again)
+            Clock::time_point deadline = m_WakeTime;
+            if (m_IdleFrameRate > 0.0f && !m_Minimized)
+            {
+                Clock::time_point idleFrame = m_LastFrameTime +
+                    std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float64>(1.0 / m_IdleFrameRate));
+                deadline = std::min(deadline, idleFrame);
+            }
+
+            if (now >= deadline)
+            {
+                break;
+            }
+
+            // Any event received here requests redraws through OnEvent()
+            float64 timeout = deadline == Clock::time_point::max()
+                ? -1.0
+                : std::chrono::duration<float64>(deadline - now).count();
+            m_Window->WaitEvents(timeout);
+            FlushWindowEvents();
+        }
+
+        if (m_PendingRedraws > 0)
+        {
+            --m_PendingRedraws;
+        }
+
+        if (Clock::now() >= m_WakeTime)
+        {
+            m_WakeTime = Clock::time_point::max();
+        }
+    }
+
+    bool Application::StartRecording(const std::string& path)
+    {
+        if (m_Replayer.IsReplaying())
+        {
+            NS_ENGINE_ERROR("Cannot record events while a replay is running");
+            return false;
+        }
+
+        return m_Recorder.Start(path);
+    }
+
+    void Application::StopRecording()
+    {
+        m_Recorder.Stop();
+    }
+
+    bool Application::StartReplay(const std::string& path)
+    {
+        if (m_Recorder.IsRecording())
+        {
+            NS_ENGINE_ERROR("Cannot replay events while recording");
+            return false;
+        }
+
+        if (!m_Replayer.Open(path))
+        {
+            return false;
+        }
+
+        m_ReplayStart = Clock::now();
+        m_ReplayDiverged = false;
+        return true;
+    }
+
+    bool Application::ReplayFrame()
+    {
+        if (m_Replayer.NextFrame(NS_BIND_EVENT_FN(Application::DispatchEvent)))
+        {
+            return true;
+        }
+
+        float64 seconds = std::chrono::duration<float64>(Clock::now() - m_ReplayStart).count();
+        uint64 frames = m_Replayer.GetFrameCount();
+        NS_ENGINE_INFO("Replay finished: {} frames in {:.3f} s ({:.3f} ms/frame)",
+                       frames, seconds, frames > 0 ? seconds * 1000.0 / static_cast<float64>(frames) : 0.0);
+
+        m_Replayer.Close();
+        m_Running = false;
+        return false;
+    }
+
+    void Application::UpdateTimestep()
+    {
+        Clock::time_point now = Clock::now();
+        m_Timestep = std::min(std::chrono::duration<float64>(now - m_FrameStart).count(), MAX_TIMESTEP);
+        m_FrameStart = now;
+
+        // A replay started during this frame takes over from its first replayed frame
+        if (m_Replayer.IsReplaying() && m_Replayer.HasCurrentFrame())
+        {
+            m_Timestep = m_Replayer.GetTimestep();
+
+            // A mismatch means the input path changed since the recording
+            if (!m_ReplayDiverged && Input::GetState().ComputeHash() != m_Replayer.GetInputHash())
+            {
+                NS_ENGINE_WARN("Replay input diverged from the recording at frame {}", m_Replayer.GetFrameIndex() - 1);
+                m_ReplayDiverged = true;
+            }
+        }
+        else if (m_Recorder.IsRecording())
+        {
+            m_Recorder.EndFrame(m_Timestep, Input::GetState().ComputeHash());
+        }
+    }
+
     void Application::OnEvent(Event& event)
     {
+        if (m_Replayer.IsReplaying())
+        {
+            // Live input would make the run differ from the recording
+            if (event.GetEventType() != EventType::WindowClose)
+            {
+                return;
+            }
+        }
+        else
+        {
+            m_Recorder.Record(event);
+        }
+
+        DispatchEvent(event);
+    }
+
+    void Application::QueueWindowEvent(Event& event)
+    {
+        if (!m_EventCoalescer.Push(event))
+        {
+            OnEvent(event);
+        }
+    }
+
+    void Application::FlushWindowEvents()
+    {
+        m_EventCoalescer.Flush(NS_BIND_EVENT_FN(Application::OnEvent));
+    }
+
+    void Application::ApplyPendingResize()
+    {
+        if (!m_ResizePending)
+        {
+            return;
+        }
+
+        m_ResizePending = false;
+        m_GraphicsContext->OnResize(m_PendingWidth, m_PendingHeight);
+        Renderer::OnWindowResize(m_PendingWidth, m_PendingHeight);
+    }
+
+    void Application::DispatchEvent(Event& event)
+    {
+        // The input snapshot sees every event, even those layers handle
+        Input::OnEvent(event);
+
+        // Input and window changes may change what is on screen
+        m_PendingRedraws = std::max(m_PendingRedraws, REDRAW_FRAMES_AFTER_EVENT);
+
         EventDispatcher dispatcher(event);
         dispatcher.Dispatch<WindowCloseEvent>(NS_BIND_EVENT_FN(Application::OnWindowClose));
         dispatcher.Dispatch<WindowResizeEvent>(NS_BIND_EVENT_FN(Application::OnWindowResize));
 
-        // Propagate events to layers in reverse order (overlays first)
-        for (auto it = m_LayerStack.rbegin(); it != m_LayerStack.rend(); ++it)
+        // Propagate events to subscribed layers in reverse order (overlays first)
+        m_LayerStack.DispatchEvent(event);
+    }
+
+    void Application::CompositeCachedLayer(Layer& layer)
+    {
+        Texture2D* image = layer.UpdateCache(m_Window->GetWidth(), m_Window->GetHeight());
+        if (!image)
         {
-            if (event.IsHandled())
-                break;
-            (*it)->OnEvent(event);
+            return;
         }
+
+        // Full-screen quad in clip space; the cache holds premultiplied color
+        OrthographicCamera clipSpace(-1.0f, 1.0f, -1.0f, 1.0f);
+        Renderer2D::BeginScene(clipSpace);
+        Renderer2D::SetBlendMode(BlendMode::Premultiplied);
+        Renderer2D::DrawQuad({ 0.0f, 0.0f }, { 2.0f, 2.0f }, image);
+        Renderer2D::EndScene();
     }
 
     bool Application::OnWindowClose(WindowCloseEvent& event)
@@ -136,9 +416,11 @@ namespace NanSu
             return false;
         }
 
+        // Recreating swap-chain buffers is expensive; done once at the next frame start
         m_Minimized = false;
-        m_GraphicsContext->OnResize(event.GetWidth(), event.GetHeight());
-        Renderer::OnWindowResize(event.GetWidth(), event.GetHeight());
+        m_ResizePending = true;
+        m_PendingWidth = event.GetWidth();
+        m_PendingHeight = event.GetHeight();
         return false;
     }
 }
@@ -6,6 +6,9 @@
 #include "Renderer/GraphicsContext.h"
 #include "Events/Event.h"
 #include "Events/WindowEvent.h"
+#include "Events/EventRecorder.h"
+#include "Events/EventCoalescer.h"
+#include <chrono>
 #include <memory>
 
 namespace NanSu
@@ -35,6 +38,10 @@ namespace NanSu
         /**
          * @brief Handle incoming events from the window
          * @param event The event to process
+         *
+         * Window events arrive here once per pump, after runs of mouse moves,
+         * scrolls and resizes were merged by the EventCoalescer. Recorded
+         * while recording; ignored during a replay except WindowClose.
          */
         void OnEvent(Event& event);
 
@@ -60,12 +67,132 @@ namespace NanSu
          */
         GraphicsContext& GetGraphicsContext() { return *m_GraphicsContext; }
 
+        // =====================================================================
+        // Power Saving
+        // =====================================================================
+
+        /**
+         * @brief Only render frames when something changed
+         *
+         * While enabled, the main loop sleeps in Window::WaitEvents() until a
+         * window event arrives, a redraw is requested, a scheduled wake-up is
+         * due or the idle frame interval elapses. Layers that animate call
+         * RequestRedraw() every frame they want to keep running.
+         */
+        void SetPowerSaving(bool enabled);
+        bool IsPowerSaving() const { return m_PowerSaving; }
+
+        /**
+         * @brief Frames per second rendered while idle (0 = only on events and requests)
+         */
+        void SetIdleFrameRate(float32 framesPerSecond) { m_IdleFrameRate = framesPerSecond; }
+        float32 GetIdleFrameRate() const { return m_IdleFrameRate; }
+
+        /**
+         * @brief Render the next frame even if no event arrives
+         */
+        void RequestRedraw();
+
+        /**
+         * @brief Render a frame after a delay (animation wake-up)
+         * @param delaySeconds Time from now; the earliest pending wake-up wins
+         */
+        void RequestRedraw(float64 delaySeconds);
+
+        /**
+         * @brief Number of frames rendered since startup
+         */
+        uint64 GetFrameCount() const { return m_FrameCount; }
+
+        // =====================================================================
+        // Timing
+        // =====================================================================
+
+        /**
+         * @brief Seconds simulated by the current frame
+         *
+         * Measured between the starts of consecutive frames and clamped to
+         * MAX_TIMESTEP (e.g. after a debugger break). During a replay this is
+         * the recorded timestep, so simulations advance exactly as recorded.
+         */
+        float64 GetTimestep() const { return m_Timestep; }
+
+        // =====================================================================
+        // Recording & Replay
+        // =====================================================================
+
+        /**
+         * @brief Record every window event and frame timestep to an event log
+         * @return false if the log could not be created or a replay is running
+         */
+        bool StartRecording(const std::string& path);
+        void StopRecording();
+        bool IsRecording() const { return m_Recorder.IsRecording(); }
+        uint64 GetRecordedFrameCount() const { return m_Recorder.GetFrameCount(); }
+
+        /**
+         * @brief Drive the following frames from an event log instead of live input
+         *
+         * Each main loop iteration dispatches one recorded frame of events
+         * and uses its recorded timestep; live window input is ignored except
+         * for closing the window. Power saving is bypassed so frames run back
+         * to back, and the application exits after the last frame, logging
+         * the wall time of the run as a benchmark result. May be called from
+         * an event handler; the current frame finishes with live timing and
+         * the first recorded frame runs on the next iteration.
+         *
+         * @return false if the log could not be loaded or a recording is running
+         */
+        bool StartReplay(const std::string& path);
+        bool IsReplaying() const { return m_Replayer.IsReplaying(); }
+
         /**
          * @brief Get the singleton application instance
          */
         static Application& Get() { return *s_Instance; }
 
     private:
+        /**
+         * @brief Redraw a cached layer if dirty and draw its image over the frame
+         */
+        void CompositeCachedLayer(Layer& layer);
+
+        /**
+         * @brief Sleep in the window until the next frame should be rendered
+         */
+        void WaitForRedraw();
+
+        /**
+         * @brief Window event callback; buffers the event until the next flush
+         */
+        void QueueWindowEvent(Event& event);
+
+        /**
+         * @brief Deliver the window events buffered since the last flush
+         */
+        void FlushWindowEvents();
+
+        /**
+         * @brief Resize the swap chain and viewport to the last size seen this frame
+         */
+        void ApplyPendingResize();
+
+        /**
+         * @brief Deliver an event to the input snapshot, the application and the layers
+         */
+        void DispatchEvent(Event& event);
+
+        /**
+         * @brief Dispatch the next recorded frame's events
+         * @return false once the replay finished
+         */
+        bool ReplayFrame();
+
+        /**
+         * @brief Measure (or replay) the timestep and record the finished frame input
+         */
+        void UpdateTimestep();
+
         bool OnWindowClose(WindowCloseEvent& event);
         bool OnWindowResize(WindowResizeEvent& event);
 
@@ -77,6 +204,35 @@ namespace NanSu
         bool m_Running = true;
         bool m_Minimized = false;
 
+        // Window events (merged per pump; swap-chain resize deferred to the frame start)
+        EventCoalescer m_EventCoalescer;
+        bool m_ResizePending = false;
+        uint32 m_PendingWidth = 0;
+        uint32 m_PendingHeight = 0;
+
+        // Power saving
+        using Clock = std::chrono::steady_clock;
+        static constexpr float32 DEFAULT_IDLE_FRAME_RATE = 4.0f;
+
+        bool m_PowerSaving = false;
+        float32 m_IdleFrameRate = DEFAULT_IDLE_FRAME_RATE;
+        uint32 m_PendingRedraws = 0;
+        Clock::time_point m_LastFrameTime;
+        Clock::time_point m_WakeTime = Clock::time_point::max();
+        uint64 m_FrameCount = 0;
+
+        // Timing
+        static constexpr float64 MAX_TIMESTEP = 0.25;
+
+        Clock::time_point m_FrameStart;
+        float64 m_Timestep = 0.0;
+
+        // Recording & replay
+        EventRecorder m_Recorder;
+        EventReplayer m_Replayer;
+        Clock::time_point m_ReplayStart;
+        bool m_ReplayDiverged = false;
+
         static Application* s_Instance;
     };
 
@@ -3,7 +3,7 @@
 #include "Core/Application.h"
 #include "Core/Logger.h"
 
-#ifdef NS_PLATFORM_WINDOWS
+#include <string_view>
 
 /**
  * @brief Entry point for NanSu Engine applications
@@ -13,22 +13,37 @@
  *
  * The client must define:
  *   NanSu::Application* NanSu::CreateApplication();
+ *
+ * Command line:
+ *   --record <file>   Record window events and frame timesteps to an event log
+ *   --replay <file>   Replay an event log frame by frame, then exit
  */
 
 extern NanSu::Application* NanSu::CreateApplication();
 
 int main(int argc, char** argv)
 {
-    // Suppress unused parameter warnings
-    (void)argc;
-    (void)argv;
-
     // Initialize core systems
     NanSu::Logger::Initialize();
     NS_ENGINE_INFO("=== NanSu Engine Starting ===");
 
     // Create and run the application
     NanSu::Application* app = NanSu::CreateApplication();
+
+    // --record <file>: capture the session's events, --replay <file>: play one back
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        std::string_view arg = argv[i];
+        if (arg == "--record")
+        {
+            app->StartRecording(argv[++i]);
+        }
+        else if (arg == "--replay")
+        {
+            app->StartReplay(argv[++i]);
+        }
+    }
+
     app->Run();
     delete app;
 
@@ -38,5 +53,3 @@ int main(int argc, char** argv)
 
     return 0;
 }
-
-#endif // NS_PLATFORM_WINDOWS
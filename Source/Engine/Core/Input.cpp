@@ -4,6 +4,7 @@
 namespace NanSu
 {
     std::unique_ptr<Input> Input::s_Instance = nullptr;
+    InputState Input::s_State;
 
     bool Input::IsKeyPressed(KeyCode key)
     {
@@ -3,6 +3,7 @@
 #include "Core/Types.h"
 #include "Input/KeyCodes.h"
 #include "Input/MouseCodes.h"
+#include "Input/InputState.h"
 #include <utility>
 #include <memory>
 
@@ -14,8 +15,12 @@ namespace NanSu
      * Provides static methods for polling keyboard and mouse state.
      * Platform-specific implementations are created via Input::Initialize().
      *
+     * GetState() returns the per-frame snapshot built from window events,
+     * which is consistent across layers and costs a bit test per query.
+     * The IsKeyPressed() family asks the OS directly on every call.
+     *
      * Usage:
-     *   if (Input::IsKeyPressed(KeyCode::W))
+     *   if (Input::GetState().IsKeyDown(KeyCode::W))
      *       MoveForward();
      *
      *   auto [mouseX, mouseY] = Input::GetMousePosition();
@@ -30,7 +35,22 @@ namespace NanSu
         Input& operator=(const Input&) = delete;
 
         /**
-         * @brief Check if a key is currently pressed
+         * @brief Get this frame's keyboard and mouse snapshot
+         */
+        static const InputState& GetState() { return s_State; }
+
+        /**
+         * @brief Feed a window event into the pending snapshot (called by the Application)
+         */
+        static void OnEvent(const Event& event) { s_State.OnEvent(event); }
+
+        /**
+         * @brief Publish the pending snapshot for the new frame (called by the Application)
+         */
+        static void BeginFrame() { s_State.BeginFrame(); }
+
+        /**
+         * @brief Check if a key is currently pressed (queries the OS)
          * @param key The key code to check
          * @return true if the key is pressed, false otherwise
          */
@@ -82,5 +102,6 @@ namespace NanSu
 
     private:
         static std::unique_ptr<Input> s_Instance;
+        static InputState s_State;
     };
 }
@@ -1,5 +1,8 @@
 #include "EnginePCH.h"
 #include "Core/Layer.h"
+#include "Core/Application.h"
+#include "Core/LayerStack.h"
+#include "Renderer/Framebuffer.h"
 
 namespace NanSu
 {
@@ -7,4 +10,85 @@ namespace NanSu
         : m_DebugName(name)
     {
     }
+
+    Layer::~Layer() = default;
+
+    void Layer::RequestRedraw(float64 delaySeconds)
+    {
+        Application::Get().RequestRedraw(delaySeconds);
+    }
+
+    void Layer::SetEventInterest(EventTypeMask mask)
+    {
+        m_OnEventInterest = mask;
+        m_InterestDeclared = true;
+        OnEventRoutesChanged();
+    }
+
+    EventTypeMask Layer::GetEventInterest() const
+    {
+        EventTypeMask mask = m_OnEventInterest;
+        for (uint32 type = 0; type < EVENT_TYPE_COUNT; ++type)
+        {
+            if (m_EventHandlers[type])
+            {
+                mask.Add(static_cast<EventType>(type));
+            }
+        }
+        return mask;
+    }
+
+    void Layer::OnEventRoutesChanged()
+    {
+        if (m_Stack)
+        {
+            m_Stack->InvalidateEventRoutes();
+        }
+    }
+
+    void Layer::SetCached(bool cached)
+    {
+        m_Cached = cached;
+        m_Dirty = true;
+
+        if (!cached)
+        {
+            m_Cache.reset();
+        }
+    }
+
+    Texture2D* Layer::UpdateCache(uint32 width, uint32 height)
+    {
+        if (!m_Cached)
+        {
+            return nullptr;
+        }
+
+        // Created on first use so uncached layers never allocate a target
+        if (!m_Cache)
+        {
+            m_Cache.reset(Framebuffer::Create({ width, height, { FramebufferFormat::RGBA8 } }));
+            m_Dirty = true;
+        }
+        else if (m_Cache->GetSpecification().Width != width || m_Cache->GetSpecification().Height != height)
+        {
+            m_Cache->Resize(width, height);
+            m_Dirty = true;
+        }
+
+        if (IsDirty())
+        {
+            // Cleared first so a MarkDirty() from OnRender() requests another render
+            m_Dirty = false;
+
+            m_Cache->Bind();
+            m_Cache->Clear(vec4(0.0f));
+            OnRender();
+            m_Cache->Unbind();
+
+            ++m_CacheRenderCount;
+        }
+
+        return m_Cache->GetColorAttachment();
+    }
 }
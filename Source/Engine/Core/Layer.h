@@ -2,10 +2,31 @@
 
 #include "Core/Types.h"
 #include "Events/Event.h"
+#include "Events/EventRegistry.h"
+#include <array>
+#include <memory>
 #include <string>
 
 namespace NanSu
 {
+    // Forward declarations
+    class Framebuffer;
+    class Texture2D;
+    class LayerStack;
+
+    template<typename F>
+    struct LayerEventHandlerTraits;
+
+    /**
+     * @brief Signature of a layer event handler: bool (LayerClass::*)(EventClass&)
+     */
+    template<typename L, typename T>
+    struct LayerEventHandlerTraits<bool (L::*)(T&)>
+    {
+        using LayerClass = L;
+        using EventClass = T;
+    };
+
     /**
      * @brief Base class for application layers
      *
@@ -15,6 +36,38 @@ namespace NanSu
      *
      * Update order: bottom to top (game world -> UI)
      * Event order: top to bottom (UI -> game world, UI can consume events)
+     *
+     * Layers only receive the event types they are interested in: by
+     * default every type goes to OnEvent(); SetEventInterest() narrows that
+     * and Subscribe() routes a type straight to a typed member handler. The
+     * LayerStack keeps one subscriber list per EventType, so layers that
+     * ignore an event cost nothing when it is dispatched.
+     *
+     * Cached layers (opt-in, see SetCached()) draw in OnRender() into their
+     * own window-sized framebuffer instead of drawing in OnUpdate(). The
+     * Application only calls OnRender() while the layer is dirty and
+     * otherwise composites the cached image as a single textured quad, so a
+     * layer whose content rarely changes (HUDs, static panels) costs one
+     * draw per frame. Compositing goes through Renderer2D, which must be
+     * initialized while cached layers are on the stack.
+     *
+     * Example usage:
+     * @code
+     * class HudLayer : public Layer
+     * {
+     * public:
+     *     HudLayer() : Layer("HUD") { SetCached(true); }
+     *
+     *     void OnUpdate() override { if (ScoreChanged()) MarkDirty(); }
+     *
+     *     void OnRender() override
+     *     {
+     *         Renderer2D::BeginScene(m_Camera);
+     *         // ... draw the HUD ...
+     *         Renderer2D::EndScene();
+     *     }
+     * };
+     * @endcode
      */
     class Layer
     {
@@ -24,7 +77,7 @@ namespace NanSu
          * @param name Debug name for identification (default: "Layer")
          */
         explicit Layer(const std::string& name = "Layer");
-        virtual ~Layer() = default;
+        virtual ~Layer();
 
         /**
          * @brief Called when the layer is pushed onto the stack
@@ -44,12 +97,20 @@ namespace NanSu
          */
         virtual void OnUpdate() {}
 
+        /**
+         * @brief Called to redraw a cached layer into its framebuffer
+         * Only called for cached layers, after OnUpdate() and only while dirty.
+         * The framebuffer is bound and cleared to transparent black.
+         */
+        virtual void OnRender() {}
+
         /**
          * @brief Called when an event is propagated to this layer
          * @param event The event to handle
          *
          * Events are propagated top to bottom (overlays first).
-         * Set event.SetHandled(true) to stop propagation.
+         * Set event.SetHandled(true) to stop propagation. Only receives the
+         * types of SetEventInterest() that have no Subscribe() handler.
          */
         virtual void OnEvent(Event& event) {}
 
@@ -66,7 +127,147 @@ namespace NanSu
          */
         const std::string& GetName() const { return m_DebugName; }
 
+        /**
+         * @brief Ask the Application to render another frame (power-saving mode)
+         * @param delaySeconds 0 = next frame, otherwise a wake-up after the delay
+         */
+        void RequestRedraw(float64 delaySeconds = 0.0);
+
+        // =====================================================================
+        // Event Routing
+        // =====================================================================
+
+        /**
+         * @brief Route one event type to a member handler
+         * @tparam Handler bool (LayerClass::*)(EventClass&), returning true when handled
+         *
+         * The handler goes into this layer's jump table slot for the event
+         * type, bypassing OnEvent(). Unless SetEventInterest() was called,
+         * the first subscription also stops routing other types to OnEvent().
+         *
+         * @code
+         * MyLayer() : Layer("MyLayer") { Subscribe<&MyLayer::OnWindowResize>(); }
+         * bool OnWindowResize(WindowResizeEvent& event);
+         * @endcode
+         */
+        template<auto Handler>
+        void Subscribe()
+        {
+            using Traits = LayerEventHandlerTraits<decltype(Handler)>;
+            using EventClass = typename Traits::EventClass;
+            static_assert(std::is_base_of_v<Layer, typename Traits::LayerClass>, "Handler must be a member of a Layer");
+            static_assert(IsRegisteredEvent<EventClass>, "Event class is not listed in EngineEventTypes");
+
+            if (!m_InterestDeclared)
+            {
+                m_OnEventInterest = EventTypeMask::None();
+                m_InterestDeclared = true;
+            }
+
+            m_EventHandlers[static_cast<uint32>(EventClass::GetStaticType())] = &InvokeEventHandler<Handler>;
+            OnEventRoutesChanged();
+        }
+
+        /**
+         * @brief Remove the Subscribe() handler of an event type
+         */
+        template<typename T>
+        void Unsubscribe()
+        {
+            m_EventHandlers[static_cast<uint32>(T::GetStaticType())] = nullptr;
+            OnEventRoutesChanged();
+        }
+
+        /**
+         * @brief Event types delivered to OnEvent() (all by default)
+         */
+        void SetEventInterest(EventTypeMask mask);
+
+        /**
+         * @brief Every event type this layer receives (OnEvent() interest and subscriptions)
+         */
+        EventTypeMask GetEventInterest() const;
+
+        // =====================================================================
+        // Cached Rendering
+        // =====================================================================
+
+        /**
+         * @brief Enable or disable cached rendering (disabled by default)
+         * Disabling releases the framebuffer.
+         */
+        void SetCached(bool cached);
+        bool IsCached() const { return m_Cached; }
+
+        /**
+         * @brief Request an OnRender() call on the next frame
+         */
+        void MarkDirty() { m_Dirty = true; }
+
+        /**
+         * @brief Check whether the cached image is out of date
+         * Override to derive dirtiness from the layer's own state.
+         */
+        virtual bool IsDirty() const { return m_Dirty; }
+
+        /**
+         * @brief Bring the cached image up to date
+         * @param width Target width in pixels (the window size)
+         * @param height Target height in pixels
+         * @return The cached image, or nullptr if the layer is not cached
+         *
+         * Resizing the target marks the layer dirty. Called by the Application.
+         */
+        Texture2D* UpdateCache(uint32 width, uint32 height);
+
+        /**
+         * @brief Number of times the cached image was redrawn
+         */
+        uint64 GetCacheRenderCount() const { return m_CacheRenderCount; }
+
     protected:
         std::string m_DebugName;
+
+    private:
+        friend class LayerStack;
+
+        using EventHandlerThunk = bool (*)(Layer&, Event&);
+
+        template<auto Handler>
+        static bool InvokeEventHandler(Layer& layer, Event& event)
+        {
+            using Traits = LayerEventHandlerTraits<decltype(Handler)>;
+            return (static_cast<typename Traits::LayerClass&>(layer).*Handler)(static_cast<typename Traits::EventClass&>(event));
+        }
+
+        /**
+         * @brief Deliver an event through its jump table slot, or OnEvent()
+         */
+        void HandleEvent(Event& event, EventType type)
+        {
+            EventHandlerThunk handler = m_EventHandlers[static_cast<uint32>(type)];
+            if (!handler)
+            {
+                OnEvent(event);
+            }
+            else if (handler(*this, event))
+            {
+                event.SetHandled(true);
+            }
+        }
+
+        void OnEventRoutesChanged();
+
+    private:
+        // Event routing
+        std::array<EventHandlerThunk, EVENT_TYPE_COUNT> m_EventHandlers = {};
+        EventTypeMask m_OnEventInterest = EventTypeMask::All();
+        bool m_InterestDeclared = false;
+        LayerStack* m_Stack = nullptr;
+
+        std::unique_ptr<Framebuffer> m_Cache;
+        uint64 m_CacheRenderCount = 0;
+        bool m_Cached = false;
+        bool m_Dirty = true;
     };
 }
@@ -16,6 +16,8 @@ namespace NanSu
     {
         m_Layers.emplace(m_Layers.begin() + m_LayerInsertIndex, layer);
         m_LayerInsertIndex++;
+        layer->m_Stack = this;
+        InvalidateEventRoutes();
         layer->OnAttach();
     }
 
@@ -27,12 +29,16 @@ namespace NanSu
             layer->OnDetach();
             m_Layers.erase(it);
             m_LayerInsertIndex--;
+            layer->m_Stack = nullptr;
+            InvalidateEventRoutes();
         }
     }
 
     void LayerStack::PushOverlay(Layer* overlay)
     {
         m_Layers.emplace_back(overlay);
+        overlay->m_Stack = this;
+        InvalidateEventRoutes();
         overlay->OnAttach();
     }
 
@@ -43,6 +49,52 @@ namespace NanSu
         {
             overlay->OnDetach();
             m_Layers.erase(it);
+            overlay->m_Stack = nullptr;
+            InvalidateEventRoutes();
         }
     }
+
+    void LayerStack::DispatchEvent(Event& event)
+    {
+        EventType type = event.GetEventType();
+        const std::vector<Layer*>& subscribers = GetEventSubscribers(type);
+
+        // Index loop: a handler may change routes, which only rebuilds on the next dispatch
+        for (usize i = 0; i < subscribers.size() && !event.IsHandled(); ++i)
+        {
+            subscribers[i]->HandleEvent(event, type);
+        }
+    }
+
+    const std::vector<Layer*>& LayerStack::GetEventSubscribers(EventType type)
+    {
+        if (m_EventRoutesDirty)
+        {
+            RebuildEventRoutes();
+        }
+
+        return m_EventRoutes[static_cast<uint32>(type)];
+    }
+
+    void LayerStack::RebuildEventRoutes()
+    {
+        for (auto& route : m_EventRoutes)
+        {
+            route.clear();
+        }
+
+        for (auto it = m_Layers.rbegin(); it != m_Layers.rend(); ++it)
+        {
+            EventTypeMask interest = (*it)->GetEventInterest();
+            for (uint32 type = 0; type < EVENT_TYPE_COUNT; ++type)
+            {
+                if (interest.Contains(static_cast<EventType>(type)))
+                {
+                    m_EventRoutes[type].push_back(*it);
+                }
+            }
+        }
+
+        m_EventRoutesDirty = false;
+    }
 }
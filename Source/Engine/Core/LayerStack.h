@@ -2,6 +2,7 @@
 
 #include "Core/Types.h"
 #include "Core/Layer.h"
+#include <array>
 #include <vector>
 
 namespace NanSu
@@ -20,6 +21,10 @@ namespace NanSu
      *
      * Update order: bottom to top (Layer0 first, OverlayN last)
      * Event order: top to bottom (OverlayN first, Layer0 last)
+     *
+     * Events are routed through one subscriber list per EventType, built
+     * from each layer's event interest and rebuilt lazily after a layer was
+     * pushed, popped or changed its interest.
      */
     class LayerStack
     {
@@ -59,6 +64,21 @@ namespace NanSu
          */
         void PopOverlay(Layer* overlay);
 
+        /**
+         * @brief Deliver an event to the subscribed layers, top to bottom, until handled
+         */
+        void DispatchEvent(Event& event);
+
+        /**
+         * @brief Layers receiving an event type, in event order (top to bottom)
+         */
+        const std::vector<Layer*>& GetEventSubscribers(EventType type);
+
+        /**
+         * @brief Rebuild the subscriber lists before the next dispatch
+         */
+        void InvalidateEventRoutes() { m_EventRoutesDirty = true; }
+
         // Iterator support for forward traversal (update order)
         std::vector<Layer*>::iterator begin() { return m_Layers.begin(); }
         std::vector<Layer*>::iterator end() { return m_Layers.end(); }
@@ -71,8 +91,14 @@ namespace NanSu
         std::vector<Layer*>::const_reverse_iterator rbegin() const { return m_Layers.rbegin(); }
         std::vector<Layer*>::const_reverse_iterator rend() const { return m_Layers.rend(); }
 
+    private:
+        void RebuildEventRoutes();
+
     private:
         std::vector<Layer*> m_Layers;
         usize m_LayerInsertIndex = 0;
+
+        std::array<std::vector<Layer*>, EVENT_TYPE_COUNT> m_EventRoutes;
+        bool m_EventRoutesDirty = true;
     };
 }
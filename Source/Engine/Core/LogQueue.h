@@ -0,0 +1,245 @@
+#pragma once
+
+#include "Core/Types.h"
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include "spdlog/spdlog.h"
+
+namespace NanSu
+{
+    // =========================================================================
+    // Log Records
+    // =========================================================================
+    //
+    // Records written by the async logger into a thread's LogQueue. A
+    // Deferred record stores the format string pointer and the raw argument
+    // bytes; the backend thread rebuilds the arguments and formats them.
+    // Arguments that cannot be stored raw make the call site format the
+    // message itself and write a Message record holding the text.
+    //
+    // Argument encoding (in order, unaligned):
+    //   arithmetic, void*   raw bytes
+    //   IsRawLoggable<T>    raw bytes
+    //   strings             uint32 length + characters
+    // =========================================================================
+
+    enum class LogRecordKind : uint8
+    {
+        Padding = 0,        // Unused space before the queue wraps
+        Message,            // Payload is the formatted text
+        Deferred            // Payload is the encoded arguments of Format
+    };
+
+    using LogFormatFn = void (*)(std::string_view format, const std::byte* payload, spdlog::memory_buf_t& out);
+
+    /**
+     * @brief Header of every record; Size and Kind are valid for padding too
+     */
+    struct LogRecordHeader
+    {
+        uint32 Size = 0;                // Bytes including header, multiple of 8
+        LogRecordKind Kind = LogRecordKind::Padding;
+        uint8 Target = 0;               // Logger::Target
+        uint8 Level = 0;                // spdlog::level::level_enum
+        uint8 Reserved = 0;
+        uint32 FormatSize = 0;
+        uint32 PayloadSize = 0;
+        const char* Format = nullptr;   // Static storage (compile-time format string)
+        LogFormatFn FormatArgs = nullptr;
+        spdlog::log_clock::time_point Time;
+
+        const std::byte* GetPayload() const { return reinterpret_cast<const std::byte*>(this + 1); }
+    };
+
+    // =========================================================================
+    // LogQueue
+    // =========================================================================
+
+    /**
+     * @brief Lock-free single-producer single-consumer ring of log records
+     *
+     * Each thread that logs in async mode owns one queue; the logger backend
+     * thread is the only consumer. Records never straddle the end of the
+     * buffer: a padding record fills the rest and the next one starts at 0.
+     */
+    class LogQueue
+    {
+    public:
+        /**
+         * @param capacity Buffer size in bytes (rounded up to a power of two)
+         */
+        explicit LogQueue(usize capacity);
+
+        LogQueue(const LogQueue&) = delete;
+        LogQueue& operator=(const LogQueue&) = delete;
+
+        // Producer ---------------------------------------------------------
+
+        /**
+         * @brief Reserve a record of the given size (multiple of 8)
+         * @return nullptr if the queue is full
+         */
+        std::byte* Reserve(uint32 size);
+
+        /**
+         * @brief Publish the record returned by the last Reserve()
+         */
+        void Commit(uint32 size) { m_Head.store(m_Head.load(std::memory_order_relaxed) + size, std::memory_order_release); }
+
+        /**
+         * @brief Largest record Reserve() can ever satisfy
+         */
+        uint32 GetMaxRecordSize() const { return static_cast<uint32>(m_Capacity / 2); }
+
+        // Consumer ---------------------------------------------------------
+
+        /**
+         * @brief Oldest published record, or nullptr if the queue is empty
+         */
+        const LogRecordHeader* Peek();
+
+        /**
+         * @brief Release the record returned by Peek()
+         */
+        void Pop(const LogRecordHeader& record)
+        {
+            m_Tail.store(m_Tail.load(std::memory_order_relaxed) + record.Size, std::memory_order_release);
+        }
+
+        bool IsEmpty() const
+        {
+            return m_Head.load(std::memory_order_acquire) == m_Tail.load(std::memory_order_acquire);
+        }
+
+    private:
+        std::unique_ptr<std::byte[]> m_Buffer;
+        usize m_Capacity = 0;
+
+        alignas(64) std::atomic<uint64> m_Head = 0;     // Written by the producer
+        alignas(64) std::atomic<uint64> m_Tail = 0;     // Written by the consumer
+    };
+
+    // =========================================================================
+    // Argument Encoding
+    // =========================================================================
+
+    namespace LogDetail
+    {
+        template <typename T>
+        constexpr bool IsString = std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> ||
+                                  std::is_same_v<T, const char*> || std::is_same_v<T, char*> ||
+                                  (std::is_array_v<T> && std::is_same_v<std::remove_extent_t<T>, const char>) ||
+                                  (std::is_array_v<T> && std::is_same_v<std::remove_extent_t<T>, char>);
+
+        /**
+         * @brief Specialize to true for a trivially copyable type whose
+         * fmt::formatter may run later on the logger thread
+         */
+        template <typename T>
+        constexpr bool IsRawLoggable = false;
+
+        /**
+         * @brief Arguments the backend can rebuild from raw bytes
+         */
+        template <typename T>
+        constexpr bool IsDeferrable = std::is_arithmetic_v<T> || std::is_same_v<T, const void*> ||
+                                      std::is_same_v<T, void*> || IsString<T> ||
+                                      (IsRawLoggable<T> && std::is_trivially_copyable_v<T>);
+
+        template <typename T>
+        using DecodedArg = std::conditional_t<IsString<T>, std::string_view,
+                           std::conditional_t<std::is_pointer_v<T>, const void*, T>>;
+
+        template <typename T>
+        std::string_view AsString(const T& value)
+        {
+            if constexpr (std::is_pointer_v<T>)
+            {
+                return value ? std::string_view(value) : std::string_view();
+            }
+            else if constexpr (std::is_array_v<T>)
+            {
+                return std::string_view(value, std::char_traits<char>::length(value));
+            }
+            else
+            {
+                return std::string_view(value);
+            }
+        }
+
+        template <typename T>
+        usize EncodedSize(const T& value)
+        {
+            if constexpr (IsString<T>)
+            {
+                return sizeof(uint32) + AsString(value).size();
+            }
+            else
+            {
+                return sizeof(DecodedArg<T>);
+            }
+        }
+
+        template <typename T>
+        void Encode(std::byte*& cursor, const T& value)
+        {
+            if constexpr (IsString<T>)
+            {
+                std::string_view text = AsString(value);
+                uint32 length = static_cast<uint32>(text.size());
+                std::memcpy(cursor, &length, sizeof(length));
+                std::memcpy(cursor + sizeof(length), text.data(), length);
+                cursor += sizeof(length) + length;
+            }
+            else
+            {
+                DecodedArg<T> raw = value;
+                std::memcpy(cursor, &raw, sizeof(raw));
+                cursor += sizeof(raw);
+            }
+        }
+
+        template <typename T>
+        DecodedArg<T> Decode(const std::byte*& cursor)
+        {
+            if constexpr (IsString<T>)
+            {
+                uint32 length = 0;
+                std::memcpy(&length, cursor, sizeof(length));
+                std::string_view text(reinterpret_cast<const char*>(cursor + sizeof(length)), length);
+                cursor += sizeof(length) + length;
+                return text;
+            }
+            else
+            {
+                DecodedArg<T> raw;
+                std::memcpy(&raw, cursor, sizeof(raw));
+                cursor += sizeof(raw);
+                return raw;
+            }
+        }
+
+        /**
+         * @brief Backend side of a Deferred record: decode the arguments and format
+         */
+        template <typename... Args>
+        void FormatDeferred(std::string_view format, const std::byte* payload, spdlog::memory_buf_t& out)
+        {
+            const std::byte* cursor = payload;
+            std::tuple<DecodedArg<Args>...> values{ Decode<Args>(cursor)... };  // Braced init: decoded in order
+
+            std::apply([&](const auto&... decoded)
+            {
+                fmt::vformat_to(fmt::appender(out), fmt::string_view(format.data(), format.size()),
+                                fmt::make_format_args(decoded...));
+            }, values);
+        }
+    }
+
+} // namespace NanSu
@@ -1,36 +1,407 @@
 #include "EnginePCH.h"
+#include "spdlog/sinks/rotating_file_sink.h"
+
+#include <bit>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace NanSu
 {
     std::shared_ptr<spdlog::logger> Logger::s_EngineLogger;
     std::shared_ptr<spdlog::logger> Logger::s_ClientLogger;
+    bool Logger::s_Async = false;
+
+    // =========================================================================
+    // LogQueue
+    // =========================================================================
+
+    LogQueue::LogQueue(usize capacity)
+        : m_Capacity(std::bit_ceil(std::max<usize>(capacity, 4096)))
+    {
+        m_Buffer = std::make_unique<std::byte[]>(m_Capacity);
+    }
 
-    void Logger::Initialize()
+    std::byte* LogQueue::Reserve(uint32 size)
     {
+        uint64 head = m_Head.load(std::memory_order_relaxed);
+        uint64 tail = m_Tail.load(std::memory_order_acquire);
+
+        usize offset = static_cast<usize>(head & (m_Capacity - 1));
+        usize contiguous = m_Capacity - offset;
+        usize needed = size <= contiguous ? size : contiguous + size;
+        if (needed > m_Capacity - static_cast<usize>(head - tail))
+        {
+            return nullptr;
+        }
+
+        if (size > contiguous)
+        {
+            // Fill the end of the buffer; the record starts at offset 0
+            auto* padding = reinterpret_cast<LogRecordHeader*>(m_Buffer.get() + offset);
+            padding->Size = static_cast<uint32>(contiguous);
+            padding->Kind = LogRecordKind::Padding;
+            m_Head.store(head + contiguous, std::memory_order_release);
+            offset = 0;
+        }
+
+        return m_Buffer.get() + offset;
+    }
+
+    const LogRecordHeader* LogQueue::Peek()
+    {
+        while (true)
+        {
+            uint64 tail = m_Tail.load(std::memory_order_relaxed);
+            if (tail == m_Head.load(std::memory_order_acquire))
+            {
+                return nullptr;
+            }
+
+            const auto* record = reinterpret_cast<const LogRecordHeader*>(m_Buffer.get() + (tail & (m_Capacity - 1)));
+            if (record->Kind != LogRecordKind::Padding)
+            {
+                return record;
+            }
+
+            m_Tail.store(tail + record->Size, std::memory_order_release);
+        }
+    }
+
+    // =========================================================================
+    // Async Backend
+    // =========================================================================
+
+    namespace
+    {
+        constexpr auto BACKEND_IDLE_WAIT = std::chrono::milliseconds(2);
+
+        /**
+         * @brief Queue registry and the thread that drains it
+         */
+        struct AsyncBackend
+        {
+            LoggerSpecification Spec;
+
+            std::mutex QueuesMutex;
+            std::vector<std::shared_ptr<LogQueue>> Queues;
+
+            std::thread Thread;
+            std::mutex WakeMutex;
+            std::condition_variable WakeCondition;
+            std::atomic<bool> Running = false;
+
+            std::atomic<uint64> Written = 0;
+            std::atomic<uint64> Dropped = 0;
+            std::atomic<uint64> ProducerWaits = 0;
+        };
+
+        AsyncBackend s_Backend;
+        std::atomic<uint64> s_BackendGeneration = 0;
+
+        /**
+         * @brief The calling thread's queue, registered on first use
+         */
+        struct ThreadQueue
+        {
+            std::shared_ptr<LogQueue> Queue;
+            uint64 Generation = 0;
+            uint32 PendingSize = 0;
+        };
+
+        thread_local ThreadQueue t_Queue;
+
+        LogQueue& GetThreadQueue()
+        {
+            // A new Initialize() starts a new generation; queues of the old one are gone
+            uint64 generation = s_BackendGeneration.load(std::memory_order_acquire);
+            if (!t_Queue.Queue || t_Queue.Generation != generation)
+            {
+                t_Queue.Queue = std::make_shared<LogQueue>(s_Backend.Spec.QueueCapacity);
+                t_Queue.Generation = generation;
+
+                std::lock_guard lock(s_Backend.QueuesMutex);
+                s_Backend.Queues.push_back(t_Queue.Queue);
+            }
+
+            return *t_Queue.Queue;
+        }
+
+        void WakeBackend()
+        {
+            s_Backend.WakeCondition.notify_one();
+        }
+
+        void WriteRecord(const LogRecordHeader& record, spdlog::memory_buf_t& buffer)
+        {
+            auto& logger = static_cast<Logger::Target>(record.Target) == Logger::Target::Engine
+                ? Logger::GetEngineLogger()
+                : Logger::GetClientLogger();
+
+            std::string_view text;
+            if (record.Kind == LogRecordKind::Deferred)
+            {
+                buffer.clear();
+                record.FormatArgs(std::string_view(record.Format, record.FormatSize), record.GetPayload(), buffer);
+                text = std::string_view(buffer.data(), buffer.size());
+            }
+            else
+            {
+                text = std::string_view(reinterpret_cast<const char*>(record.GetPayload()), record.PayloadSize);
+            }
+
+            logger->log(record.Time, spdlog::source_loc{}, static_cast<spdlog::level::level_enum>(record.Level), text);
+        }
+
+        /**
+         * @brief Write every queued record, oldest first across all threads
+         * @return Number of records written
+         */
+        uint64 DrainQueues()
+        {
+            std::vector<std::shared_ptr<LogQueue>> queues;
+            {
+                std::lock_guard lock(s_Backend.QueuesMutex);
+
+                // Queues of exited threads are released once empty
+                std::erase_if(s_Backend.Queues, [](const std::shared_ptr<LogQueue>& queue)
+                {
+                    return queue.use_count() == 1 && queue->IsEmpty();
+                });
+                queues = s_Backend.Queues;
+            }
+
+            spdlog::memory_buf_t buffer;
+            uint64 written = 0;
+            while (true)
+            {
+                LogQueue* oldestQueue = nullptr;
+                const LogRecordHeader* oldest = nullptr;
+                for (const auto& queue : queues)
+                {
+                    const LogRecordHeader* record = queue->Peek();
+                    if (record && (!oldest || record->Time < oldest->Time))
+                    {
+                        oldest = record;
+                        oldestQueue = queue.get();
+                    }
+                }
+
+                if (!oldest)
+                {
+                    break;
+                }
+
+                WriteRecord(*oldest, buffer);
+                oldestQueue->Pop(*oldest);
+                ++written;
+            }
+
+            s_Backend.Written.fetch_add(written, std::memory_order_relaxed);
+            return written;
+        }
+
+        void BackendThreadMain()
+        {
+            while (s_Backend.Running.load(std::memory_order_acquire))
+            {
+                if (DrainQueues() == 0)
+                {
+                    std::unique_lock lock(s_Backend.WakeMutex);
+                    s_Backend.WakeCondition.wait_for(lock, BACKEND_IDLE_WAIT);
+                }
+            }
+
+            DrainQueues();
+        }
+
+        bool AllQueuesEmpty()
+        {
+            std::lock_guard lock(s_Backend.QueuesMutex);
+            return std::all_of(s_Backend.Queues.begin(), s_Backend.Queues.end(),
+                               [](const std::shared_ptr<LogQueue>& queue) { return queue->IsEmpty(); });
+        }
+
+        std::shared_ptr<spdlog::logger> CreateLogger(const std::string& name, const std::vector<spdlog::sink_ptr>& sinks)
+        {
+            auto logger = std::make_shared<spdlog::logger>(name, sinks.begin(), sinks.end());
+            logger->set_level(spdlog::level::trace);
+            logger->flush_on(spdlog::level::err);
+            spdlog::register_logger(logger);
+            return logger;
+        }
+    }
+
+    // =========================================================================
+    // Logger
+    // =========================================================================
+
+    void Logger::Initialize(const LoggerSpecification& spec)
+    {
+        std::vector<spdlog::sink_ptr> sinks;
+
         // Log pattern: [Timestamp] [Logger Name] [Level] Message
         // %^ and %$ enable color based on log level
-        spdlog::set_pattern("%^[%T] [%n] [%l] %v%$");
+        auto consoleSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+        consoleSink->set_pattern("%^[%T] [%n] [%l] %v%$");
+        sinks.push_back(consoleSink);
 
-        // Create Engine logger (will use default colors based on log level)
-        s_EngineLogger = spdlog::stdout_color_mt("ENGINE");
+        std::string fileError;
+        if (!spec.FilePath.empty())
+        {
+            try
+            {
+                auto fileSink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(spec.FilePath, spec.MaxFileSize, spec.MaxFiles);
+                fileSink->set_pattern("[%Y-%m-%d %T.%e] [%n] [%l] %v");
+                sinks.push_back(fileSink);
+            }
+            catch (const spdlog::spdlog_ex& e)
+            {
+                fileError = e.what();
+            }
+        }
+
+        s_EngineLogger = CreateLogger("ENGINE", sinks);
         NS_ENGINE_ASSERT(s_EngineLogger != nullptr, "Failed to create Engine logger");
-        s_EngineLogger->set_level(spdlog::level::trace);
 
-        // Create Client logger (will use default colors based on log level)
-        s_ClientLogger = spdlog::stdout_color_mt("CLIENT");
+        s_ClientLogger = CreateLogger("CLIENT", sinks);
         NS_ENGINE_ASSERT(s_ClientLogger != nullptr, "Failed to create Client logger");
-        s_ClientLogger->set_level(spdlog::level::trace);
 
-        NS_ENGINE_INFO("Logger initialized");
+        if (spec.Async)
+        {
+            s_Backend.Spec = spec;
+            s_Backend.Written = 0;
+            s_Backend.Dropped = 0;
+            s_Backend.ProducerWaits = 0;
+            s_BackendGeneration.fetch_add(1, std::memory_order_release);
+
+            s_Backend.Running = true;
+            s_Backend.Thread = std::thread(BackendThreadMain);
+            s_Async = true;
+        }
+
+        NS_ENGINE_INFO("Logger initialized ({})", spec.Async ? "async" : "sync");
+        if (!fileError.empty())
+        {
+            NS_ENGINE_WARN("Log file disabled: {}", fileError);
+        }
     }
 
     void Logger::Shutdown()
     {
         NS_ENGINE_INFO("Logger shutting down");
 
+        if (s_Async)
+        {
+            LogStatistics statistics = GetStatistics();
+            if (statistics.Dropped > 0)
+            {
+                NS_ENGINE_WARN("{} log messages were dropped (queue full)", statistics.Dropped);
+            }
+
+            s_Async = false;
+            s_Backend.Running = false;
+            WakeBackend();
+            s_Backend.Thread.join();
+
+            std::lock_guard lock(s_Backend.QueuesMutex);
+            s_Backend.Queues.clear();
+        }
+
         s_EngineLogger.reset();
         s_ClientLogger.reset();
 
         spdlog::shutdown();
     }
+
+    void Logger::Flush()
+    {
+        if (s_Async)
+        {
+            while (!AllQueuesEmpty())
+            {
+                WakeBackend();
+                std::this_thread::yield();
+            }
+        }
+
+        s_EngineLogger->flush();
+        s_ClientLogger->flush();
+    }
+
+    LogStatistics Logger::GetStatistics()
+    {
+        LogStatistics statistics;
+        statistics.Written = s_Backend.Written.load(std::memory_order_relaxed);
+        statistics.Dropped = s_Backend.Dropped.load(std::memory_order_relaxed);
+        statistics.ProducerWaits = s_Backend.ProducerWaits.load(std::memory_order_relaxed);
+
+        std::lock_guard lock(s_Backend.QueuesMutex);
+        statistics.ThreadQueues = static_cast<uint32>(s_Backend.Queues.size());
+        return statistics;
+    }
+
+    std::byte* Logger::BeginRecord(Target target, spdlog::level::level_enum level, LogRecordKind kind,
+                                   std::string_view format, LogFormatFn formatArgs, usize payloadSize)
+    {
+        LogQueue& queue = GetThreadQueue();
+
+        usize recordSize = (sizeof(LogRecordHeader) + payloadSize + 7) & ~usize(7);
+        if (recordSize > queue.GetMaxRecordSize())
+        {
+            s_Backend.Dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        uint32 size = static_cast<uint32>(recordSize);
+        std::byte* memory = queue.Reserve(size);
+        while (!memory)
+        {
+            if (s_Backend.Spec.Overflow == LogOverflowPolicy::Drop)
+            {
+                s_Backend.Dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            s_Backend.ProducerWaits.fetch_add(1, std::memory_order_relaxed);
+            WakeBackend();
+            std::this_thread::yield();
+            memory = queue.Reserve(size);
+        }
+
+        auto* record = new (memory) LogRecordHeader();
+        record->Size = size;
+        record->Kind = kind;
+        record->Target = static_cast<uint8>(target);
+        record->Level = static_cast<uint8>(level);
+        record->FormatSize = static_cast<uint32>(format.size());
+        record->PayloadSize = static_cast<uint32>(payloadSize);
+        record->Format = format.data();
+        record->FormatArgs = formatArgs;
+        record->Time = spdlog::log_clock::now();
+
+        t_Queue.PendingSize = size;
+        return memory + sizeof(LogRecordHeader);
+    }
+
+    void Logger::EndRecord(spdlog::level::level_enum level)
+    {
+        t_Queue.Queue->Commit(t_Queue.PendingSize);
+
+        // Errors must be visible before a crash or debug break that may follow
+        if (level >= spdlog::level::err)
+        {
+            Flush();
+        }
+    }
+
+    void Logger::WriteMessage(Target target, spdlog::level::level_enum level, std::string_view text)
+    {
+        std::byte* payload = BeginRecord(target, level, LogRecordKind::Message, {}, nullptr, text.size());
+        if (payload)
+        {
+            std::memcpy(payload, text.data(), text.size());
+            EndRecord(level);
+        }
+    }
 }
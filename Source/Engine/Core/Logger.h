@@ -1,35 +1,347 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <limits>
 #include <memory>
+#include <string>
 #include "spdlog/spdlog.h"
+#include "Core/Types.h"
+#include "Core/LogQueue.h"
 
 namespace NanSu
 {
+    /**
+     * @brief What a thread does when its async log queue is full
+     */
+    enum class LogOverflowPolicy : uint8
+    {
+        Drop,           // Discard the message and count it (never stalls the caller)
+        Block           // Wait for the backend thread to make room
+    };
+
+    /**
+     * @brief Logger setup passed to Logger::Initialize()
+     */
+    struct LoggerSpecification
+    {
+        bool Async = true;                              // Format and write on a background thread
+        std::string FilePath = "Logs/NanSu.log";        // Rotating file sink (empty = console only)
+        usize MaxFileSize = 5 * 1024 * 1024;            // Bytes per file before rotating
+        usize MaxFiles = 3;                             // Rotated files kept besides the current one
+        usize QueueCapacity = 256 * 1024;               // Bytes per logging thread
+        LogOverflowPolicy Overflow = LogOverflowPolicy::Drop;
+    };
+
+    /**
+     * @brief Async logging counters since Initialize()
+     */
+    struct LogStatistics
+    {
+        uint64 Written = 0;             // Messages handed to the sinks by the backend
+        uint64 Dropped = 0;             // Messages lost to a full queue (or larger than half a queue)
+        uint64 ProducerWaits = 0;       // Times a thread found its queue full under LogOverflowPolicy::Block
+        uint32 ThreadQueues = 0;        // Threads with a live queue
+    };
+
+    /**
+     * @brief Engine and client loggers (console + rotating file)
+     *
+     * In async mode a log call only checks the level, copies the format
+     * string pointer and the raw arguments into the calling thread's
+     * LogQueue and returns; a background thread formats the messages in
+     * timestamp order and writes them to the sinks. Arguments other than
+     * numbers, pointers and strings are formatted at the call site.
+     * Errors and criticals wait until everything before them was written,
+     * so they are on screen before an assert breaks.
+     */
     class Logger
     {
     public:
-        static void Initialize();
+        enum class Target : uint8
+        {
+            Engine = 0,
+            Client
+        };
+
+        static void Initialize(const LoggerSpecification& spec = LoggerSpecification());
         static void Shutdown();
 
+        /**
+         * @brief Wait until every queued message was written, then flush the sinks
+         */
+        static void Flush();
+
+        static bool IsAsync() { return s_Async; }
+        static LogStatistics GetStatistics();
+
         static std::shared_ptr<spdlog::logger>& GetEngineLogger() { return s_EngineLogger; }
         static std::shared_ptr<spdlog::logger>& GetClientLogger() { return s_ClientLogger; }
 
+        /**
+         * @brief Log a formatted message (used by the NS_* macros)
+         */
+        template <typename... Args>
+        static void Log(Target target, spdlog::level::level_enum level, spdlog::format_string_t<Args...> format, Args&&... args);
+
+        /**
+         * @brief Log a value as-is, without format string parsing
+         */
+        template <typename T>
+        static void Log(Target target, spdlog::level::level_enum level, const T& message);
+
+    private:
+        static spdlog::logger& GetLogger(Target target)
+        {
+            return target == Target::Engine ? *s_EngineLogger : *s_ClientLogger;
+        }
+
+        /**
+         * @brief Reserve a record in the calling thread's queue and fill its header
+         * @return Payload pointer, or nullptr if the message was dropped
+         */
+        static std::byte* BeginRecord(Target target, spdlog::level::level_enum level, LogRecordKind kind,
+                                      std::string_view format, LogFormatFn formatArgs, usize payloadSize);
+
+        /**
+         * @brief Publish the record of the last BeginRecord()
+         */
+        static void EndRecord(spdlog::level::level_enum level);
+
+        static void WriteMessage(Target target, spdlog::level::level_enum level, std::string_view text);
+
     private:
         static std::shared_ptr<spdlog::logger> s_EngineLogger;
         static std::shared_ptr<spdlog::logger> s_ClientLogger;
+        static bool s_Async;
+    };
+
+    // =========================================================================
+    // Template Implementation
+    // =========================================================================
+
+    template <typename... Args>
+    void Logger::Log(Target target, spdlog::level::level_enum level, spdlog::format_string_t<Args...> format, Args&&... args)
+    {
+        spdlog::logger& logger = GetLogger(target);
+        if (!logger.should_log(level))
+        {
+            return;
+        }
+
+        if (!s_Async)
+        {
+            logger.log(level, format, std::forward<Args>(args)...);
+            return;
+        }
+
+        if constexpr ((LogDetail::IsDeferrable<std::remove_cvref_t<Args>> && ...))
+        {
+            usize payloadSize = (usize(0) + ... + LogDetail::EncodedSize(args));
+            fmt::string_view formatView = format;
+
+            std::byte* cursor = BeginRecord(target, level, LogRecordKind::Deferred,
+                                            std::string_view(formatView.data(), formatView.size()),
+                                            &LogDetail::FormatDeferred<std::remove_cvref_t<Args>...>, payloadSize);
+            if (cursor)
+            {
+                (LogDetail::Encode(cursor, args), ...);
+                EndRecord(level);
+            }
+        }
+        else
+        {
+            spdlog::memory_buf_t text;
+            fmt::format_to(fmt::appender(text), format, std::forward<Args>(args)...);
+            WriteMessage(target, level, std::string_view(text.data(), text.size()));
+        }
+    }
+
+    template <typename T>
+    void Logger::Log(Target target, spdlog::level::level_enum level, const T& message)
+    {
+        spdlog::logger& logger = GetLogger(target);
+        if (!logger.should_log(level))
+        {
+            return;
+        }
+
+        if (!s_Async)
+        {
+            logger.log(level, message);
+            return;
+        }
+
+        if constexpr (LogDetail::IsString<T>)
+        {
+            WriteMessage(target, level, LogDetail::AsString(message));
+        }
+        else
+        {
+            spdlog::memory_buf_t text;
+            fmt::format_to(fmt::appender(text), "{}", message);
+            WriteMessage(target, level, std::string_view(text.data(), text.size()));
+        }
+    }
+}
+
+// =============================================================================
+// Compile-Time Log Level
+// =============================================================================
+//
+// Calls below NS_LOG_ACTIVE_LEVEL are removed by the preprocessor, arguments
+// included. Defaults per configuration; define NS_LOG_ACTIVE_LEVEL in the
+// project settings to override.
+// =============================================================================
+
+// Values match spdlog::level (the engine has no debug level)
+#define NS_LOG_LEVEL_TRACE      0
+#define NS_LOG_LEVEL_INFO       2
+#define NS_LOG_LEVEL_WARN       3
+#define NS_LOG_LEVEL_ERROR      4
+#define NS_LOG_LEVEL_CRITICAL   5
+#define NS_LOG_LEVEL_OFF        6
+
+#ifndef NS_LOG_ACTIVE_LEVEL
+    #if defined(NS_DISTRIBUTION)
+        #define NS_LOG_ACTIVE_LEVEL NS_LOG_LEVEL_WARN
+    #elif defined(NS_RELEASE)
+        #define NS_LOG_ACTIVE_LEVEL NS_LOG_LEVEL_INFO
+    #else
+        #define NS_LOG_ACTIVE_LEVEL NS_LOG_LEVEL_TRACE
+    #endif
+#endif
+
+#define NS_LOG_CALL(TARGET, LEVEL, ...) ::NanSu::Logger::Log(::NanSu::Logger::Target::TARGET, ::spdlog::level::LEVEL, __VA_ARGS__)
+
+#if NS_LOG_ACTIVE_LEVEL <= NS_LOG_LEVEL_TRACE
+    #define NS_ENGINE_TRACE(...)    NS_LOG_CALL(Engine, trace, __VA_ARGS__)
+    #define NS_TRACE(...)           NS_LOG_CALL(Client, trace, __VA_ARGS__)
+#else
+    #define NS_ENGINE_TRACE(...)    ((void)0)
+    #define NS_TRACE(...)           ((void)0)
+#endif
+
+#if NS_LOG_ACTIVE_LEVEL <= NS_LOG_LEVEL_INFO
+    #define NS_ENGINE_INFO(...)     NS_LOG_CALL(Engine, info, __VA_ARGS__)
+    #define NS_INFO(...)            NS_LOG_CALL(Client, info, __VA_ARGS__)
+#else
+    #define NS_ENGINE_INFO(...)     ((void)0)
+    #define NS_INFO(...)            ((void)0)
+#endif
+
+#if NS_LOG_ACTIVE_LEVEL <= NS_LOG_LEVEL_WARN
+    #define NS_ENGINE_WARN(...)     NS_LOG_CALL(Engine, warn, __VA_ARGS__)
+    #define NS_WARN(...)            NS_LOG_CALL(Client, warn, __VA_ARGS__)
+#else
+    #define NS_ENGINE_WARN(...)     ((void)0)
+    #define NS_WARN(...)            ((void)0)
+#endif
+
+#if NS_LOG_ACTIVE_LEVEL <= NS_LOG_LEVEL_ERROR
+    #define NS_ENGINE_ERROR(...)    NS_LOG_CALL(Engine, err, __VA_ARGS__)
+    #define NS_ERROR(...)           NS_LOG_CALL(Client, err, __VA_ARGS__)
+#else
+    #define NS_ENGINE_ERROR(...)    ((void)0)
+    #define NS_ERROR(...)           ((void)0)
+#endif
+
+#if NS_LOG_ACTIVE_LEVEL <= NS_LOG_LEVEL_CRITICAL
+    #define NS_ENGINE_CRITICAL(...) NS_LOG_CALL(Engine, critical, __VA_ARGS__)
+    #define NS_CRITICAL(...)        NS_LOG_CALL(Client, critical, __VA_ARGS__)
+#else
+    #define NS_ENGINE_CRITICAL(...) ((void)0)
+    #define NS_CRITICAL(...)        ((void)0)
+#endif
+
+// =============================================================================
+// Rate-Limited Logging
+// =============================================================================
+//
+// Wrap any log macro to limit how often one call site logs, e.g. per frame:
+//
+//   NS_LOG_ONCE(NS_ENGINE_WARN, "Texture {} missing, using fallback", name);
+//   NS_LOG_EVERY_N(NS_ENGINE_TRACE, 60, "Frame {}: {} draw calls", frame, draws);
+//   NS_LOG_EVERY_SECONDS(NS_INFO, 1.0, "Particles alive: {}", count);
+//
+// Each call site keeps its own static state, shared by all threads. Arguments
+// are only evaluated when the message is logged.
+// =============================================================================
+
+namespace NanSu
+{
+    /**
+     * @brief Call-site state of NS_LOG_EVERY_N
+     */
+    class LogEveryN
+    {
+    public:
+        explicit LogEveryN(uint32 n) : m_N(n > 0 ? n : 1) {}
+
+        /**
+         * @brief true on the first call and every n-th call after it
+         */
+        bool ShouldLog() { return m_Count.fetch_add(1, std::memory_order_relaxed) % m_N == 0; }
+
+    private:
+        std::atomic<uint32> m_Count = 0;
+        uint32 m_N;
+    };
+
+    /**
+     * @brief Call-site state of NS_LOG_EVERY_SECONDS
+     */
+    class LogRateLimiter
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        explicit LogRateLimiter(float64 intervalSeconds)
+            : m_Interval(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float64>(intervalSeconds)).count())
+        {
+        }
+
+        /**
+         * @brief true on the first call and then at most once per interval
+         */
+        bool ShouldLog()
+        {
+            Clock::rep now = Clock::now().time_since_epoch().count();
+            Clock::rep next = m_Next.load(std::memory_order_relaxed);
+
+            // Only the thread that moves the deadline logs
+            return now >= next && m_Next.compare_exchange_strong(next, now + m_Interval, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<Clock::rep> m_Next = std::numeric_limits<Clock::rep>::min();
+        Clock::rep m_Interval;
     };
 }
 
-// Engine Log Macros
-#define NS_ENGINE_TRACE(...)    ::NanSu::Logger::GetEngineLogger()->trace(__VA_ARGS__)
-#define NS_ENGINE_INFO(...)     ::NanSu::Logger::GetEngineLogger()->info(__VA_ARGS__)
-#define NS_ENGINE_WARN(...)     ::NanSu::Logger::GetEngineLogger()->warn(__VA_ARGS__)
-#define NS_ENGINE_ERROR(...)    ::NanSu::Logger::GetEngineLogger()->error(__VA_ARGS__)
-#define NS_ENGINE_CRITICAL(...) ::NanSu::Logger::GetEngineLogger()->critical(__VA_ARGS__)
-
-// Client (Game/Editor) Log Macros
-#define NS_TRACE(...)           ::NanSu::Logger::GetClientLogger()->trace(__VA_ARGS__)
-#define NS_INFO(...)            ::NanSu::Logger::GetClientLogger()->info(__VA_ARGS__)
-#define NS_WARN(...)            ::NanSu::Logger::GetClientLogger()->warn(__VA_ARGS__)
-#define NS_ERROR(...)           ::NanSu::Logger::GetClientLogger()->error(__VA_ARGS__)
-#define NS_CRITICAL(...)        ::NanSu::Logger::GetClientLogger()->critical(__VA_ARGS__)
+#define NS_LOG_ONCE(LOG_MACRO, ...) \
+    do { \
+        static std::atomic<bool> s_Logged = false; \
+        if (!s_Logged.load(std::memory_order_relaxed) && !s_Logged.exchange(true, std::memory_order_relaxed)) \
+        { \
+            LOG_MACRO(__VA_ARGS__); \
+        } \
+    } while (false)
+
+#define NS_LOG_EVERY_N(LOG_MACRO, n, ...) \
+    do { \
+        static ::NanSu::LogEveryN s_LogSite(n); \
+        if (s_LogSite.ShouldLog()) \
+        { \
+            LOG_MACRO(__VA_ARGS__); \
+        } \
+    } while (false)
+
+#define NS_LOG_EVERY_SECONDS(LOG_MACRO, seconds, ...) \
+    do { \
+        static ::NanSu::LogRateLimiter s_LogSite(seconds); \
+        if (s_LogSite.ShouldLog()) \
+        { \
+            LOG_MACRO(__VA_ARGS__); \
+        } \
+    } while (false)
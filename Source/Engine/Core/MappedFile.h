@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Core/Types.h"
+
+#include <span>
+#include <string>
+
+namespace NanSu
+{
+    /**
+     * @brief Read-only memory-mapped view of a whole file
+     *
+     * The file contents are paged in by the OS on first access, so opening a
+     * large archive costs a single open/map call and no copies. The mapping
+     * stays valid until Close() is called or the object is destroyed.
+     *
+     * Platform-specific implementations live in Platform/<OS>/<OS>FileMapping.cpp.
+     */
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile() { Close(); }
+
+        // Non-copyable
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * @brief Map the file into memory
+         * @param filePath Path to the file
+         * @return true on success
+         */
+        bool Open(const std::string& filePath);
+
+        /**
+         * @brief Unmap the file and release the handles
+         */
+        void Close();
+
+        bool IsOpen() const { return m_Data != nullptr; }
+        const byte* GetData() const { return m_Data; }
+        usize GetSize() const { return m_Size; }
+        std::span<const byte> GetSpan() const { return { m_Data, m_Size }; }
+
+    private:
+        const byte* m_Data = nullptr;
+        usize m_Size = 0;
+
+        // Platform handles (file descriptor / HANDLE pair)
+        void* m_FileHandle = nullptr;
+        void* m_MappingHandle = nullptr;
+    };
+}
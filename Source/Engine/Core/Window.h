@@ -45,6 +45,16 @@ namespace NanSu
          */
         virtual void OnUpdate() = 0;
 
+        /**
+         * @brief Block until window messages arrive or the timeout expires, then process them
+         * @param timeoutSeconds Maximum time to wait (negative = wait indefinitely)
+         * @return true if messages arrived before the timeout
+         *
+         * Used by the Application's power-saving mode instead of OnUpdate()
+         * so an idle loop sleeps in the OS rather than spinning.
+         */
+        virtual bool WaitEvents(float64 timeoutSeconds) = 0;
+
         /**
          * @brief Get the window's client area width
          */
@@ -63,7 +73,7 @@ namespace NanSu
 
         /**
          * @brief Get the native window handle
-         * @return Platform-specific handle (HWND on Windows)
+         * @return Platform-specific handle (HWND on Windows, nullptr when headless)
          */
         virtual void* GetNativeWindow() const = 0;
 
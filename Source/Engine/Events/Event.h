@@ -36,6 +36,8 @@ namespace NanSu
         MouseButtonReleased
     };
 
+    constexpr uint32 EVENT_TYPE_COUNT = static_cast<uint32>(EventType::MouseButtonReleased) + 1;
+
     /**
      * @brief Event category flags for filtering (can be combined with bitwise OR)
      */
@@ -50,13 +52,56 @@ namespace NanSu
         EventCategoryMouseButton = 1 << 5
     };
 
+    /**
+     * @brief Set of event types (one bit per EventType value)
+     */
+    class EventTypeMask
+    {
+    public:
+        constexpr EventTypeMask() = default;
+
+        static constexpr EventTypeMask None() { return EventTypeMask(); }
+        static constexpr EventTypeMask All() { return EventTypeMask(ALL_BITS); }
+
+        /**
+         * @brief Mask of the given event classes
+         */
+        template<typename... Ts>
+        static constexpr EventTypeMask Of()
+        {
+            EventTypeMask mask;
+            (mask.Add(Ts::GetStaticType()), ...);
+            return mask;
+        }
+
+        constexpr void Add(EventType type) { m_Bits |= Bit(type); }
+        constexpr void Remove(EventType type) { m_Bits &= ~Bit(type); }
+        constexpr bool Contains(EventType type) const { return (m_Bits & Bit(type)) != 0; }
+        constexpr bool IsEmpty() const { return m_Bits == 0; }
+
+        constexpr EventTypeMask operator|(EventTypeMask other) const { return EventTypeMask(m_Bits | other.m_Bits); }
+        constexpr bool operator==(const EventTypeMask& other) const = default;
+
+    private:
+        static constexpr uint32 ALL_BITS = ((1u << (EVENT_TYPE_COUNT - 1)) - 1) << 1;     // Every type but None
+
+        constexpr explicit EventTypeMask(uint32 bits) : m_Bits(bits) {}
+        static constexpr uint32 Bit(EventType type) { return 1u << static_cast<uint32>(type); }
+
+    private:
+        uint32 m_Bits = 0;
+    };
+
+    static_assert(EVENT_TYPE_COUNT <= 32, "EventTypeMask holds one bit per EventType");
+
     // Macro to reduce boilerplate in event classes
     #define NS_EVENT_CLASS_TYPE(type) \
-        static EventType GetStaticType() { return EventType::type; } \
+        static constexpr EventType GetStaticType() { return EventType::type; } \
         virtual EventType GetEventType() const override { return GetStaticType(); } \
         virtual const char* GetName() const override { return #type; }
 
     #define NS_EVENT_CLASS_CATEGORY(category) \
+        static constexpr uint32 GetStaticCategoryFlags() { return category; } \
         virtual uint32 GetCategoryFlags() const override { return category; }
 
     /**
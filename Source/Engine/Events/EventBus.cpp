@@ -1,10 +1,18 @@
 #include "EnginePCH.h"
 #include "Events/EventBus.h"
+#include "Events/KeyEvent.h"
+#include "Events/MouseEvent.h"
 
 namespace NanSu
 {
-    std::unordered_map<EventType, std::vector<EventBus::HandlerEntry>> EventBus::s_Handlers;
-    std::vector<EventBus::CategoryHandlerEntry> EventBus::s_CategoryHandlers;
+    std::array<std::vector<EventBus::HandlerEntry>, EVENT_TYPE_COUNT> EventBus::s_Handlers;
+    std::unordered_map<EventBus::HandlerId, EventBus::Subscription> EventBus::s_Subscriptions;
+    std::vector<EventBus::PendingHandler> EventBus::s_PendingHandlers;
+    EventTypeMask EventBus::s_DirtyTypes;
+    uint32 EventBus::s_DispatchDepth = 0;
+    float32 EventBus::s_CursorX = 0.0f;
+    float32 EventBus::s_CursorY = 0.0f;
+    std::vector<EventPool::Ptr<Event>> EventBus::s_Queue;
     EventBus::HandlerId EventBus::s_NextHandlerId = 1;
     bool EventBus::s_Initialized = false;
 
@@ -12,8 +20,14 @@ namespace NanSu
     {
         if (!s_Initialized)
         {
-            s_Handlers.clear();
-            s_CategoryHandlers.clear();
+            for (auto& handlers : s_Handlers)
+            {
+                handlers.clear();
+            }
+            s_Subscriptions.clear();
+            s_PendingHandlers.clear();
+            s_DirtyTypes = EventTypeMask::None();
+            s_DispatchDepth = 0;
             s_NextHandlerId = 1;
             s_Initialized = true;
             NS_ENGINE_INFO("EventBus initialized");
@@ -25,46 +39,116 @@ namespace NanSu
         if (s_Initialized)
         {
             NS_ENGINE_INFO("EventBus shutting down");
-            s_Handlers.clear();
-            s_CategoryHandlers.clear();
+            for (auto& handlers : s_Handlers)
+            {
+                handlers.clear();
+            }
+            s_Subscriptions.clear();
+            s_PendingHandlers.clear();
+            s_Queue.clear();
+            EventPool::Shutdown();
             s_Initialized = false;
         }
     }
 
-    EventBus::HandlerId EventBus::SubscribeToCategory(EventCategory category, EventHandler handler)
+    EventBus::HandlerId EventBus::SubscribeToCategory(EventCategory category, EventHandler handler, const SubscribeOptions& options)
+    {
+        return AddHandler(EventTypesInCategory(category), true, options, std::move(handler));
+    }
+
+    EventBus::HandlerId EventBus::AddHandler(EventTypeMask types, bool isCategory, const SubscribeOptions& options, EventHandler handler)
     {
         NS_ENGINE_ASSERT(s_Initialized, "EventBus must be initialized before subscribing");
         NS_ENGINE_ASSERT(handler != nullptr, "Event handler cannot be null");
 
         HandlerId id = s_NextHandlerId++;
-        s_CategoryHandlers.push_back({ id, category, std::move(handler) });
+        s_Subscriptions[id] = { types, options.Priority, isCategory };
+
+        HandlerEntry entry;
+        entry.Id = id;
+        entry.Priority = options.Priority;
+        entry.IsCategory = isCategory;
+        entry.Once = options.Once;
+        entry.Filter = options.Filter;
+        entry.Handler = std::move(handler);
+
+        for (uint32 index = 1; index < EVENT_TYPE_COUNT; ++index)
+        {
+            EventType type = static_cast<EventType>(index);
+            if (!types.Contains(type))
+            {
+                continue;
+            }
+
+            // The arrays being dispatched must not move under the running handlers
+            if (s_DispatchDepth > 0)
+            {
+                s_PendingHandlers.push_back({ type, entry });
+            }
+            else
+            {
+                InsertHandler(type, entry);
+            }
+        }
+
         return id;
     }
 
+    void EventBus::InsertHandler(EventType type, HandlerEntry entry)
+    {
+        auto& handlers = s_Handlers[static_cast<uint32>(type)];
+        auto position = std::upper_bound(handlers.begin(), handlers.end(), entry, RunsBefore);
+        handlers.insert(position, std::move(entry));
+    }
+
     void EventBus::Unsubscribe(HandlerId handlerId)
     {
-        // Remove from type-specific handlers
-        for (auto& [type, handlers] : s_Handlers)
+        auto it = s_Subscriptions.find(handlerId);
+        if (it == s_Subscriptions.end())
         {
-            handlers.erase(
-                std::remove_if(handlers.begin(), handlers.end(),
-                    [handlerId](const HandlerEntry& entry)
-                    {
-                        return entry.id == handlerId;
-                    }),
-                handlers.end()
-            );
+            return;
         }
 
-        // Remove from category handlers
-        s_CategoryHandlers.erase(
-            std::remove_if(s_CategoryHandlers.begin(), s_CategoryHandlers.end(),
-                [handlerId](const CategoryHandlerEntry& entry)
-                {
-                    return entry.id == handlerId;
-                }),
-            s_CategoryHandlers.end()
-        );
+        const Subscription subscription = it->second;
+        s_Subscriptions.erase(it);
+
+        // Only the arrays of the subscribed types are touched, and within each
+        // only the run of entries sharing the subscription's sort key
+        HandlerEntry key;
+        key.Priority = subscription.Priority;
+        key.IsCategory = subscription.IsCategory;
+
+        for (uint32 index = 1; index < EVENT_TYPE_COUNT; ++index)
+        {
+            EventType type = static_cast<EventType>(index);
+            if (!subscription.Types.Contains(type))
+            {
+                continue;
+            }
+
+            auto& handlers = s_Handlers[index];
+            auto [first, last] = std::equal_range(handlers.begin(), handlers.end(), key, RunsBefore);
+            auto entry = std::find_if(first, last, [handlerId](const HandlerEntry& e) { return e.Id == handlerId; });
+            if (entry == last)
+            {
+                continue;
+            }
+
+            if (s_DispatchDepth > 0)
+            {
+                entry->Active = false;
+                s_DirtyTypes.Add(type);
+            }
+            else
+            {
+                handlers.erase(entry);
+            }
+        }
+
+        if (!s_PendingHandlers.empty())
+        {
+            std::erase_if(s_PendingHandlers, [handlerId](const PendingHandler& pending) { return pending.Entry.Id == handlerId; });
+        }
     }
 
     void EventBus::Publish(Event& event)
@@ -72,32 +156,93 @@ namespace NanSu
         NS_ENGINE_ASSERT(s_Initialized, "EventBus must be initialized before publishing events");
         NS_EVENT_TRACE(event);
 
-        // Dispatch to type-specific handlers
         EventType type = event.GetEventType();
-        auto it = s_Handlers.find(type);
-        if (it != s_Handlers.end())
+        auto& handlers = s_Handlers[static_cast<uint32>(type)];
+
+        // Filter inputs are extracted once; mouse events without a position
+        // use the cursor from the last MouseMovedEvent seen by the bus
+        int32 code = EventFilter::AnyCode;
+        bool isMouse = event.IsInCategory(EventCategoryMouse);
+        switch (type)
         {
-            for (auto& entry : it->second)
-            {
-                if (event.IsHandled())
-                {
-                    break;
-                }
-                entry.handler(event);
-            }
+            case EventType::KeyPressed:
+            case EventType::KeyReleased:
+            case EventType::KeyTyped:
+                code = static_cast<KeyEvent&>(event).GetKeyCode();
+                break;
+            case EventType::MouseButtonPressed:
+            case EventType::MouseButtonReleased:
+                code = static_cast<MouseButtonEvent&>(event).GetMouseButton();
+                break;
+            case EventType::MouseMoved:
+                s_CursorX = static_cast<MouseMovedEvent&>(event).GetX();
+                s_CursorY = static_cast<MouseMovedEvent&>(event).GetY();
+                break;
+            default:
+                break;
         }
 
-        // Dispatch to category handlers
-        for (auto& entry : s_CategoryHandlers)
+        ++s_DispatchDepth;
+
+        for (auto& entry : handlers)
         {
             if (event.IsHandled())
             {
                 break;
             }
-            if (event.IsInCategory(entry.category))
+            if (!entry.Active || !entry.Filter.Accepts(code, isMouse, s_CursorX, s_CursorY))
+            {
+                continue;
+            }
+
+            // Removed before the call so a nested Publish() cannot run it again
+            if (entry.Once)
+            {
+                Unsubscribe(entry.Id);
+            }
+            entry.Handler(event);
+        }
+
+        if (--s_DispatchDepth == 0)
+        {
+            ApplyPendingChanges();
+        }
+    }
+
+    void EventBus::ApplyPendingChanges()
+    {
+        if (!s_DirtyTypes.IsEmpty())
+        {
+            for (uint32 index = 1; index < EVENT_TYPE_COUNT; ++index)
+            {
+                if (s_DirtyTypes.Contains(static_cast<EventType>(index)))
+                {
+                    std::erase_if(s_Handlers[index], [](const HandlerEntry& entry) { return !entry.Active; });
+                }
+            }
+            s_DirtyTypes = EventTypeMask::None();
+        }
+
+        if (!s_PendingHandlers.empty())
+        {
+            std::vector<PendingHandler> pending = std::move(s_PendingHandlers);
+            s_PendingHandlers.clear();
+            for (auto& handler : pending)
             {
-                entry.handler(event);
+                InsertHandler(handler.Type, std::move(handler.Entry));
             }
         }
     }
+
+    void EventBus::DispatchQueued()
+    {
+        // Index loop: handlers may enqueue further events
+        for (usize i = 0; i < s_Queue.size(); ++i)
+        {
+            Event* event = s_Queue[i].get();
+            Publish(*event);
+        }
+
+        s_Queue.clear();
+    }
 }
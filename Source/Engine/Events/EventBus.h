@@ -1,16 +1,99 @@
 #pragma once
 
 #include "Events/Event.h"
+#include "Events/EventPool.h"
+#include "Events/EventRegistry.h"
+#include "Events/EventTrace.h"
+#include "Input/KeyCodes.h"
+#include "Input/MouseCodes.h"
+#include <array>
 #include <vector>
 #include <unordered_map>
 #include <functional>
 
 namespace NanSu
 {
+    /**
+     * @brief Cheap pre-filter tested before a handler is called
+     *
+     * The bus extracts the key code / mouse button and cursor position of an
+     * event once per Publish(); each handler's filter is then a couple of
+     * compares instead of a std::function call. A filter rejects events that
+     * do not carry the attribute it tests.
+     *
+     * @code
+     * EventBus::Subscribe<KeyPressedEvent>(OnJump, { .Filter = EventFilter::Key(KeyCode::Space) });
+     * EventBus::SubscribeToCategory(EventCategoryMouse, OnViewportMouse,
+     *                               { .Filter = EventFilter::Region(x, y, width, height) });
+     * @endcode
+     */
+    struct EventFilter
+    {
+        static constexpr int32 AnyCode = -1;
+
+        int32 Code = AnyCode;           // Key code (key events) or button (mouse button events)
+        bool HasRegion = false;         // Cursor must be inside [Min, Max) (mouse events)
+        float32 MinX = 0.0f;
+        float32 MinY = 0.0f;
+        float32 MaxX = 0.0f;
+        float32 MaxY = 0.0f;
+
+        static constexpr EventFilter Key(KeyCode key) { EventFilter filter; filter.Code = static_cast<int32>(key); return filter; }
+        static constexpr EventFilter Button(MouseCode button) { EventFilter filter; filter.Code = static_cast<int32>(button); return filter; }
+
+        static constexpr EventFilter Region(float32 x, float32 y, float32 width, float32 height)
+        {
+            return EventFilter().InRegion(x, y, width, height);
+        }
+
+        constexpr EventFilter InRegion(float32 x, float32 y, float32 width, float32 height) const
+        {
+            EventFilter filter = *this;
+            filter.HasRegion = true;
+            filter.MinX = x;
+            filter.MinY = y;
+            filter.MaxX = x + width;
+            filter.MaxY = y + height;
+            return filter;
+        }
+
+        /**
+         * @param code Code carried by the event, AnyCode if it has none
+         * @param hasPosition Whether the event is a mouse event
+         */
+        bool Accepts(int32 code, bool hasPosition, float32 x, float32 y) const
+        {
+            if (Code != AnyCode && Code != code)
+            {
+                return false;
+            }
+            if (HasRegion && (!hasPosition || x < MinX || x >= MaxX || y < MinY || y >= MaxY))
+            {
+                return false;
+            }
+            return true;
+        }
+    };
+
+    /**
+     * @brief Per-subscription dispatch options
+     */
+    struct SubscribeOptions
+    {
+        int32 Priority = 0;             // Higher runs first; ties run in subscription order
+        EventFilter Filter;
+        bool Once = false;              // Unsubscribed before its first call
+    };
+
     /**
      * @brief Static event bus for global event subscription and publishing
      *
      * Follows the same pattern as Logger - static subsystem with Initialize/Shutdown
+     *
+     * Every EventType owns one handler array sorted by priority; category
+     * subscriptions are inserted into the array of each type in the category,
+     * after type handlers of the same priority. Subscribing or unsubscribing
+     * from inside a handler takes effect once the outermost Publish() returns.
      */
     class EventBus
     {
@@ -26,32 +109,29 @@ namespace NanSu
          * @brief Subscribe to all events of a specific type
          * @tparam T The event type to subscribe to
          * @param handler The callback function
+         * @param options Priority, pre-filter and one-shot mode
          * @return Handler ID for later unsubscription
          */
         template<typename T>
-        static HandlerId Subscribe(std::function<void(T&)> handler)
+        static HandlerId Subscribe(std::function<void(T&)> handler, const SubscribeOptions& options = {})
         {
-            HandlerId id = s_NextHandlerId++;
-            EventType type = T::GetStaticType();
+            static_assert(IsRegisteredEvent<T>, "Event class is not listed in EngineEventTypes");
 
-            s_Handlers[type].push_back({
-                id,
-                [handler](Event& event)
+            return AddHandler(EventTypeMask::Of<T>(), false, options,
+                [handler = std::move(handler)](Event& event)
                 {
                     handler(static_cast<T&>(event));
-                }
-            });
-
-            return id;
+                });
         }
 
         /**
          * @brief Subscribe to events by category
          * @param category The event category to subscribe to
          * @param handler The callback function
+         * @param options Priority, pre-filter and one-shot mode
          * @return Handler ID for later unsubscription
          */
-        static HandlerId SubscribeToCategory(EventCategory category, EventHandler handler);
+        static HandlerId SubscribeToCategory(EventCategory category, EventHandler handler, const SubscribeOptions& options = {});
 
         /**
          * @brief Unsubscribe a handler by ID
@@ -66,40 +146,89 @@ namespace NanSu
         static void Publish(Event& event);
 
         /**
-         * @brief Publish an event by value (convenience method)
+         * @brief Publish a temporary event without copying it
          * @tparam T The event type
          * @param event The event to publish
          */
         template<typename T>
-        static void Publish(T event)
+        static void Publish(T&& event)
         {
             Publish(static_cast<Event&>(event));
         }
 
+        /**
+         * @brief Construct an event in the EventPool and publish it on the next DispatchQueued()
+         * @tparam T The event type
+         * @param args Constructor arguments of T
+         *
+         * Application::Run() calls DispatchQueued() once per frame, after the
+         * window events and before the layers update, so an event enqueued
+         * during a frame is published at the start of the next one.
+         */
+        template<typename T, typename... Args>
+        static void Enqueue(Args&&... args)
+        {
+            s_Queue.push_back(EventPool::Acquire<T>(std::forward<Args>(args)...));
+        }
+
+        /**
+         * @brief Publish the queued events in order and return them to the pool
+         * Events enqueued by handlers are published in the same call. Called
+         * by the Application every frame; call it yourself only without one.
+         */
+        static void DispatchQueued();
+
     private:
         struct HandlerEntry
         {
-            HandlerId id;
-            EventHandler handler;
+            HandlerId Id = 0;
+            int32 Priority = 0;
+            bool IsCategory = false;    // Category handlers run after type handlers of equal priority
+            bool Once = false;
+            bool Active = true;         // Cleared by Unsubscribe() during dispatch
+            EventFilter Filter;
+            EventHandler Handler;
+        };
+
+        struct Subscription
+        {
+            EventTypeMask Types;
+            int32 Priority = 0;
+            bool IsCategory = false;
         };
 
-        struct CategoryHandlerEntry
+        struct PendingHandler
         {
-            HandlerId id;
-            EventCategory category;
-            EventHandler handler;
+            EventType Type;
+            HandlerEntry Entry;
         };
 
-        static std::unordered_map<EventType, std::vector<HandlerEntry>> s_Handlers;
-        static std::vector<CategoryHandlerEntry> s_CategoryHandlers;
+        static HandlerId AddHandler(EventTypeMask types, bool isCategory, const SubscribeOptions& options, EventHandler handler);
+        static void InsertHandler(EventType type, HandlerEntry entry);
+        static void ApplyPendingChanges();
+
+        static bool RunsBefore(const HandlerEntry& a, const HandlerEntry& b)
+        {
+            return a.Priority > b.Priority || (a.Priority == b.Priority && !a.IsCategory && b.IsCategory);
+        }
+
+        static std::array<std::vector<HandlerEntry>, EVENT_TYPE_COUNT> s_Handlers;
+        static std::unordered_map<HandlerId, Subscription> s_Subscriptions;
+        static std::vector<PendingHandler> s_PendingHandlers;
+        static EventTypeMask s_DirtyTypes;
+        static uint32 s_DispatchDepth;
+        static float32 s_CursorX;
+        static float32 s_CursorY;
+        static std::vector<EventPool::Ptr<Event>> s_Queue;
         static HandlerId s_NextHandlerId;
         static bool s_Initialized;
     };
 }
 
 // Logging macros for event debugging (optional, only in debug builds)
+// The event is formatted by the logger backend, never on the publishing thread
 #ifdef NS_DEBUG
-    #define NS_EVENT_TRACE(event) NS_ENGINE_TRACE("[Event] {}", event.ToString())
+    #define NS_EVENT_TRACE(event) ::NanSu::TraceEvent(event)
 #else
     #define NS_EVENT_TRACE(event)
 #endif
@@ -0,0 +1,57 @@
+#include "EnginePCH.h"
+#include "Events/EventCoalescer.h"
+
+#include <bit>
+
+namespace NanSu
+{
+    bool EventCoalescer::Push(const Event& event)
+    {
+        EventLogRecord record;
+        if (!EncodeEventRecord(event, record))
+        {
+            return false;
+        }
+
+        if (!m_Pending.empty() && m_Pending.back().Type == record.Type)
+        {
+            EventLogRecord& last = m_Pending.back();
+
+            switch (event.GetEventType())
+            {
+                case EventType::MouseMoved:
+                case EventType::WindowResize:
+                    last = record;
+                    ++m_MergedCount;
+                    return true;
+
+                case EventType::MouseScrolled:
+                    last.A = std::bit_cast<uint32>(std::bit_cast<float32>(last.A) + std::bit_cast<float32>(record.A));
+                    last.B = std::bit_cast<uint32>(std::bit_cast<float32>(last.B) + std::bit_cast<float32>(record.B));
+                    ++m_MergedCount;
+                    return true;
+
+                default:
+                    break;
+            }
+        }
+
+        m_Pending.push_back(record);
+        return true;
+    }
+
+    void EventCoalescer::Flush(const EventCallbackFn& callback)
+    {
+        // Swap first: callbacks may push events (e.g. a layer closing the window)
+        while (!m_Pending.empty())
+        {
+            m_Dispatching.swap(m_Pending);
+            for (const EventLogRecord& record : m_Dispatching)
+            {
+                DispatchEventRecord(record, callback);
+            }
+            m_Dispatching.clear();
+        }
+    }
+
+} // namespace NanSu
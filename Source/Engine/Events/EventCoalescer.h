@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Events/Event.h"
+#include "Events/EventRecorder.h"
+
+#include <vector>
+
+namespace NanSu
+{
+    /**
+     * @brief Buffers a frame's window events and merges redundant runs
+     *
+     * The window pushes every event here instead of dispatching it, and the
+     * Application flushes the buffer once the window messages were pumped.
+     * A mouse move, scroll or resize that directly follows an event of the
+     * same type replaces it: moves and resizes keep the latest position or
+     * size, scrolls sum their offsets. Any other event in between ends the
+     * run, so the relative order of all events is preserved.
+     */
+    class EventCoalescer
+    {
+    public:
+        /**
+         * @brief Buffer an event, merging it into the previous one when possible
+         * @return false for events that cannot be buffered (engine-generated events)
+         */
+        bool Push(const Event& event);
+
+        /**
+         * @brief Dispatch the buffered events in order and clear the buffer
+         * Events pushed by the callback are dispatched in the same flush.
+         */
+        void Flush(const EventCallbackFn& callback);
+
+        usize GetPendingCount() const { return m_Pending.size(); }
+
+        /**
+         * @brief Number of events merged away since startup
+         */
+        uint64 GetMergedCount() const { return m_MergedCount; }
+
+    private:
+        std::vector<EventLogRecord> m_Pending;
+        std::vector<EventLogRecord> m_Dispatching;
+        uint64 m_MergedCount = 0;
+    };
+
+} // namespace NanSu
@@ -0,0 +1,63 @@
+#include "EnginePCH.h"
+#include "Events/EventPool.h"
+
+namespace NanSu
+{
+    namespace
+    {
+        constexpr usize SLOTS_PER_CHUNK = 32;
+    }
+
+    std::array<EventPool::FreeList, EVENT_TYPE_COUNT> EventPool::s_FreeLists;
+    uint32 EventPool::s_LiveCount = 0;
+
+    void* EventPool::AllocateSlot(EventType type, usize size)
+    {
+        FreeList& list = s_FreeLists[static_cast<uint32>(type)];
+
+        if (list.FreeSlots.empty())
+        {
+            // One class per EventType, so the first request fixes the slot size
+            if (list.SlotSize == 0)
+            {
+                list.SlotSize = (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+            }
+            NS_ENGINE_ASSERT(size <= list.SlotSize, "Pooled event larger than its slot");
+
+            list.Chunks.push_back(std::make_unique<std::byte[]>(list.SlotSize * SLOTS_PER_CHUNK));
+            std::byte* chunk = list.Chunks.back().get();
+            for (usize i = SLOTS_PER_CHUNK; i > 0; --i)
+            {
+                list.FreeSlots.push_back(chunk + (i - 1) * list.SlotSize);
+            }
+        }
+
+        void* slot = list.FreeSlots.back();
+        list.FreeSlots.pop_back();
+        ++s_LiveCount;
+        return slot;
+    }
+
+    void EventPool::Release(Event* event)
+    {
+        if (!event)
+        {
+            return;
+        }
+
+        FreeList& list = s_FreeLists[static_cast<uint32>(event->GetEventType())];
+        event->~Event();
+        list.FreeSlots.push_back(event);
+        --s_LiveCount;
+    }
+
+    void EventPool::Shutdown()
+    {
+        NS_ENGINE_ASSERT(s_LiveCount == 0, "Pooled events still alive at shutdown");
+
+        for (FreeList& list : s_FreeLists)
+        {
+            list = FreeList();
+        }
+    }
+}
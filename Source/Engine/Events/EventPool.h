@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Core/Assert.h"
+#include "Events/Event.h"
+#include "Events/EventRegistry.h"
+
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace NanSu
+{
+    /**
+     * @brief Per-type freelists for events that outlive the call that created them
+     *
+     * Events handed from one frame phase to another (EventBus::Enqueue(),
+     * deferred gameplay notifications) are constructed in recycled slots
+     * instead of individual heap allocations. Every EventType has its own
+     * freelist of fixed-size slots, grown in chunks and never shrunk, so a
+     * steady state allocates nothing. Main thread only.
+     *
+     * @code
+     * PooledEvent<KeyPressedEvent> event = EventPool::Acquire<KeyPressedEvent>(static_cast<int32>(KeyCode::Space), false);
+     * // ... released back to the pool when the PooledEvent goes out of scope
+     * @endcode
+     */
+    class EventPool
+    {
+    public:
+        struct Deleter
+        {
+            void operator()(Event* event) const { EventPool::Release(event); }
+        };
+
+        template<typename T>
+        using Ptr = std::unique_ptr<T, Deleter>;
+
+        /**
+         * @brief Construct an event in a pooled slot
+         */
+        template<typename T, typename... Args>
+        static Ptr<T> Acquire(Args&&... args)
+        {
+            static_assert(IsRegisteredEvent<T>, "Event class is not listed in EngineEventTypes");
+            static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned events are not supported");
+
+            void* slot = AllocateSlot(T::GetStaticType(), sizeof(T));
+            T* event = new (slot) T(std::forward<Args>(args)...);
+
+            // Release() returns the Event* as the slot address
+            NS_ENGINE_ASSERT(static_cast<void*>(static_cast<Event*>(event)) == slot, "Event base must start the object");
+            return Ptr<T>(event);
+        }
+
+        /**
+         * @brief Destroy a pooled event and return its slot to the freelist
+         */
+        static void Release(Event* event);
+
+        /**
+         * @brief Events currently acquired and not yet released
+         */
+        static uint32 GetLiveCount() { return s_LiveCount; }
+
+        /**
+         * @brief Free every chunk (no pooled event may be alive)
+         */
+        static void Shutdown();
+
+    private:
+        static void* AllocateSlot(EventType type, usize size);
+
+    private:
+        struct FreeList
+        {
+            usize SlotSize = 0;
+            std::vector<void*> FreeSlots;
+            std::vector<std::unique_ptr<std::byte[]>> Chunks;
+        };
+
+        static std::array<FreeList, EVENT_TYPE_COUNT> s_FreeLists;
+        static uint32 s_LiveCount;
+    };
+
+    template<typename T>
+    using PooledEvent = EventPool::Ptr<T>;
+
+} // namespace NanSu
@@ -0,0 +1,342 @@
+#include "EnginePCH.h"
+#include "Events/EventRecorder.h"
+#include "Events/KeyEvent.h"
+#include "Events/MouseEvent.h"
+#include "Events/WindowEvent.h"
+
+#include <bit>
+#include <cstring>
+
+namespace NanSu
+{
+    // =========================================================================
+    // Records
+    // =========================================================================
+
+    bool EncodeEventRecord(const Event& event, EventLogRecord& outRecord)
+    {
+        outRecord.Type = static_cast<uint32>(event.GetEventType());
+        outRecord.A = 0;
+        outRecord.B = 0;
+
+        switch (event.GetEventType())
+        {
+            case EventType::KeyPressed:
+            {
+                const auto& keyEvent = static_cast<const KeyPressedEvent&>(event);
+                outRecord.A = static_cast<uint32>(keyEvent.GetKeyCode());
+                outRecord.B = keyEvent.IsRepeat() ? 1 : 0;
+                return true;
+            }
+
+            case EventType::KeyReleased:
+            case EventType::KeyTyped:
+                outRecord.A = static_cast<uint32>(static_cast<const KeyEvent&>(event).GetKeyCode());
+                return true;
+
+            case EventType::MouseMoved:
+            {
+                const auto& moveEvent = static_cast<const MouseMovedEvent&>(event);
+                outRecord.A = std::bit_cast<uint32>(moveEvent.GetX());
+                outRecord.B = std::bit_cast<uint32>(moveEvent.GetY());
+                return true;
+            }
+
+            case EventType::MouseScrolled:
+            {
+                const auto& scrollEvent = static_cast<const MouseScrolledEvent&>(event);
+                outRecord.A = std::bit_cast<uint32>(scrollEvent.GetXOffset());
+                outRecord.B = std::bit_cast<uint32>(scrollEvent.GetYOffset());
+                return true;
+            }
+
+            case EventType::MouseButtonPressed:
+            case EventType::MouseButtonReleased:
+                outRecord.A = static_cast<uint32>(static_cast<const MouseButtonEvent&>(event).GetMouseButton());
+                return true;
+
+            case EventType::WindowResize:
+            {
+                const auto& resizeEvent = static_cast<const WindowResizeEvent&>(event);
+                outRecord.A = resizeEvent.GetWidth();
+                outRecord.B = resizeEvent.GetHeight();
+                return true;
+            }
+
+            case EventType::WindowClose:
+            case EventType::WindowFocus:
+            case EventType::WindowLostFocus:
+                return true;
+
+            default:
+                return false;
+        }
+    }
+
+    void DispatchEventRecord(const EventLogRecord& record, const EventCallbackFn& callback)
+    {
+        int32 code = static_cast<int32>(record.A);
+
+        switch (static_cast<EventType>(record.Type))
+        {
+            case EventType::KeyPressed:
+            {
+                KeyPressedEvent event(code, record.B != 0);
+                callback(event);
+                break;
+            }
+
+            case EventType::KeyReleased:
+            {
+                KeyReleasedEvent event(code);
+                callback(event);
+                break;
+            }
+
+            case EventType::KeyTyped:
+            {
+                KeyTypedEvent event(code);
+                callback(event);
+                break;
+            }
+
+            case EventType::MouseMoved:
+            {
+                MouseMovedEvent event(std::bit_cast<float32>(record.A), std::bit_cast<float32>(record.B));
+                callback(event);
+                break;
+            }
+
+            case EventType::MouseScrolled:
+            {
+                MouseScrolledEvent event(std::bit_cast<float32>(record.A), std::bit_cast<float32>(record.B));
+                callback(event);
+                break;
+            }
+
+            case EventType::MouseButtonPressed:
+            {
+                MouseButtonPressedEvent event(code);
+                callback(event);
+                break;
+            }
+
+            case EventType::MouseButtonReleased:
+            {
+                MouseButtonReleasedEvent event(code);
+                callback(event);
+                break;
+            }
+
+            case EventType::WindowResize:
+            {
+                WindowResizeEvent event(record.A, record.B);
+                callback(event);
+                break;
+            }
+
+            case EventType::WindowClose:
+            {
+                WindowCloseEvent event;
+                callback(event);
+                break;
+            }
+
+            case EventType::WindowFocus:
+            {
+                WindowFocusEvent event;
+                callback(event);
+                break;
+            }
+
+            case EventType::WindowLostFocus:
+            {
+                WindowLostFocusEvent event;
+                callback(event);
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    // =========================================================================
+    // EventRecorder
+    // =========================================================================
+
+    EventRecorder::~EventRecorder()
+    {
+        Stop();
+    }
+
+    bool EventRecorder::Start(const std::string& path)
+    {
+        Stop();
+
+        m_File.open(path, std::ios::binary | std::ios::trunc);
+        if (!m_File)
+        {
+            NS_ENGINE_ERROR("Failed to create event log: {}", path);
+            return false;
+        }
+
+        EventLogHeader header;
+        header.RecordSize = sizeof(EventLogRecord);
+        m_File.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        m_Path = path;
+        m_FrameEvents.clear();
+        m_FrameCount = 0;
+
+        NS_ENGINE_INFO("Recording events to {}", path);
+        return true;
+    }
+
+    void EventRecorder::Stop()
+    {
+        if (!m_File.is_open())
+        {
+            return;
+        }
+
+        m_File.close();
+        if (m_File.fail())
+        {
+            NS_ENGINE_ERROR("Failed to write event log: {}", m_Path);
+        }
+        else
+        {
+            NS_ENGINE_INFO("Recorded {} frames to {}", m_FrameCount, m_Path);
+        }
+
+        m_FrameEvents.clear();
+    }
+
+    void EventRecorder::Record(const Event& event)
+    {
+        if (!m_File.is_open())
+        {
+            return;
+        }
+
+        EventLogRecord record;
+        if (EncodeEventRecord(event, record))
+        {
+            m_FrameEvents.push_back(record);
+        }
+    }
+
+    void EventRecorder::EndFrame(float64 timestep, uint64 inputHash)
+    {
+        if (!m_File.is_open())
+        {
+            return;
+        }
+
+        EventLogFrame frame;
+        frame.Timestep = timestep;
+        frame.InputHash = inputHash;
+        frame.EventCount = static_cast<uint32>(m_FrameEvents.size());
+
+        m_File.write(reinterpret_cast<const char*>(&frame), sizeof(frame));
+        m_File.write(reinterpret_cast<const char*>(m_FrameEvents.data()),
+                     static_cast<std::streamsize>(m_FrameEvents.size() * sizeof(EventLogRecord)));
+
+        m_FrameEvents.clear();
+        ++m_FrameCount;
+    }
+
+    // =========================================================================
+    // EventReplayer
+    // =========================================================================
+
+    bool EventReplayer::Open(const std::string& path)
+    {
+        Close();
+
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+        {
+            NS_ENGINE_ERROR("Failed to open event log: {}", path);
+            return false;
+        }
+
+        std::vector<byte> data(static_cast<usize>(file.tellg()));
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size())))
+        {
+            NS_ENGINE_ERROR("Failed to read event log: {}", path);
+            return false;
+        }
+
+        EventLogHeader header;
+        if (data.size() < sizeof(header))
+        {
+            NS_ENGINE_ERROR("Event log is truncated: {}", path);
+            return false;
+        }
+
+        std::memcpy(&header, data.data(), sizeof(header));
+        if (header.Magic != EVENT_LOG_MAGIC || header.Version != EVENT_LOG_VERSION ||
+            header.RecordSize != sizeof(EventLogRecord))
+        {
+            NS_ENGINE_ERROR("Unsupported event log (version {}): {}", header.Version, path);
+            return false;
+        }
+
+        // Index every frame up front so replay does no parsing
+        usize offset = sizeof(header);
+        while (offset + sizeof(EventLogFrame) <= data.size())
+        {
+            EventLogFrame frame;
+            std::memcpy(&frame, data.data() + offset, sizeof(frame));
+            offset += sizeof(frame);
+
+            usize eventBytes = static_cast<usize>(frame.EventCount) * sizeof(EventLogRecord);
+            if (offset + eventBytes > data.size())
+            {
+                NS_ENGINE_WARN("Event log ends inside frame {}; replaying the complete frames", m_Frames.size());
+                break;
+            }
+
+            m_Frames.push_back({ frame.Timestep, frame.InputHash,
+                                 static_cast<uint32>(m_Events.size()), frame.EventCount });
+
+            usize firstEvent = m_Events.size();
+            m_Events.resize(firstEvent + frame.EventCount);
+            std::memcpy(m_Events.data() + firstEvent, data.data() + offset, eventBytes);
+            offset += eventBytes;
+        }
+
+        m_Replaying = true;
+        NS_ENGINE_INFO("Replaying {} frames ({} events) from {}", m_Frames.size(), m_Events.size(), path);
+        return true;
+    }
+
+    void EventReplayer::Close()
+    {
+        m_Frames.clear();
+        m_Events.clear();
+        m_FrameIndex = 0;
+        m_Replaying = false;
+    }
+
+    bool EventReplayer::NextFrame(const EventCallbackFn& callback)
+    {
+        if (!m_Replaying || m_FrameIndex >= m_Frames.size())
+        {
+            m_Replaying = false;
+            return false;
+        }
+
+        const Frame& frame = m_Frames[m_FrameIndex++];
+        for (uint32 i = 0; i < frame.EventCount; ++i)
+        {
+            DispatchEventRecord(m_Events[frame.FirstEvent + i], callback);
+        }
+
+        return true;
+    }
+
+} // namespace NanSu
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Events/Event.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace NanSu
+{
+    // =========================================================================
+    // Event Log Format (.nsevents)
+    // =========================================================================
+    //
+    // Binary capture of a session's window events, written by EventRecorder
+    // and fed back frame by frame by EventReplayer.
+    //
+    // File layout:
+    //   [EventLogHeader]
+    //   Per frame, until the end of the file:
+    //     [EventLogFrame]
+    //     [EventLogRecord x EventCount]   events delivered before the frame began
+    //
+    // Records store the EventType value, so reordering EventType requires a
+    // version bump. All fields are little-endian.
+    // =========================================================================
+
+    constexpr uint32 EVENT_LOG_MAGIC = 0x5645534E;     // "NSEV" (little-endian)
+    constexpr uint32 EVENT_LOG_VERSION = 1;
+    constexpr const char* EVENT_LOG_EXTENSION = ".nsevents";
+
+    /**
+     * @brief Header at the start of every event log
+     */
+    struct EventLogHeader
+    {
+        uint32 Magic = EVENT_LOG_MAGIC;
+        uint32 Version = EVENT_LOG_VERSION;
+        uint32 RecordSize = 0;          // sizeof(EventLogRecord) when written
+        uint32 Reserved = 0;
+    };
+
+    /**
+     * @brief One main loop iteration
+     */
+    struct EventLogFrame
+    {
+        float64 Timestep = 0.0;         // Seconds simulated by the frame
+        uint64 InputHash = 0;           // InputState::ComputeHash() after the frame's events
+        uint32 EventCount = 0;
+        uint32 Reserved = 0;
+    };
+
+    /**
+     * @brief One event; the meaning of A and B depends on the type
+     *
+     * Keys and buttons store their code in A (B = repeat flag for key
+     * presses), mouse moves and scrolls store float bits in A and B and
+     * resizes store width and height.
+     */
+    struct EventLogRecord
+    {
+        uint32 Type = 0;                // EventType
+        uint32 A = 0;
+        uint32 B = 0;
+    };
+
+    static_assert(sizeof(EventLogHeader) == 16, "EventLogHeader layout changed");
+    static_assert(sizeof(EventLogFrame) == 24, "EventLogFrame layout changed");
+    static_assert(sizeof(EventLogRecord) == 12, "EventLogRecord layout changed");
+
+    /**
+     * @brief Encode a window or input event as a log record
+     * @return false for events that are not recorded (engine-generated events)
+     */
+    bool EncodeEventRecord(const Event& event, EventLogRecord& outRecord);
+
+    /**
+     * @brief Rebuild the event of a log record and pass it to the callback
+     */
+    void DispatchEventRecord(const EventLogRecord& record, const EventCallbackFn& callback);
+
+    /**
+     * @brief Writes the events and timestep of every frame to an event log
+     *
+     * The Application records each window event as it is dispatched and
+     * closes the frame once its input snapshot was published. Events of the
+     * current frame are buffered and written with one call per frame.
+     * Engine-generated events (AppUpdate, ...) are not recorded.
+     */
+    class EventRecorder
+    {
+    public:
+        EventRecorder() = default;
+        ~EventRecorder();
+
+        EventRecorder(const EventRecorder&) = delete;
+        EventRecorder& operator=(const EventRecorder&) = delete;
+
+        /**
+         * @brief Create the log file and start recording
+         * @return false if the file could not be created
+         */
+        bool Start(const std::string& path);
+
+        /**
+         * @brief Flush and close the log
+         */
+        void Stop();
+
+        bool IsRecording() const { return m_File.is_open(); }
+
+        /**
+         * @brief Buffer an event for the current frame
+         */
+        void Record(const Event& event);
+
+        /**
+         * @brief Write the current frame and its buffered events
+         * @param timestep Seconds simulated by the frame
+         * @param inputHash Hash of the frame's input snapshot, checked on replay
+         */
+        void EndFrame(float64 timestep, uint64 inputHash);
+
+        uint64 GetFrameCount() const { return m_FrameCount; }
+
+    private:
+        std::ofstream m_File;
+        std::string m_Path;
+        std::vector<EventLogRecord> m_FrameEvents;
+        uint64 m_FrameCount = 0;
+    };
+
+    /**
+     * @brief Plays an event log back one frame per main loop iteration
+     *
+     * The whole log is loaded and validated up front, so replaying a frame
+     * does no I/O: NextFrame() rebuilds the recorded events and hands them
+     * to the callback in their original order.
+     */
+    class EventReplayer
+    {
+    public:
+        /**
+         * @brief Load an event log and rewind to its first frame
+         * @return false if the file is missing, truncated or of another version
+         */
+        bool Open(const std::string& path);
+
+        void Close();
+
+        bool IsReplaying() const { return m_Replaying; }
+
+        /**
+         * @brief Dispatch the events of the next frame
+         * @return false once every frame was replayed (the replay closes itself)
+         */
+        bool NextFrame(const EventCallbackFn& callback);
+
+        /**
+         * @brief Check whether NextFrame() has replayed a frame since Open()
+         *
+         * A replay can be opened mid-frame (e.g. from an event handler); the
+         * frame getters below have nothing to report until the next frame.
+         */
+        bool HasCurrentFrame() const { return m_FrameIndex > 0 && m_FrameIndex <= m_Frames.size(); }
+
+        /**
+         * @brief Recorded timestep of the frame returned by the last NextFrame()
+         * @return 0 if no frame was replayed yet
+         */
+        float64 GetTimestep() const { return HasCurrentFrame() ? m_Frames[m_FrameIndex - 1].Timestep : 0.0; }
+
+        /**
+         * @brief Recorded input hash of the frame returned by the last NextFrame()
+         * @return 0 if no frame was replayed yet
+         */
+        uint64 GetInputHash() const { return HasCurrentFrame() ? m_Frames[m_FrameIndex - 1].InputHash : 0; }
+
+        uint64 GetFrameIndex() const { return m_FrameIndex; }
+        uint64 GetFrameCount() const { return m_Frames.size(); }
+
+    private:
+        struct Frame
+        {
+            float64 Timestep;
+            uint64 InputHash;
+            uint32 FirstEvent;
+            uint32 EventCount;
+        };
+
+        std::vector<Frame> m_Frames;
+        std::vector<EventLogRecord> m_Events;
+        uint64 m_FrameIndex = 0;
+        bool m_Replaying = false;
+    };
+
+} // namespace NanSu
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Events/Event.h"
+#include "Events/ApplicationEvent.h"
+#include "Events/WindowEvent.h"
+#include "Events/KeyEvent.h"
+#include "Events/MouseEvent.h"
+
+#include <array>
+#include <type_traits>
+
+namespace NanSu
+{
+    // =========================================================================
+    // Event Type List
+    // =========================================================================
+
+    template<typename... Ts>
+    struct EventTypeList
+    {
+        static constexpr usize Count = sizeof...(Ts);
+
+        template<typename T>
+        static constexpr bool Contains = (std::is_same_v<T, Ts> || ...);
+
+        static constexpr EventTypeMask Mask = EventTypeMask::Of<Ts...>();
+    };
+
+    /**
+     * @brief Every concrete engine event, one per EventType value
+     *
+     * Adding an EventType requires adding its class here; the tables below
+     * are generated from this list and checked against the enum.
+     */
+    using EngineEventTypes = EventTypeList<
+        AppInitEvent, AppShutdownEvent, AppUpdateEvent,
+        WindowCloseEvent, WindowResizeEvent, WindowFocusEvent, WindowLostFocusEvent,
+        KeyPressedEvent, KeyReleasedEvent, KeyTypedEvent,
+        MouseMovedEvent, MouseScrolledEvent, MouseButtonPressedEvent, MouseButtonReleasedEvent>;
+
+    static_assert(EngineEventTypes::Count == EVENT_TYPE_COUNT - 1, "EngineEventTypes must list one class per EventType");
+    static_assert(EngineEventTypes::Mask == EventTypeMask::All(), "EngineEventTypes must cover every EventType");
+
+    template<typename T>
+    constexpr bool IsRegisteredEvent = EngineEventTypes::Contains<T>;
+
+    // =========================================================================
+    // Generated Tables
+    // =========================================================================
+
+    namespace EventRegistryDetail
+    {
+        template<typename... Ts>
+        constexpr std::array<uint32, EVENT_TYPE_COUNT> BuildCategoryTable(EventTypeList<Ts...>)
+        {
+            std::array<uint32, EVENT_TYPE_COUNT> table = {};
+            ((table[static_cast<uint32>(Ts::GetStaticType())] = Ts::GetStaticCategoryFlags()), ...);
+            return table;
+        }
+    }
+
+    /**
+     * @brief Category flags of each EventType, indexed by the EventType value
+     */
+    constexpr std::array<uint32, EVENT_TYPE_COUNT> EVENT_CATEGORY_TABLE =
+        EventRegistryDetail::BuildCategoryTable(EngineEventTypes{});
+
+    /**
+     * @brief Event types belonging to any of the given categories
+     */
+    constexpr EventTypeMask EventTypesInCategory(uint32 categories)
+    {
+        EventTypeMask mask;
+        for (uint32 type = 1; type < EVENT_TYPE_COUNT; ++type)
+        {
+            if (EVENT_CATEGORY_TABLE[type] & categories)
+            {
+                mask.Add(static_cast<EventType>(type));
+            }
+        }
+        return mask;
+    }
+
+} // namespace NanSu
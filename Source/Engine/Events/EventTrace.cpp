@@ -0,0 +1,31 @@
+#include "EnginePCH.h"
+#include "Events/EventTrace.h"
+
+namespace NanSu
+{
+    void TraceEvent(const Event& event)
+    {
+        if (!Logger::GetEngineLogger()->should_log(spdlog::level::trace))
+        {
+            return;
+        }
+
+        EventLogRecord record;
+        if (EncodeEventRecord(event, record))
+        {
+            NS_ENGINE_TRACE("[Event] {}", record);
+        }
+        else
+        {
+            NS_ENGINE_TRACE("[Event] {}", event.GetName());
+        }
+    }
+}
+
+fmt::format_context::iterator fmt::formatter<NanSu::EventLogRecord>::format(const NanSu::EventLogRecord& record,
+                                                                            fmt::format_context& context) const
+{
+    std::string text;
+    NanSu::DispatchEventRecord(record, [&text](NanSu::Event& event) { text = event.ToString(); });
+    return fmt::formatter<fmt::string_view>::format(fmt::string_view(text), context);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Core/Logger.h"
+#include "Events/Event.h"
+#include "Events/EventRecorder.h"
+
+namespace NanSu
+{
+    /**
+     * @brief Log an event at trace level without formatting it on the calling thread
+     *
+     * Window and input events are logged as their 12-byte EventLogRecord;
+     * the record is turned back into the event and its ToString() only when
+     * the logger backend writes the message. Other events log their name.
+     */
+    void TraceEvent(const Event& event);
+
+    namespace LogDetail
+    {
+        template <>
+        inline constexpr bool IsRawLoggable<EventLogRecord> = true;
+    }
+}
+
+/**
+ * @brief Formats an event record as the ToString() of the event it encodes
+ */
+template <>
+struct fmt::formatter<NanSu::EventLogRecord> : fmt::formatter<fmt::string_view>
+{
+    fmt::format_context::iterator format(const NanSu::EventLogRecord& record, fmt::format_context& context) const;
+};
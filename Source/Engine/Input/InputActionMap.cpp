@@ -0,0 +1,161 @@
+#include "EnginePCH.h"
+#include "Input/InputActionMap.h"
+
+namespace NanSu
+{
+    namespace
+    {
+        // Keys and mouse buttons share one index space in the compiled table
+        constexpr uint32 MOUSE_INPUT_BASE = InputState::KEY_COUNT;
+        constexpr uint32 INVALID_INPUT_INDEX = Limits::UInt32Max;
+
+        uint32 ToInputIndex(const InputSource& source)
+        {
+            uint32 code = static_cast<uint32>(source.Code);  // Unknown (-1) wraps out of range
+
+            if (source.Type == InputSource::Device::Keyboard)
+            {
+                return code < InputState::KEY_COUNT ? code : INVALID_INPUT_INDEX;
+            }
+
+            return code < InputState::MOUSE_BUTTON_COUNT ? MOUSE_INPUT_BASE + code : INVALID_INPUT_INDEX;
+        }
+    }
+
+    // =========================================================================
+    // Actions
+    // =========================================================================
+
+    InputActionID InputActionMap::AddAction(std::string_view name)
+    {
+        if (InputActionID existing = FindAction(name); existing != INVALID_INPUT_ACTION)
+        {
+            return existing;
+        }
+
+        InputActionID id = static_cast<InputActionID>(m_Actions.size());
+        m_Actions.push_back({ std::string(name), {} });
+        m_ActionLookup.emplace(std::string(name), id);
+
+        m_Values.push_back(0.0f);
+        m_PreviousValues.push_back(0.0f);
+        return id;
+    }
+
+    InputActionID InputActionMap::FindAction(std::string_view name) const
+    {
+        auto it = m_ActionLookup.find(name);
+        return it != m_ActionLookup.end() ? it->second : INVALID_INPUT_ACTION;
+    }
+
+    // =========================================================================
+    // Bindings
+    // =========================================================================
+
+    void InputActionMap::Bind(InputActionID action, std::initializer_list<InputSource> chord, float32 scale)
+    {
+        NS_ENGINE_ASSERT(action < m_Actions.size(), "Invalid input action id");
+        NS_ENGINE_ASSERT(chord.size() > 0 && chord.size() <= MAX_CHORD_SIZE,
+                         "Input chords need 1 to {} inputs", MAX_CHORD_SIZE);
+
+        Binding binding;
+        for (const InputSource& source : chord)
+        {
+            if (ToInputIndex(source) == INVALID_INPUT_INDEX)
+            {
+                NS_ENGINE_WARN("Input action '{}': ignoring binding with an unknown input", m_Actions[action].Name);
+                return;
+            }
+            binding.Inputs[binding.InputCount++] = source;
+        }
+        binding.Scale = scale;
+
+        m_Actions[action].Bindings.push_back(binding);
+        m_Dirty = true;
+    }
+
+    void InputActionMap::BindAxis(InputActionID action, InputSource negative, InputSource positive)
+    {
+        Bind(action, { negative }, -1.0f);
+        Bind(action, { positive }, 1.0f);
+    }
+
+    void InputActionMap::ClearBindings(InputActionID action)
+    {
+        NS_ENGINE_ASSERT(action < m_Actions.size(), "Invalid input action id");
+
+        m_Actions[action].Bindings.clear();
+        m_Dirty = true;
+    }
+
+    void InputActionMap::Rebind(InputActionID action, std::initializer_list<InputSource> chord, float32 scale)
+    {
+        ClearBindings(action);
+        Bind(action, chord, scale);
+    }
+
+    void InputActionMap::Compile()
+    {
+        m_CompiledBindings.clear();
+        m_CompiledInputs.clear();
+
+        for (InputActionID id = 0; id < m_Actions.size(); ++id)
+        {
+            for (const Binding& binding : m_Actions[id].Bindings)
+            {
+                CompiledBinding compiled;
+                compiled.FirstInput = static_cast<uint32>(m_CompiledInputs.size());
+                compiled.InputCount = binding.InputCount;
+                compiled.Action = id;
+                compiled.Scale = binding.Scale;
+                m_CompiledBindings.push_back(compiled);
+
+                for (uint32 i = 0; i < binding.InputCount; ++i)
+                {
+                    m_CompiledInputs.push_back(static_cast<uint16>(ToInputIndex(binding.Inputs[i])));
+                }
+            }
+        }
+
+        m_Dirty = false;
+    }
+
+    // =========================================================================
+    // Evaluation
+    // =========================================================================
+
+    void InputActionMap::Update(const InputState& state)
+    {
+        if (m_Dirty)
+        {
+            Compile();
+        }
+
+        m_PreviousValues.swap(m_Values);
+        std::fill(m_Values.begin(), m_Values.end(), 0.0f);
+
+        const uint16* inputs = m_CompiledInputs.data();
+        for (const CompiledBinding& binding : m_CompiledBindings)
+        {
+            bool held = true;
+            for (uint32 i = 0; i < binding.InputCount && held; ++i)
+            {
+                uint32 index = inputs[binding.FirstInput + i];
+                held = index < MOUSE_INPUT_BASE
+                    ? state.IsKeyDown(static_cast<KeyCode>(index))
+                    : state.IsMouseButtonDown(static_cast<MouseCode>(index - MOUSE_INPUT_BASE));
+            }
+
+            if (held)
+            {
+                m_Values[binding.Action] += binding.Scale;
+            }
+        }
+
+        for (float32& value : m_Values)
+        {
+            value = std::clamp(value, -1.0f, 1.0f);
+        }
+    }
+
+} // namespace NanSu
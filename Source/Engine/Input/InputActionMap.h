@@ -0,0 +1,197 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Input/InputState.h"
+
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace NanSu
+{
+    /**
+     * @brief Dense index of an action within its InputActionMap
+     */
+    using InputActionID = uint32;
+
+    constexpr InputActionID INVALID_INPUT_ACTION = Limits::UInt32Max;
+
+    /**
+     * @brief A single key or mouse button that can take part in a binding
+     *
+     * Converts implicitly from KeyCode and MouseCode, so chords can be
+     * written as { KeyCode::LeftControl, KeyCode::S }.
+     */
+    struct InputSource
+    {
+        enum class Device : uint8
+        {
+            Keyboard = 0,
+            Mouse
+        };
+
+        Device Type = Device::Keyboard;
+        int32 Code = -1;
+
+        InputSource(KeyCode key) : Type(Device::Keyboard), Code(static_cast<int32>(key)) {}
+        InputSource(MouseCode button) : Type(Device::Mouse), Code(static_cast<int32>(button)) {}
+
+        bool operator==(const InputSource& other) const = default;
+    };
+
+    /**
+     * @brief Named actions and axes bound to key/mouse chords, evaluated once per frame
+     *
+     * Actions are registered by name and referred to by the InputActionID
+     * returned at registration (look it up once, not per frame). Each
+     * binding is a chord of up to MAX_CHORD_SIZE inputs that must all be
+     * held, contributing its scale to the action value: buttons use 1, axes
+     * bind a negative and a positive side. Values are summed and clamped to
+     * [-1, 1].
+     *
+     * Bindings are compiled into one flat table of input bit indices the
+     * first time Update() runs after a change, so evaluating the whole map is
+     * a linear pass of bit tests over InputState and all results land in a
+     * dense value array. Rebinding only marks the table for recompilation.
+     *
+     * Example usage:
+     * @code
+     * InputActionMap actions;
+     * InputActionID moveX = actions.AddAction("MoveX");
+     * actions.BindAxis(moveX, KeyCode::A, KeyCode::D);
+     * InputActionID save = actions.AddAction("Save");
+     * actions.Bind(save, { KeyCode::LeftControl, KeyCode::S });
+     *
+     * // Once per frame:
+     * actions.Update(Input::GetState());
+     * position.x += actions.GetValue(moveX) * speed;
+     * if (actions.WasPressed(save))
+     *     SaveScene();
+     * @endcode
+     */
+    class InputActionMap
+    {
+    public:
+        static constexpr uint32 MAX_CHORD_SIZE = 4;
+
+        // =====================================================================
+        // Actions
+        // =====================================================================
+
+        /**
+         * @brief Register an action (returns the existing id if the name is taken)
+         */
+        InputActionID AddAction(std::string_view name);
+
+        /**
+         * @brief Look up an action by name
+         * @return The action id, or INVALID_INPUT_ACTION
+         */
+        InputActionID FindAction(std::string_view name) const;
+
+        const std::string& GetActionName(InputActionID action) const { return m_Actions[action].Name; }
+        uint32 GetActionCount() const { return static_cast<uint32>(m_Actions.size()); }
+
+        // =====================================================================
+        // Bindings
+        // =====================================================================
+
+        /**
+         * @brief Add a chord that drives the action while all its inputs are held
+         * @param action The action to bind
+         * @param chord Inputs that must be held together (1 to MAX_CHORD_SIZE)
+         * @param scale Value contributed while the chord is held
+         */
+        void Bind(InputActionID action, std::initializer_list<InputSource> chord, float32 scale = 1.0f);
+
+        /**
+         * @brief Bind both sides of an axis (-1 while negative is held, +1 for positive)
+         */
+        void BindAxis(InputActionID action, InputSource negative, InputSource positive);
+
+        /**
+         * @brief Remove all bindings of an action
+         */
+        void ClearBindings(InputActionID action);
+
+        /**
+         * @brief Replace all bindings of an action with a single chord
+         */
+        void Rebind(InputActionID action, std::initializer_list<InputSource> chord, float32 scale = 1.0f);
+
+        // =====================================================================
+        // Evaluation
+        // =====================================================================
+
+        /**
+         * @brief Evaluate every action against this frame's input snapshot
+         */
+        void Update(const InputState& state);
+
+        /**
+         * @brief Action value in [-1, 1] (0 = inactive)
+         */
+        float32 GetValue(InputActionID action) const { return m_Values[action]; }
+
+        bool IsActive(InputActionID action) const { return m_Values[action] != 0.0f; }
+
+        /**
+         * @brief Action became active this frame
+         */
+        bool WasPressed(InputActionID action) const { return m_Values[action] != 0.0f && m_PreviousValues[action] == 0.0f; }
+
+        /**
+         * @brief Action became inactive this frame
+         */
+        bool WasReleased(InputActionID action) const { return m_Values[action] == 0.0f && m_PreviousValues[action] != 0.0f; }
+
+    private:
+        struct Binding
+        {
+            InputSource Inputs[MAX_CHORD_SIZE] = { KeyCode::Unknown, KeyCode::Unknown, KeyCode::Unknown, KeyCode::Unknown };
+            uint32 InputCount = 0;
+            float32 Scale = 1.0f;
+        };
+
+        struct Action
+        {
+            std::string Name;
+            std::vector<Binding> Bindings;
+        };
+
+        // Flat evaluation table: a binding's inputs are CompiledInputs[FirstInput, FirstInput + InputCount)
+        struct CompiledBinding
+        {
+            uint32 FirstInput;
+            uint32 InputCount;
+            InputActionID Action;
+            float32 Scale;
+        };
+
+        /**
+         * @brief Rebuild the flat evaluation table from the bindings
+         */
+        void Compile();
+
+    private:
+        // Transparent hash so FindAction() can look up string_views without allocating
+        struct NameHash
+        {
+            using is_transparent = void;
+            usize operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+        };
+
+        std::vector<Action> m_Actions;
+        std::unordered_map<std::string, InputActionID, NameHash, std::equal_to<>> m_ActionLookup;
+
+        std::vector<CompiledBinding> m_CompiledBindings;
+        std::vector<uint16> m_CompiledInputs;   // Key index, or KEY_COUNT + mouse button
+        bool m_Dirty = true;
+
+        std::vector<float32> m_Values;
+        std::vector<float32> m_PreviousValues;
+    };
+
+} // namespace NanSu
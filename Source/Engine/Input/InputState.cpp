@@ -0,0 +1,158 @@
+#include "EnginePCH.h"
+#include "Input/InputState.h"
+#include "Events/KeyEvent.h"
+#include "Events/MouseEvent.h"
+
+#include <bit>
+
+namespace NanSu
+{
+    template<usize N>
+    void InputState::SetDown(std::bitset<N>& down, std::bitset<N>& pressed, int32 code)
+    {
+        uint32 index = static_cast<uint32>(code);
+        if (index >= N || down.test(index))
+        {
+            return;  // Unknown key or auto-repeat
+        }
+
+        down.set(index);
+        pressed.set(index);
+    }
+
+    template<usize N>
+    void InputState::SetUp(std::bitset<N>& down, std::bitset<N>& released, int32 code)
+    {
+        uint32 index = static_cast<uint32>(code);
+        if (index >= N || !down.test(index))
+        {
+            return;
+        }
+
+        down.reset(index);
+        released.set(index);
+    }
+
+    void InputState::OnEvent(const Event& event)
+    {
+        switch (event.GetEventType())
+        {
+            case EventType::KeyPressed:
+            {
+                const auto& keyEvent = static_cast<const KeyPressedEvent&>(event);
+                SetDown(m_Pending.Keys, m_Pending.KeysPressed, keyEvent.GetKeyCode());
+                break;
+            }
+
+            case EventType::KeyReleased:
+            {
+                const auto& keyEvent = static_cast<const KeyReleasedEvent&>(event);
+                SetUp(m_Pending.Keys, m_Pending.KeysReleased, keyEvent.GetKeyCode());
+                break;
+            }
+
+            case EventType::MouseButtonPressed:
+            {
+                const auto& buttonEvent = static_cast<const MouseButtonPressedEvent&>(event);
+                SetDown(m_Pending.Buttons, m_Pending.ButtonsPressed, buttonEvent.GetMouseButton());
+                break;
+            }
+
+            case EventType::MouseButtonReleased:
+            {
+                const auto& buttonEvent = static_cast<const MouseButtonReleasedEvent&>(event);
+                SetUp(m_Pending.Buttons, m_Pending.ButtonsReleased, buttonEvent.GetMouseButton());
+                break;
+            }
+
+            case EventType::MouseMoved:
+            {
+                const auto& moveEvent = static_cast<const MouseMovedEvent&>(event);
+                vec2 position(moveEvent.GetX(), moveEvent.GetY());
+
+                // The first position only establishes the origin of the deltas
+                if (m_HasMousePosition)
+                {
+                    m_Pending.MouseDelta += position - m_Pending.MousePosition;
+                }
+                m_Pending.MousePosition = position;
+                m_HasMousePosition = true;
+                break;
+            }
+
+            case EventType::MouseScrolled:
+            {
+                const auto& scrollEvent = static_cast<const MouseScrolledEvent&>(event);
+                m_Pending.ScrollDelta += vec2(scrollEvent.GetXOffset(), scrollEvent.GetYOffset());
+                break;
+            }
+
+            case EventType::WindowLostFocus:
+            {
+                // Key-up messages go to the newly focused window
+                ReleaseAll();
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    void InputState::BeginFrame()
+    {
+        m_Frame = m_Pending;
+
+        // Held state and position carry over; edges and deltas start empty
+        m_Pending.KeysPressed.reset();
+        m_Pending.KeysReleased.reset();
+        m_Pending.ButtonsPressed.reset();
+        m_Pending.ButtonsReleased.reset();
+        m_Pending.MouseDelta = vec2(0.0f);
+        m_Pending.ScrollDelta = vec2(0.0f);
+    }
+
+    uint64 InputState::ComputeHash() const
+    {
+        // FNV-1a over the indices of held inputs and the cursor bits
+        uint64 hash = 0xCBF29CE484222325ull;
+        auto mix = [&hash](uint32 value)
+        {
+            for (uint32 shift = 0; shift < 32; shift += 8)
+            {
+                hash ^= (value >> shift) & 0xFF;
+                hash *= 0x100000001B3ull;
+            }
+        };
+
+        for (uint32 key = 0; key < KEY_COUNT; ++key)
+        {
+            if (m_Frame.Keys.test(key))
+            {
+                mix(key);
+            }
+        }
+
+        for (uint32 button = 0; button < MOUSE_BUTTON_COUNT; ++button)
+        {
+            if (m_Frame.Buttons.test(button))
+            {
+                mix(KEY_COUNT + button);
+            }
+        }
+
+        mix(std::bit_cast<uint32>(m_Frame.MousePosition.x));
+        mix(std::bit_cast<uint32>(m_Frame.MousePosition.y));
+        return hash;
+    }
+
+    void InputState::ReleaseAll()
+    {
+        m_Pending.KeysReleased |= m_Pending.Keys;
+        m_Pending.Keys.reset();
+
+        m_Pending.ButtonsReleased |= m_Pending.Buttons;
+        m_Pending.Buttons.reset();
+    }
+
+} // namespace NanSu
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Core/Math.h"
+#include "Input/KeyCodes.h"
+#include "Input/MouseCodes.h"
+
+#include <bitset>
+
+namespace NanSu
+{
+    // Forward declarations
+    class Event;
+
+    /**
+     * @brief Keyboard and mouse state snapshot, built from window events once per frame
+     *
+     * Window events update a pending copy of the state as they arrive.
+     * BeginFrame() publishes it as the frame snapshot that all queries read,
+     * so every layer sees the same answers for the whole frame and a query
+     * is a single bit test with no OS call.
+     *
+     * Edge queries report transitions that happened since the previous
+     * frame, including a press and release that both arrived within one
+     * frame. Losing window focus releases everything, so keys held while
+     * switching windows do not stay stuck.
+     *
+     * Example usage:
+     * @code
+     * const InputState& input = Input::GetState();
+     * if (input.IsKeyDown(KeyCode::W))
+     *     MoveForward();
+     * if (input.WasKeyPressedThisFrame(KeyCode::Space))
+     *     Jump();
+     * @endcode
+     */
+    class InputState
+    {
+    public:
+        // KeyCode values follow the GLFW layout and stay below this bound
+        static constexpr uint32 KEY_COUNT = 512;
+        static constexpr uint32 MOUSE_BUTTON_COUNT = 8;
+
+        // =====================================================================
+        // Frame Update
+        // =====================================================================
+
+        /**
+         * @brief Update the pending state from a window event
+         */
+        void OnEvent(const Event& event);
+
+        /**
+         * @brief Publish the pending state as this frame's snapshot
+         * Call once per frame after window messages were processed.
+         */
+        void BeginFrame();
+
+        /**
+         * @brief Release all keys and buttons (e.g. on focus loss)
+         */
+        void ReleaseAll();
+
+        // =====================================================================
+        // Keyboard
+        // =====================================================================
+
+        bool IsKeyDown(KeyCode key) const { return Test(m_Frame.Keys, key); }
+
+        /**
+         * @brief Key went down since the previous frame (repeats are ignored)
+         */
+        bool WasKeyPressedThisFrame(KeyCode key) const { return Test(m_Frame.KeysPressed, key); }
+
+        /**
+         * @brief Key went up since the previous frame
+         */
+        bool WasKeyReleased(KeyCode key) const { return Test(m_Frame.KeysReleased, key); }
+
+        // =====================================================================
+        // Mouse
+        // =====================================================================
+
+        bool IsMouseButtonDown(MouseCode button) const { return Test(m_Frame.Buttons, button); }
+        bool WasMouseButtonPressedThisFrame(MouseCode button) const { return Test(m_Frame.ButtonsPressed, button); }
+        bool WasMouseButtonReleased(MouseCode button) const { return Test(m_Frame.ButtonsReleased, button); }
+
+        /**
+         * @brief Cursor position in client coordinates
+         */
+        const vec2& GetMousePosition() const { return m_Frame.MousePosition; }
+
+        /**
+         * @brief Cursor movement accumulated over the frame's events
+         */
+        const vec2& GetMouseDelta() const { return m_Frame.MouseDelta; }
+
+        /**
+         * @brief Wheel offsets accumulated over the frame's events
+         */
+        const vec2& GetScrollDelta() const { return m_Frame.ScrollDelta; }
+
+        /**
+         * @brief Hash of the held keys, buttons and cursor position of this frame
+         * Identical on every platform; used to check that a replay matches its recording.
+         */
+        uint64 ComputeHash() const;
+
+    private:
+        struct Snapshot
+        {
+            std::bitset<KEY_COUNT> Keys;
+            std::bitset<KEY_COUNT> KeysPressed;
+            std::bitset<KEY_COUNT> KeysReleased;
+
+            std::bitset<MOUSE_BUTTON_COUNT> Buttons;
+            std::bitset<MOUSE_BUTTON_COUNT> ButtonsPressed;
+            std::bitset<MOUSE_BUTTON_COUNT> ButtonsReleased;
+
+            vec2 MousePosition = vec2(0.0f);
+            vec2 MouseDelta = vec2(0.0f);
+            vec2 ScrollDelta = vec2(0.0f);
+        };
+
+        template<usize N, typename TCode>
+        static bool Test(const std::bitset<N>& bits, TCode code)
+        {
+            uint32 index = static_cast<uint32>(code);  // Unknown (-1) wraps out of range
+            return index < N && bits.test(index);
+        }
+
+        template<usize N>
+        static void SetDown(std::bitset<N>& down, std::bitset<N>& pressed, int32 code);
+
+        template<usize N>
+        static void SetUp(std::bitset<N>& down, std::bitset<N>& released, int32 code);
+
+    private:
+        Snapshot m_Frame;       // Read by queries
+        Snapshot m_Pending;     // Written by events
+        bool m_HasMousePosition = false;
+    };
+
+} // namespace NanSu
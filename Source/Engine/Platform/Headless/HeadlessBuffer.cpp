@@ -0,0 +1,38 @@
+#include "EnginePCH.h"
+#include "Platform/Headless/HeadlessBuffer.h"
+
+namespace NanSu
+{
+#ifndef NS_PLATFORM_WINDOWS
+    // =========================================================================
+    // Factory Method Implementations
+    // =========================================================================
+
+    VertexBuffer* VertexBuffer::Create(const void* vertices, uint32 size)
+    {
+        return new HeadlessVertexBuffer(size, false);
+    }
+
+    VertexBuffer* VertexBuffer::CreateDynamic(uint32 size)
+    {
+        return new HeadlessVertexBuffer(size, true);
+    }
+
+    IndexBuffer* IndexBuffer::Create(const uint32* indices, uint32 count)
+    {
+        return new HeadlessIndexBuffer(count);
+    }
+#endif
+
+    // =========================================================================
+    // HeadlessVertexBuffer
+    // =========================================================================
+
+    void HeadlessVertexBuffer::SetData(const void* data, uint32 size)
+    {
+        // Same contract as the GPU backends, so misuse fails on CI as well
+        NS_ENGINE_ASSERT(m_IsDynamic, "Cannot update static vertex buffer");
+        NS_ENGINE_ASSERT(size <= m_Size, "Data size exceeds buffer capacity");
+    }
+
+}
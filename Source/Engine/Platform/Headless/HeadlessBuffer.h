@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Renderer/Buffer.h"
+
+namespace NanSu
+{
+    /**
+     * @brief Vertex buffer for headless runs; data is validated and discarded
+     */
+    class HeadlessVertexBuffer : public VertexBuffer
+    {
+    public:
+        HeadlessVertexBuffer(uint32 size, bool isDynamic)
+            : m_Size(size), m_IsDynamic(isDynamic) {}
+        ~HeadlessVertexBuffer() override = default;
+
+        void Bind() const override {}
+        void Unbind() const override {}
+
+        void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+        const BufferLayout& GetLayout() const override { return m_Layout; }
+
+        void SetData(const void* data, uint32 size) override;
+
+    private:
+        BufferLayout m_Layout;
+        uint32 m_Size = 0;
+        bool m_IsDynamic = false;
+    };
+
+    /**
+     * @brief Index buffer for headless runs; only the index count is kept
+     */
+    class HeadlessIndexBuffer : public IndexBuffer
+    {
+    public:
+        explicit HeadlessIndexBuffer(uint32 count)
+            : m_Count(count) {}
+        ~HeadlessIndexBuffer() override = default;
+
+        void Bind() const override {}
+        void Unbind() const override {}
+        uint32 GetCount() const override { return m_Count; }
+
+    private:
+        uint32 m_Count = 0;
+    };
+
+}
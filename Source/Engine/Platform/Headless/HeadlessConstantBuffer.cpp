@@ -0,0 +1,43 @@
+#include "EnginePCH.h"
+#include "Platform/Headless/HeadlessConstantBuffer.h"
+
+#include <cstring>
+
+namespace NanSu
+{
+#ifndef NS_PLATFORM_WINDOWS
+    // Factory method implementation (platforms without a GPU backend)
+    ConstantBuffer* ConstantBuffer::Create(uint32 size)
+    {
+        return new HeadlessConstantBuffer(size);
+    }
+#endif
+
+    HeadlessConstantBuffer::HeadlessConstantBuffer(uint32 size)
+        : m_Data((size + 15) & ~15u, 0)
+    {
+    }
+
+    void HeadlessConstantBuffer::SetData(const void* data, uint32 size)
+    {
+        NS_ENGINE_ASSERT(size <= m_Data.size(), "Data size ({}) exceeds buffer size ({})", size, m_Data.size());
+        NS_ENGINE_ASSERT(data != nullptr, "Data pointer is null");
+
+        std::memcpy(m_Data.data(), data, size);
+    }
+
+    void HeadlessConstantBuffer::SetSubData(const void* data, uint32 offset, uint32 size)
+    {
+        NS_ENGINE_ASSERT(offset + size <= m_Data.size(),
+            "Range [{}, {}) exceeds buffer size ({})", offset, offset + size, m_Data.size());
+        NS_ENGINE_ASSERT(data != nullptr, "Data pointer is null");
+
+        if (size == 0)
+        {
+            return;
+        }
+
+        std::memcpy(m_Data.data() + offset, data, size);
+    }
+
+}
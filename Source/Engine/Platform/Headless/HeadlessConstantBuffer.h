@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Renderer/ConstantBuffer.h"
+
+#include <vector>
+
+namespace NanSu
+{
+    /**
+     * @brief Constant buffer for headless runs, kept in CPU memory
+     *
+     * The contents are stored like the CPU shadow of the GPU backends, so
+     * tests can check what MaterialParams and the renderers uploaded.
+     */
+    class HeadlessConstantBuffer : public ConstantBuffer
+    {
+    public:
+        /**
+         * @brief Create a constant buffer with the specified size
+         * @param size Size in bytes (will be aligned to 16 bytes)
+         */
+        explicit HeadlessConstantBuffer(uint32 size);
+        ~HeadlessConstantBuffer() override = default;
+
+        void SetData(const void* data, uint32 size) override;
+        void SetSubData(const void* data, uint32 offset, uint32 size) override;
+        void Bind(uint32 slot) const override {}
+        void Unbind(uint32 slot) const override {}
+        uint32 GetSize() const override { return static_cast<uint32>(m_Data.size()); }
+
+        /**
+         * @brief Get the current contents
+         */
+        const std::vector<byte>& GetData() const { return m_Data; }
+
+    private:
+        std::vector<byte> m_Data;
+    };
+
+}
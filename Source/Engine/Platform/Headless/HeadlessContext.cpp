@@ -0,0 +1,44 @@
+#include "EnginePCH.h"
+#include "Platform/Headless/HeadlessContext.h"
+
+namespace NanSu
+{
+#ifndef NS_PLATFORM_WINDOWS
+    // Factory method implementation (platforms without a GPU backend)
+    GraphicsContext* GraphicsContext::Create(void* windowHandle, uint32 width, uint32 height)
+    {
+        return new HeadlessContext(width, height);
+    }
+#endif
+
+    HeadlessContext::HeadlessContext(uint32 width, uint32 height)
+        : m_Width(width)
+        , m_Height(height)
+    {
+    }
+
+    bool HeadlessContext::Init()
+    {
+        NS_ENGINE_INFO("Initializing headless graphics context ({}x{})", m_Width, m_Height);
+        m_PresentCount = 0;
+        return true;
+    }
+
+    void HeadlessContext::SwapBuffers()
+    {
+        m_FramePacer.BeginPresent();
+        m_FramePacer.EndPresent();
+        ++m_PresentCount;
+    }
+
+    void HeadlessContext::OnResize(uint32 width, uint32 height)
+    {
+        if (width == 0 || height == 0)
+        {
+            return;  // Window is minimized
+        }
+
+        m_Width = width;
+        m_Height = height;
+    }
+}
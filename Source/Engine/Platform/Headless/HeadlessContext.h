@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Renderer/GraphicsContext.h"
+
+namespace NanSu
+{
+    /**
+     * @brief GraphicsContext without a GPU device or swap chain
+     *
+     * Pairs with HeadlessWindow so the Application main loop can run under
+     * automation. Presenting only goes through the FramePacer: Capped still
+     * paces frames, while VSync and Immediate return at once since there is
+     * no display to wait for.
+     */
+    class HeadlessContext : public GraphicsContext
+    {
+    public:
+        HeadlessContext(uint32 width, uint32 height);
+        ~HeadlessContext() override = default;
+
+        bool Init() override;
+        void Shutdown() override {}
+        void Clear(float32 r, float32 g, float32 b, float32 a = 1.0f) override {}
+        void SwapBuffers() override;
+        void OnResize(uint32 width, uint32 height) override;
+
+        void* GetNativeDevice() const override { return nullptr; }
+        void* GetNativeDeviceContext() const override { return nullptr; }
+        void BindRenderTarget() override {}
+
+        uint32 GetWidth() const { return m_Width; }
+        uint32 GetHeight() const { return m_Height; }
+
+        /**
+         * @brief Number of SwapBuffers() calls since Init()
+         */
+        uint64 GetPresentCount() const { return m_PresentCount; }
+
+    private:
+        uint32 m_Width = 0;
+        uint32 m_Height = 0;
+        uint64 m_PresentCount = 0;
+    };
+}
@@ -0,0 +1,198 @@
+#include "EnginePCH.h"
+#include "Platform/Headless/HeadlessFramebuffer.h"
+
+#include <glm/gtc/packing.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace NanSu
+{
+#ifndef NS_PLATFORM_WINDOWS
+    // Factory method implementation (platforms without a GPU backend)
+    Framebuffer* Framebuffer::Create(const FramebufferSpecification& spec)
+    {
+        return new HeadlessFramebuffer(spec);
+    }
+#endif
+
+    // =========================================================================
+    // HeadlessFramebufferAttachment
+    // =========================================================================
+
+    HeadlessFramebufferAttachment::HeadlessFramebufferAttachment(FramebufferFormat format, uint32 width, uint32 height)
+        : m_Format(format)
+    {
+        NS_ENGINE_ASSERT(GetBytesPerPixel(format) > 0, "Invalid FramebufferFormat");
+
+        Recreate(width, height);
+    }
+
+    void HeadlessFramebufferAttachment::SetData(const void* data, uint32 size)
+    {
+        NS_ENGINE_ASSERT(size == m_Pixels.size(),
+            "Data size ({}) does not match attachment size ({})", size, m_Pixels.size());
+
+        std::memcpy(m_Pixels.data(), data, m_Pixels.size());
+    }
+
+    void HeadlessFramebufferAttachment::Recreate(uint32 width, uint32 height)
+    {
+        m_Width = width;
+        m_Height = height;
+        m_Pixels.assign(static_cast<usize>(width) * height * GetBytesPerPixel(m_Format), 0);
+    }
+
+    void HeadlessFramebufferAttachment::Clear(const vec4& value)
+    {
+        // One pixel in the attachment format, as the GPU would convert the clear value
+        byte pixel[8] = {};
+        uint32 pixelSize = GetBytesPerPixel(m_Format);
+        switch (m_Format)
+        {
+            case FramebufferFormat::RGBA8:
+            {
+                for (uint32 channel = 0; channel < 4; ++channel)
+                {
+                    float32 unorm = std::clamp(value[channel], 0.0f, 1.0f);
+                    pixel[channel] = static_cast<byte>(unorm * 255.0f + 0.5f);
+                }
+                break;
+            }
+            case FramebufferFormat::RGBA16F:
+            {
+                uint64 halves = glm::packHalf4x16(value);
+                std::memcpy(pixel, &halves, sizeof(halves));
+                break;
+            }
+            case FramebufferFormat::R32UInt:
+            {
+                uint32 id = static_cast<uint32>(value.x);
+                std::memcpy(pixel, &id, sizeof(id));
+                break;
+            }
+            default:
+                NS_ENGINE_ASSERT(false, "Invalid color attachment format");
+                return;
+        }
+
+        for (usize offset = 0; offset < m_Pixels.size(); offset += pixelSize)
+        {
+            std::memcpy(m_Pixels.data() + offset, pixel, pixelSize);
+        }
+    }
+
+    bool HeadlessFramebufferAttachment::ReadPixels(uint32 x, uint32 y, uint32 width, uint32 height, void* outData) const
+    {
+        if (x + width > m_Width || y + height > m_Height || width == 0 || height == 0)
+        {
+            NS_ENGINE_ERROR("ReadPixels rectangle ({}, {}, {}x{}) is outside the {}x{} attachment",
+                            x, y, width, height, m_Width, m_Height);
+            return false;
+        }
+
+        uint32 pixelSize = GetBytesPerPixel(m_Format);
+        usize sourcePitch = static_cast<usize>(m_Width) * pixelSize;
+        usize rowSize = static_cast<usize>(width) * pixelSize;
+        const byte* source = m_Pixels.data() + y * sourcePitch + static_cast<usize>(x) * pixelSize;
+        byte* destination = static_cast<byte*>(outData);
+        for (uint32 row = 0; row < height; ++row)
+        {
+            std::memcpy(destination + row * rowSize, source + row * sourcePitch, rowSize);
+        }
+
+        return true;
+    }
+
+    // =========================================================================
+    // HeadlessFramebuffer
+    // =========================================================================
+
+    HeadlessFramebuffer::HeadlessFramebuffer(const FramebufferSpecification& spec)
+        : m_Specification(spec)
+    {
+        NS_ENGINE_ASSERT(spec.Width > 0 && spec.Height > 0, "Framebuffer size must not be zero");
+
+        for (FramebufferFormat format : spec.Attachments)
+        {
+            if (IsDepthFormat(format))
+            {
+                NS_ENGINE_ASSERT(m_DepthFormat == FramebufferFormat::None, "Framebuffer has more than one depth attachment");
+                m_DepthFormat = format;
+            }
+            else
+            {
+                m_ColorAttachments.push_back(
+                    std::make_unique<HeadlessFramebufferAttachment>(format, spec.Width, spec.Height));
+            }
+        }
+    }
+
+    HeadlessFramebuffer::~HeadlessFramebuffer()
+    {
+        NS_ENGINE_ASSERT(!m_Bound, "Framebuffer destroyed while bound");
+    }
+
+    void HeadlessFramebuffer::Bind()
+    {
+        NS_ENGINE_ASSERT(!m_Bound, "Framebuffer is already bound");
+        m_Bound = true;
+    }
+
+    void HeadlessFramebuffer::Unbind()
+    {
+        NS_ENGINE_ASSERT(m_Bound, "Framebuffer is not bound");
+        m_Bound = false;
+    }
+
+    void HeadlessFramebuffer::Resize(uint32 width, uint32 height)
+    {
+        if (width == 0 || height == 0)
+        {
+            return;  // Minimized viewport panels report zero sizes
+        }
+
+        if (width == m_Specification.Width && height == m_Specification.Height)
+        {
+            return;
+        }
+
+        m_Specification.Width = width;
+        m_Specification.Height = height;
+
+        for (auto& attachment : m_ColorAttachments)
+        {
+            attachment->Recreate(width, height);
+        }
+    }
+
+    void HeadlessFramebuffer::Clear(const vec4& color)
+    {
+        for (auto& attachment : m_ColorAttachments)
+        {
+            attachment->Clear(color);
+        }
+    }
+
+    void HeadlessFramebuffer::ClearAttachment(uint32 index, const vec4& value)
+    {
+        NS_ENGINE_ASSERT(index < m_ColorAttachments.size(), "Color attachment index out of range");
+
+        m_ColorAttachments[index]->Clear(value);
+    }
+
+    Texture2D* HeadlessFramebuffer::GetColorAttachment(uint32 index) const
+    {
+        NS_ENGINE_ASSERT(index < m_ColorAttachments.size(), "Color attachment index out of range");
+
+        return m_ColorAttachments[index].get();
+    }
+
+    bool HeadlessFramebuffer::ReadPixels(uint32 index, uint32 x, uint32 y, uint32 width, uint32 height, void* outData)
+    {
+        NS_ENGINE_ASSERT(index < m_ColorAttachments.size(), "Color attachment index out of range");
+
+        return m_ColorAttachments[index]->ReadPixels(x, y, width, height, outData);
+    }
+
+} // namespace NanSu
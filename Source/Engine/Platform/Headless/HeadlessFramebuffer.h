@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Renderer/Framebuffer.h"
+#include "Renderer/Texture.h"
+
+#include <memory>
+#include <vector>
+
+namespace NanSu
+{
+    /**
+     * @brief Color attachment of a HeadlessFramebuffer, kept in CPU memory
+     *
+     * Stores tightly packed rows of GetBytesPerPixel(format) bytes, row 0 at
+     * the top, so ReadPixels() is a plain copy. Nothing is ever rasterized
+     * into it: its contents are what Clear(), ClearAttachment() and SetData()
+     * wrote last.
+     */
+    class HeadlessFramebufferAttachment : public Texture2D
+    {
+    public:
+        HeadlessFramebufferAttachment(FramebufferFormat format, uint32 width, uint32 height);
+        ~HeadlessFramebufferAttachment() override = default;
+
+        // Texture interface
+        uint32 GetWidth() const override { return m_Width; }
+        uint32 GetHeight() const override { return m_Height; }
+        void Bind(uint32 slot = 0) const override {}
+        void Unbind(uint32 slot = 0) const override {}
+
+        // Texture2D interface
+        void SetData(const void* data, uint32 size) override;
+        bool Reload() override { return false; }
+
+        /**
+         * @brief Reallocate the storage with a new size (contents are zeroed)
+         */
+        void Recreate(uint32 width, uint32 height);
+
+        /**
+         * @brief Fill every pixel with a value converted to the attachment format
+         */
+        void Clear(const vec4& value);
+
+        /**
+         * @brief Copy a rectangle to CPU memory
+         */
+        bool ReadPixels(uint32 x, uint32 y, uint32 width, uint32 height, void* outData) const;
+
+        FramebufferFormat GetFormat() const { return m_Format; }
+        const std::vector<byte>& GetPixels() const { return m_Pixels; }
+
+    private:
+        FramebufferFormat m_Format;
+        uint32 m_Width = 0;
+        uint32 m_Height = 0;
+        std::vector<byte> m_Pixels;
+    };
+
+    /**
+     * @brief Framebuffer for headless runs (RendererAPI::API::Headless)
+     *
+     * Color attachments live in CPU memory so tests can clear, resize and
+     * read back offscreen targets without a GPU. Depth attachments are only
+     * validated; they have no storage since nothing reads them back.
+     */
+    class HeadlessFramebuffer : public Framebuffer
+    {
+    public:
+        HeadlessFramebuffer(const FramebufferSpecification& spec);
+        ~HeadlessFramebuffer() override;
+
+        void Bind() override;
+        void Unbind() override;
+        void Resize(uint32 width, uint32 height) override;
+
+        void Clear(const vec4& color) override;
+        void ClearAttachment(uint32 index, const vec4& value) override;
+
+        Texture2D* GetColorAttachment(uint32 index = 0) const override;
+        uint32 GetColorAttachmentCount() const override { return static_cast<uint32>(m_ColorAttachments.size()); }
+
+        bool ReadPixels(uint32 index, uint32 x, uint32 y, uint32 width, uint32 height, void* outData) override;
+
+        const FramebufferSpecification& GetSpecification() const override { return m_Specification; }
+
+    private:
+        FramebufferSpecification m_Specification;
+
+        std::vector<std::unique_ptr<HeadlessFramebufferAttachment>> m_ColorAttachments;
+        FramebufferFormat m_DepthFormat = FramebufferFormat::None;
+        bool m_Bound = false;
+    };
+
+} // namespace NanSu
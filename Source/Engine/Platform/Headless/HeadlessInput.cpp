@@ -0,0 +1,31 @@
+#include "EnginePCH.h"
+#include "Platform/Headless/HeadlessInput.h"
+
+namespace NanSu
+{
+#ifndef NS_PLATFORM_WINDOWS
+    // Factory method implementation - called from Input::Initialize()
+    void Input::Initialize()
+    {
+        NS_ENGINE_ASSERT(!s_Instance, "Input system already initialized");
+        s_Instance = std::make_unique<HeadlessInput>();
+        NS_ENGINE_INFO("Headless input system initialized");
+    }
+#endif
+
+    bool HeadlessInput::IsKeyPressedImpl(KeyCode key)
+    {
+        return GetState().IsKeyDown(key);
+    }
+
+    bool HeadlessInput::IsMouseButtonPressedImpl(MouseCode button)
+    {
+        return GetState().IsMouseButtonDown(button);
+    }
+
+    std::pair<float32, float32> HeadlessInput::GetMousePositionImpl()
+    {
+        const vec2& position = GetState().GetMousePosition();
+        return { position.x, position.y };
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Core/Input.h"
+
+namespace NanSu
+{
+    /**
+     * @brief Input polling for headless runs
+     *
+     * There is no OS to query, so polling answers from the Input::GetState()
+     * snapshot, which the Application builds from the (injected) window
+     * events. Polled state therefore changes once per frame, like the
+     * snapshot itself.
+     */
+    class HeadlessInput : public Input
+    {
+    public:
+        HeadlessInput() = default;
+        ~HeadlessInput() override = default;
+
+    protected:
+        bool IsKeyPressedImpl(KeyCode key) override;
+        bool IsMouseButtonPressedImpl(MouseCode button) override;
+        std::pair<float32, float32> GetMousePositionImpl() override;
+    };
+}
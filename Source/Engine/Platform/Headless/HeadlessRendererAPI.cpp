@@ -0,0 +1,23 @@
+#include "EnginePCH.h"
+#include "Platform/Headless/HeadlessRendererAPI.h"
+
+namespace NanSu
+{
+#ifndef NS_PLATFORM_WINDOWS
+    // =========================================================================
+    // Factory Method Implementation
+    // =========================================================================
+
+    RendererAPI* RendererAPI::Create()
+    {
+        return new HeadlessRendererAPI();
+    }
+#endif
+
+    void HeadlessRendererAPI::Init()
+    {
+        NS_ENGINE_INFO("Initializing headless Renderer API");
+        m_DrawCallCount = 0;
+    }
+
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Renderer/RendererAPI.h"
+
+namespace NanSu
+{
+    /**
+     * @brief RendererAPI that accepts every command and draws nothing
+     *
+     * Used with RendererAPI::API::Headless. Draw calls are only counted, so
+     * automated runs can check how much work a frame submitted.
+     */
+    class HeadlessRendererAPI : public RendererAPI
+    {
+    public:
+        HeadlessRendererAPI() = default;
+        ~HeadlessRendererAPI() override = default;
+
+        void Init() override;
+        void Shutdown() override {}
+
+        void SetViewport(uint32 x, uint32 y, uint32 width, uint32 height) override {}
+        void SetClearColor(float32 r, float32 g, float32 b, float32 a = 1.0f) override {}
+        void Clear() override {}
+        void SetPrimitiveTopology(PrimitiveTopology topology) override {}
+        void BindRenderTarget() override {}
+        void SetPipelineState(const PipelineState& state) override {}
+        void DrawIndexed(const IndexBuffer* indexBuffer, uint32 indexCount = 0) override { ++m_DrawCallCount; }
+
+        /**
+         * @brief Number of DrawIndexed() calls since Init()
+         */
+        uint64 GetDrawCallCount() const { return m_DrawCallCount; }
+
+    private:
+        uint64 m_DrawCallCount = 0;
+    };
+
+}
@@ -0,0 +1,416 @@
+#include "EnginePCH.h"
+#include "Platform/Headless/HeadlessShader.h"
+#include "Asset/AssetSystem.h"
+
+#include <cctype>
+#include <charconv>
+#include <limits>
+
+namespace NanSu
+{
+    namespace
+    {
+        constexpr uint32 REGISTER_SIZE = 16;
+        constexpr uint32 UNASSIGNED_SLOT = std::numeric_limits<uint32>::max();
+
+        uint32 AlignToRegister(uint32 offset)
+        {
+            return (offset + REGISTER_SIZE - 1) & ~(REGISTER_SIZE - 1);
+        }
+
+        bool IsIdentifierChar(char c)
+        {
+            return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+        }
+
+        std::string ExtractNameFromPath(const std::string& filePath)
+        {
+            auto lastSlash = filePath.find_last_of("/\\");
+            auto start = (lastSlash == std::string::npos) ? 0 : lastSlash + 1;
+
+            auto lastDot = filePath.rfind('.');
+            auto end = (lastDot == std::string::npos || lastDot < start)
+                ? filePath.size()
+                : lastDot;
+
+            return filePath.substr(start, end - start);
+        }
+
+        /**
+         * @brief Copy of the source with comments removed, so declarations can be split on ';'
+         */
+        std::string StripComments(std::string_view source)
+        {
+            std::string result;
+            result.reserve(source.size());
+
+            for (usize i = 0; i < source.size(); ++i)
+            {
+                if (source.compare(i, 2, "//") == 0)
+                {
+                    i = source.find('\n', i);
+                    if (i == std::string_view::npos)
+                    {
+                        break;
+                    }
+                    result += '\n';
+                }
+                else if (source.compare(i, 2, "/*") == 0)
+                {
+                    i = source.find("*/", i + 2);
+                    if (i == std::string_view::npos)
+                    {
+                        break;
+                    }
+                    ++i;
+                    result += ' ';
+                }
+                else
+                {
+                    result += source[i];
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Placement of one cbuffer member type
+         */
+        struct MemberType
+        {
+            ShaderDataType Type = ShaderDataType::None;
+            uint32 Registers = 1;           // 16-byte registers spanned
+            uint32 LastRegisterSize = 0;    // Bytes used in the last register
+            bool IsMatrix = false;          // Matrices always start a new register
+        };
+
+        /**
+         * @brief Map an HLSL type name ("float3", "int", "float4x4", "matrix") to its placement
+         * @return false for types the reflection does not handle (structs, half, double)
+         */
+        bool ParseMemberType(std::string_view name, bool rowMajor, MemberType& outType)
+        {
+            if (name == "matrix")
+            {
+                name = "float4x4";
+            }
+
+            static constexpr std::string_view BASE_TYPES[] = { "float", "uint", "int", "bool" };
+
+            std::string_view base;
+            for (std::string_view candidate : BASE_TYPES)
+            {
+                if (name.starts_with(candidate))
+                {
+                    base = candidate;
+                    break;
+                }
+            }
+            if (base.empty())
+            {
+                return false;
+            }
+
+            auto isDimension = [](char c) { return c >= '1' && c <= '4'; };
+
+            std::string_view dimensions = name.substr(base.size());
+            uint32 rows = 1;
+            uint32 columns = 1;
+            if (dimensions.size() == 1 && isDimension(dimensions[0]))
+            {
+                columns = static_cast<uint32>(dimensions[0] - '0');
+            }
+            else if (dimensions.size() == 3 && isDimension(dimensions[0]) && dimensions[1] == 'x' && isDimension(dimensions[2]))
+            {
+                rows = static_cast<uint32>(dimensions[0] - '0');
+                columns = static_cast<uint32>(dimensions[2] - '0');
+                outType.IsMatrix = true;
+            }
+            else if (!dimensions.empty())
+            {
+                return false;
+            }
+
+            if (outType.IsMatrix)
+            {
+                // Column-major (the default) stores one column per register
+                outType.Registers = rowMajor ? rows : columns;
+                outType.LastRegisterSize = 4 * (rowMajor ? columns : rows);
+                if (base == "float" && rows == columns && rows >= 3)
+                {
+                    outType.Type = rows == 3 ? ShaderDataType::Mat3 : ShaderDataType::Mat4;
+                }
+                return true;
+            }
+
+            static constexpr ShaderDataType FLOAT_TYPES[] = { ShaderDataType::Float, ShaderDataType::Float2, ShaderDataType::Float3, ShaderDataType::Float4 };
+            static constexpr ShaderDataType INT_TYPES[] = { ShaderDataType::Int, ShaderDataType::Int2, ShaderDataType::Int3, ShaderDataType::Int4 };
+
+            outType.LastRegisterSize = 4 * columns;
+            if (base == "float")
+            {
+                outType.Type = FLOAT_TYPES[columns - 1];
+            }
+            else if (base == "bool")
+            {
+                outType.Type = columns == 1 ? ShaderDataType::Bool : ShaderDataType::None;
+            }
+            else
+            {
+                outType.Type = INT_TYPES[columns - 1];
+            }
+            return true;
+        }
+
+        /**
+         * @brief Lay out one member declaration ("row_major float4x4 u_Bones[4]") after the given offset
+         * @return false if the declaration cannot be reflected
+         */
+        bool ParseMember(std::string_view declaration, uint32& offset, ShaderUniform& outUniform)
+        {
+            // Register and packoffset annotations are not needed for the layout
+            declaration = declaration.substr(0, declaration.find(':'));
+
+            uint32 arrayCount = 0;
+            usize bracket = declaration.find('[');
+            if (bracket != std::string_view::npos)
+            {
+                usize end = declaration.find(']', bracket);
+                std::string_view count = declaration.substr(bracket + 1, end - bracket - 1);
+                auto [ptr, ec] = std::from_chars(count.data(), count.data() + count.size(), arrayCount);
+                if (end == std::string_view::npos || ec != std::errc() || arrayCount == 0)
+                {
+                    return false;
+                }
+                declaration = declaration.substr(0, bracket);
+            }
+
+            std::vector<std::string> tokens;
+            std::istringstream stream{ std::string(declaration) };
+            for (std::string token; stream >> token; )
+            {
+                tokens.push_back(std::move(token));
+            }
+            if (tokens.size() < 2)
+            {
+                return false;
+            }
+
+            bool rowMajor = std::find(tokens.begin(), tokens.end() - 2, "row_major") != tokens.end() - 2;
+
+            MemberType type;
+            if (!ParseMemberType(tokens[tokens.size() - 2], rowMajor, type))
+            {
+                return false;
+            }
+
+            // Members are packed into registers and never straddle a register
+            // boundary; matrices and arrays always start a new register
+            uint32 elementSize = (type.Registers - 1) * REGISTER_SIZE + type.LastRegisterSize;
+            if (type.IsMatrix || arrayCount > 0 || offset / REGISTER_SIZE != (offset + elementSize - 1) / REGISTER_SIZE)
+            {
+                offset = AlignToRegister(offset);
+            }
+
+            outUniform.Name = tokens.back();
+            outUniform.Type = arrayCount > 0 ? ShaderDataType::None : type.Type;
+            outUniform.Offset = offset;
+            outUniform.Size = arrayCount > 0 ? (arrayCount - 1) * AlignToRegister(elementSize) + elementSize : elementSize;
+
+            offset += outUniform.Size;
+            return true;
+        }
+    }
+
+#ifndef NS_PLATFORM_WINDOWS
+    // =========================================================================
+    // Factory Method Implementations
+    // =========================================================================
+
+    Shader* Shader::Create(const std::string& filePath)
+    {
+        return new HeadlessShader(filePath);
+    }
+
+    Shader* Shader::Create(const std::string& name,
+                           const std::string& vertexSource,
+                           const std::string& pixelSource)
+    {
+        return new HeadlessShader(name, vertexSource, pixelSource);
+    }
+#endif
+
+    // =========================================================================
+    // HeadlessShader
+    // =========================================================================
+
+    HeadlessShader::HeadlessShader(const std::string& filePath)
+        : m_Name(ExtractNameFromPath(filePath))
+        , m_FilePath(filePath)
+    {
+        AssetData sourceData = AssetSystem::Load(filePath);
+        if (!sourceData.IsValid())
+        {
+            NS_ENGINE_ERROR("Failed to open shader file: {}", filePath);
+            NS_ENGINE_ASSERT(false, "Shader file not found");
+            return;
+        }
+
+        ReflectUniformBuffers(sourceData.AsString(), m_UniformBuffers);
+    }
+
+    HeadlessShader::HeadlessShader(const std::string& name,
+                                   const std::string& vertexSource,
+                                   const std::string& pixelSource)
+        : m_Name(name)
+    {
+        ReflectUniformBuffers(vertexSource, m_UniformBuffers);
+        ReflectUniformBuffers(pixelSource, m_UniformBuffers);
+    }
+
+    bool HeadlessShader::Reload()
+    {
+        if (m_FilePath.empty())
+        {
+            return false;
+        }
+
+        AssetData sourceData = AssetSystem::Load(m_FilePath);
+        if (!sourceData.IsValid())
+        {
+            NS_ENGINE_ERROR("Shader '{}' reload failed: cannot read {}", m_Name, m_FilePath);
+            return false;
+        }
+
+        std::vector<ShaderUniformBuffer> uniformBuffers;
+        ReflectUniformBuffers(sourceData.AsString(), uniformBuffers);
+        m_UniformBuffers = std::move(uniformBuffers);
+        return true;
+    }
+
+    void HeadlessShader::ReflectUniformBuffers(std::string_view source, std::vector<ShaderUniformBuffer>& uniformBuffers)
+    {
+        constexpr std::string_view KEYWORD = "cbuffer";
+
+        std::string text = StripComments(source);
+        std::vector<ShaderUniformBuffer> declared;
+
+        usize position = 0;
+        while ((position = text.find(KEYWORD, position)) != std::string::npos)
+        {
+            usize start = position;
+            position += KEYWORD.size();
+            if ((start > 0 && IsIdentifierChar(text[start - 1])) ||
+                (position < text.size() && IsIdentifierChar(text[position])))
+            {
+                continue;  // Part of a longer identifier
+            }
+
+            usize open = text.find('{', position);
+            usize close = text.find('}', open);
+            if (close == std::string::npos)
+            {
+                break;
+            }
+
+            // "SceneData : register(b0)"
+            std::string_view header = std::string_view(text).substr(position, open - position);
+            usize nameStart = header.find_first_not_of(" \t\r\n");
+            usize nameEnd = nameStart;
+            while (nameEnd < header.size() && IsIdentifierChar(header[nameEnd]))
+            {
+                ++nameEnd;
+            }
+
+            ShaderUniformBuffer buffer;
+            buffer.Name = std::string(header.substr(nameStart, nameEnd - nameStart));
+            buffer.Slot = UNASSIGNED_SLOT;
+
+            usize slot = header.find("register");
+            slot = slot == std::string_view::npos ? slot : header.find('b', slot + 8);
+            if (slot != std::string_view::npos)
+            {
+                std::from_chars(header.data() + slot + 1, header.data() + header.size(), buffer.Slot);
+            }
+
+            // Members, one declaration per ';'
+            std::string_view body = std::string_view(text).substr(open + 1, close - open - 1);
+            uint32 offset = 0;
+            bool supported = true;
+            for (usize begin = 0; begin < body.size(); )
+            {
+                usize end = std::min(body.find(';', begin), body.size());
+                std::string_view declaration = body.substr(begin, end - begin);
+                begin = end + 1;
+
+                if (declaration.find_first_not_of(" \t\r\n") == std::string_view::npos)
+                {
+                    continue;
+                }
+
+                ShaderUniform uniform;
+                if (!ParseMember(declaration, offset, uniform))
+                {
+                    supported = false;
+                    break;
+                }
+                buffer.Uniforms.push_back(std::move(uniform));
+            }
+
+            position = close + 1;
+
+            if (!supported)
+            {
+                NS_ENGINE_WARN("Shader '{}': cbuffer '{}' has members the headless reflection cannot lay out, skipped",
+                               m_Name, buffer.Name);
+                continue;
+            }
+
+            buffer.Size = AlignToRegister(offset);
+            declared.push_back(std::move(buffer));
+        }
+
+        // Buffers without a register get the lowest free slots, in declaration order
+        for (auto& buffer : declared)
+        {
+            if (buffer.Slot != UNASSIGNED_SLOT)
+            {
+                continue;
+            }
+
+            uint32 slot = 0;
+            auto isTaken = [&](uint32 candidate)
+            {
+                auto sameSlot = [candidate](const ShaderUniformBuffer& other) { return other.Slot == candidate; };
+                return std::any_of(declared.begin(), declared.end(), sameSlot);
+            };
+            while (isTaken(slot))
+            {
+                ++slot;
+            }
+            buffer.Slot = slot;
+        }
+
+        // The same cbuffer is usually visible to both stages; keep one entry per slot
+        for (auto& buffer : declared)
+        {
+            auto existing = std::find_if(uniformBuffers.begin(), uniformBuffers.end(),
+                [&](const ShaderUniformBuffer& other) { return other.Slot == buffer.Slot; });
+
+            if (existing == uniformBuffers.end())
+            {
+                uniformBuffers.push_back(std::move(buffer));
+            }
+            else if (!existing->IsLayoutCompatible(buffer))
+            {
+                NS_ENGINE_WARN("Shader '{}': stages disagree on the layout of cbuffer slot b{} ('{}' vs '{}')",
+                               m_Name, buffer.Slot, existing->Name, buffer.Name);
+            }
+        }
+
+        std::sort(uniformBuffers.begin(), uniformBuffers.end(),
+            [](const ShaderUniformBuffer& a, const ShaderUniformBuffer& b) { return a.Slot < b.Slot; });
+    }
+
+}
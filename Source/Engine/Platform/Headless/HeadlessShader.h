@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Renderer/Shader.h"
+
+#include <string_view>
+#include <vector>
+
+namespace NanSu
+{
+    /**
+     * @brief Shader for headless runs; nothing is compiled
+     *
+     * Constant buffer layouts are reflected from the HLSL source text with
+     * the cbuffer packing rules, so MaterialParams and the renderers see the
+     * same layouts as with a GPU backend. Supported member types are scalars,
+     * vectors and matrices of float, int, uint and bool, and arrays of them;
+     * a cbuffer with any other member (structs) is left out with a warning.
+     * The source is not preprocessed, so #include'd cbuffers are not seen.
+     */
+    class HeadlessShader : public Shader
+    {
+    public:
+        /**
+         * @brief Create shader from a file path
+         * @param filePath Path to HLSL file containing VSMain and PSMain
+         */
+        explicit HeadlessShader(const std::string& filePath);
+
+        /**
+         * @brief Create shader from source strings
+         * @param name Shader name identifier
+         * @param vertexSource HLSL vertex shader source
+         * @param pixelSource HLSL pixel shader source
+         */
+        HeadlessShader(const std::string& name,
+                       const std::string& vertexSource,
+                       const std::string& pixelSource);
+
+        ~HeadlessShader() override = default;
+
+        void Bind() const override {}
+        void Unbind() const override {}
+        void SetInputLayout(const BufferLayout& layout) override {}
+        const std::string& GetName() const override { return m_Name; }
+        bool Reload() override;
+        const std::vector<ShaderUniformBuffer>& GetUniformBuffers() const override { return m_UniformBuffers; }
+
+    private:
+        /**
+         * @brief Add the cbuffers declared in a source to a list merged by slot
+         */
+        void ReflectUniformBuffers(std::string_view source, std::vector<ShaderUniformBuffer>& uniformBuffers);
+
+    private:
+        std::string m_Name;
+        std::string m_FilePath;
+
+        // Reflected constant buffer layouts (VS and PS merged)
+        std::vector<ShaderUniformBuffer> m_UniformBuffers;
+    };
+
+}
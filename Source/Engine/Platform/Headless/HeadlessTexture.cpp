@@ -0,0 +1,89 @@
+#include "EnginePCH.h"
+#include "Platform/Headless/HeadlessTexture.h"
+#include "Asset/AssetSystem.h"
+#include "Renderer/CookedTexture.h"
+
+#include <stb_image.h>
+
+#include <filesystem>
+
+namespace NanSu
+{
+#ifndef NS_PLATFORM_WINDOWS
+    // =========================================================================
+    // Factory Method Implementations
+    // =========================================================================
+
+    Texture2D* Texture2D::Create(const std::string& filePath)
+    {
+        return new HeadlessTexture2D(filePath);
+    }
+
+    Texture2D* Texture2D::Create(uint32 width, uint32 height)
+    {
+        return new HeadlessTexture2D(width, height);
+    }
+#endif
+
+    // =========================================================================
+    // HeadlessTexture2D
+    // =========================================================================
+
+    HeadlessTexture2D::HeadlessTexture2D(const std::string& filePath)
+        : m_FilePath(filePath)
+    {
+        if (!ReadSize(filePath))
+        {
+            NS_ENGINE_ERROR("Failed to load texture: {}", filePath);
+        }
+    }
+
+    HeadlessTexture2D::HeadlessTexture2D(uint32 width, uint32 height)
+        : m_Width(width)
+        , m_Height(height)
+    {
+    }
+
+    void HeadlessTexture2D::SetData(const void* data, uint32 size)
+    {
+        uint32 expectedSize = m_Width * m_Height * 4;  // RGBA = 4 bytes per pixel
+        NS_ENGINE_ASSERT(size == expectedSize,
+            "Data size ({}) does not match texture size ({})", size, expectedSize);
+    }
+
+    bool HeadlessTexture2D::Reload()
+    {
+        return !m_FilePath.empty() && ReadSize(m_FilePath);
+    }
+
+    bool HeadlessTexture2D::ReadSize(const std::string& filePath)
+    {
+        std::filesystem::path cookedPath = filePath;
+        cookedPath.replace_extension(COOKED_TEXTURE_EXTENSION);
+
+        if (AssetSystem::Exists(cookedPath.string()))
+        {
+            AssetData cooked = AssetSystem::Load(cookedPath.string());
+            if (cooked.IsValid() && ValidateCookedTexture(cooked.GetData(), cooked.GetSize()))
+            {
+                const auto* header = reinterpret_cast<const CookedTextureHeader*>(cooked.GetData());
+                m_Width = header->Width;
+                m_Height = header->Height;
+                return true;
+            }
+        }
+
+        AssetData image = AssetSystem::Load(filePath);
+        int width, height, channels;
+        if (!image.IsValid() ||
+            !stbi_info_from_memory(image.GetData(), static_cast<int>(image.GetSize()), &width, &height, &channels))
+        {
+            return false;
+        }
+
+        m_Width = static_cast<uint32>(width);
+        m_Height = static_cast<uint32>(height);
+        return true;
+    }
+
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Renderer/Texture.h"
+
+#include <string>
+
+namespace NanSu
+{
+    /**
+     * @brief Texture for headless runs; only the size is kept
+     *
+     * File textures read just the image header (or the cooked texture
+     * header), so headless runs report the same sizes as the GPU backends
+     * without decoding any pixels.
+     */
+    class HeadlessTexture2D : public Texture2D
+    {
+    public:
+        explicit HeadlessTexture2D(const std::string& filePath);
+        HeadlessTexture2D(uint32 width, uint32 height);
+        ~HeadlessTexture2D() override = default;
+
+        uint32 GetWidth() const override { return m_Width; }
+        uint32 GetHeight() const override { return m_Height; }
+        void Bind(uint32 slot = 0) const override {}
+        void Unbind(uint32 slot = 0) const override {}
+
+        void SetData(const void* data, uint32 size) override;
+        bool Reload() override;
+
+    private:
+        /**
+         * @brief Read the size of the cooked texture, or else of the source image
+         * @return false if neither could be read (the size is left unchanged)
+         */
+        bool ReadSize(const std::string& filePath);
+
+    private:
+        std::string m_FilePath;
+        uint32 m_Width = 0;
+        uint32 m_Height = 0;
+    };
+
+}
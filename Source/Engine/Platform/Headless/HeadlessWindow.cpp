@@ -0,0 +1,274 @@
+#include "EnginePCH.h"
+#include "Platform/Headless/HeadlessWindow.h"
+#include "Events/KeyEvent.h"
+#include "Events/MouseEvent.h"
+#include "Events/WindowEvent.h"
+
+#include <charconv>
+#include <thread>
+
+namespace NanSu
+{
+    namespace
+    {
+        bool ParseInt(std::string_view text, int32& outValue)
+        {
+            const char* end = text.data() + text.size();
+            auto [ptr, ec] = std::from_chars(text.data(), end, outValue);
+            return ec == std::errc() && ptr == end;
+        }
+
+        /**
+         * @brief Key name as written in scripts ("W", "7", "Space", "Left"), or a KeyCode value
+         */
+        KeyCode ParseKeyCode(std::string_view name)
+        {
+            if (name.size() == 1)
+            {
+                char c = name[0];
+                if (c >= 'a' && c <= 'z')
+                {
+                    c = static_cast<char>(c - 'a' + 'A');
+                }
+                if ((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9'))
+                {
+                    return static_cast<KeyCode>(c);
+                }
+            }
+
+            struct NamedKey
+            {
+                std::string_view Name;
+                KeyCode Code;
+            };
+
+            static constexpr NamedKey NAMED_KEYS[] = {
+                { "Space", KeyCode::Space },             { "Escape", KeyCode::Escape },
+                { "Enter", KeyCode::Enter },             { "Tab", KeyCode::Tab },
+                { "Backspace", KeyCode::Backspace },     { "Delete", KeyCode::Delete },
+                { "Left", KeyCode::Left },               { "Right", KeyCode::Right },
+                { "Up", KeyCode::Up },                   { "Down", KeyCode::Down },
+                { "LeftShift", KeyCode::LeftShift },     { "RightShift", KeyCode::RightShift },
+                { "LeftControl", KeyCode::LeftControl }, { "RightControl", KeyCode::RightControl },
+                { "LeftAlt", KeyCode::LeftAlt },         { "RightAlt", KeyCode::RightAlt },
+                { "F1", KeyCode::F1 },                   { "F5", KeyCode::F5 },
+            };
+
+            for (const NamedKey& key : NAMED_KEYS)
+            {
+                if (key.Name == name)
+                {
+                    return key.Code;
+                }
+            }
+
+            int32 value = 0;
+            return ParseInt(name, value) ? static_cast<KeyCode>(value) : KeyCode::Unknown;
+        }
+
+        /**
+         * @brief Build the event of one script line
+         * @return false for unknown commands or invalid arguments
+         */
+        bool ParseScriptCommand(const std::string& command, const std::string& a, const std::string& b,
+                                EventLogRecord& outRecord)
+        {
+            int32 value = 0;
+            int32 second = 0;
+            float32 x = 0.0f;
+            float32 y = 0.0f;
+            KeyCode key = ParseKeyCode(a);
+            bool hasPoint = (std::istringstream(a) >> x) && (std::istringstream(b) >> y);
+
+            if (command == "key_down" && key != KeyCode::Unknown)
+                return EncodeEventRecord(KeyPressedEvent(static_cast<int32>(key), b == "repeat"), outRecord);
+            if (command == "key_up" && key != KeyCode::Unknown)
+                return EncodeEventRecord(KeyReleasedEvent(static_cast<int32>(key)), outRecord);
+            if (command == "char" && ParseInt(a, value))
+                return EncodeEventRecord(KeyTypedEvent(value), outRecord);
+            if (command == "mouse_down" && ParseInt(a, value))
+                return EncodeEventRecord(MouseButtonPressedEvent(value), outRecord);
+            if (command == "mouse_up" && ParseInt(a, value))
+                return EncodeEventRecord(MouseButtonReleasedEvent(value), outRecord);
+            if (command == "mouse_move" && hasPoint)
+                return EncodeEventRecord(MouseMovedEvent(x, y), outRecord);
+            if (command == "scroll" && hasPoint)
+                return EncodeEventRecord(MouseScrolledEvent(x, y), outRecord);
+            if (command == "resize" && ParseInt(a, value) && ParseInt(b, second) && value >= 0 && second >= 0)
+                return EncodeEventRecord(WindowResizeEvent(static_cast<uint32>(value), static_cast<uint32>(second)), outRecord);
+            if (command == "focus")
+                return EncodeEventRecord(WindowFocusEvent(), outRecord);
+            if (command == "lost_focus")
+                return EncodeEventRecord(WindowLostFocusEvent(), outRecord);
+            if (command == "close")
+                return EncodeEventRecord(WindowCloseEvent(), outRecord);
+
+            return false;
+        }
+    }
+
+#ifndef NS_PLATFORM_WINDOWS
+    // Factory method implementation (platforms without a native window backend)
+    Window* Window::Create(const WindowProps& props)
+    {
+        return new HeadlessWindow(props);
+    }
+#endif
+
+    HeadlessWindow::HeadlessWindow(const WindowProps& props)
+        : m_Title(props.Title)
+        , m_Width(props.Width)
+        , m_Height(props.Height)
+    {
+        NS_ENGINE_INFO("Headless window created: {} ({}x{})", m_Title, m_Width, m_Height);
+    }
+
+    void HeadlessWindow::OnUpdate()
+    {
+        DeliverEventsBefore(m_FrameIndex + 1);
+        ++m_FrameIndex;
+        ++m_UpdateCount;
+    }
+
+    bool HeadlessWindow::WaitEvents(float64 timeoutSeconds)
+    {
+        // Events queued for a frame that already started
+        if (DeliverEventsBefore(m_FrameIndex))
+        {
+            return true;
+        }
+
+        if (timeoutSeconds >= 0.0)
+        {
+            if (timeoutSeconds > 0.0)
+            {
+                std::this_thread::sleep_for(std::chrono::duration<float64>(timeoutSeconds));
+            }
+            return false;
+        }
+
+        // Nothing else can wake an infinite wait: skip ahead to the next scheduled event
+        if (GetPendingEventCount() > 0)
+        {
+            m_FrameIndex = m_Queue[m_NextEvent].Frame;
+            DeliverEventsBefore(m_FrameIndex + 1);
+            return true;
+        }
+
+        // Waiting forever would hang the run, so end it instead
+        NS_ENGINE_WARN("HeadlessWindow: waiting for events with none scheduled, closing the window");
+        WindowCloseEvent closeEvent;
+        OnEvent(closeEvent);
+        return true;
+    }
+
+    // =========================================================================
+    // Event Injection
+    // =========================================================================
+
+    void HeadlessWindow::QueueEvent(const Event& event, uint64 frame)
+    {
+        EventLogRecord record;
+        if (!EncodeEventRecord(event, record))
+        {
+            NS_ENGINE_WARN("HeadlessWindow: {} cannot be injected", event.GetName());
+            return;
+        }
+
+        QueueRecord(record, frame);
+    }
+
+    void HeadlessWindow::QueueRecord(const EventLogRecord& record, uint64 frame)
+    {
+        // After all pending events of the same frame, so queue order is kept
+        auto position = std::upper_bound(m_Queue.begin() + static_cast<isize>(m_NextEvent), m_Queue.end(), frame,
+                                         [](uint64 value, const ScheduledEvent& other) { return value < other.Frame; });
+        m_Queue.insert(position, { frame, record });
+    }
+
+    bool HeadlessWindow::LoadScript(const std::string& path)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            NS_ENGINE_ERROR("Failed to open headless event script: {}", path);
+            return false;
+        }
+
+        usize queued = GetPendingEventCount();
+        std::string line;
+        uint32 lineNumber = 0;
+        while (std::getline(file, line))
+        {
+            ++lineNumber;
+            line = line.substr(0, line.find('#'));
+
+            std::istringstream stream(line);
+            std::string frameText;
+            std::string command;
+            if (!(stream >> frameText))
+            {
+                continue;  // Blank or comment line
+            }
+
+            int32 frame = 0;
+            std::string a;
+            std::string b;
+            stream >> command >> a >> b;
+
+            EventLogRecord record;
+            if (ParseInt(frameText, frame) && frame >= 0 && ParseScriptCommand(command, a, b, record))
+            {
+                QueueRecord(record, static_cast<uint64>(frame));
+            }
+            else
+            {
+                NS_ENGINE_WARN("{}({}): invalid headless event '{}'", path, lineNumber, line);
+            }
+        }
+
+        NS_ENGINE_INFO("Headless event script loaded: {} ({} events)", path, GetPendingEventCount() - queued);
+        return true;
+    }
+
+    // =========================================================================
+    // Delivery
+    // =========================================================================
+
+    bool HeadlessWindow::DeliverEventsBefore(uint64 frame)
+    {
+        bool delivered = false;
+
+        // Index loop: callbacks may queue further events
+        while (m_NextEvent < m_Queue.size() && m_Queue[m_NextEvent].Frame < frame)
+        {
+            EventLogRecord record = m_Queue[m_NextEvent++].Record;
+            DispatchEventRecord(record, [this](Event& event) { OnEvent(event); });
+            delivered = true;
+        }
+
+        if (m_NextEvent == m_Queue.size())
+        {
+            m_Queue.clear();
+            m_NextEvent = 0;
+        }
+
+        return delivered;
+    }
+
+    void HeadlessWindow::OnEvent(Event& event)
+    {
+        if (event.GetEventType() == EventType::WindowResize)
+        {
+            const auto& resizeEvent = static_cast<const WindowResizeEvent&>(event);
+            m_Width = resizeEvent.GetWidth();
+            m_Height = resizeEvent.GetHeight();
+        }
+
+        if (m_EventCallback)
+        {
+            m_EventCallback(event);
+        }
+    }
+
+} // namespace NanSu
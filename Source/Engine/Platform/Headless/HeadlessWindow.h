@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Core/Window.h"
+#include "Events/EventRecorder.h"
+
+#include <string>
+#include <vector>
+
+namespace NanSu
+{
+    /**
+     * @brief Window without an OS window, driven by injected events
+     *
+     * Used when the renderer runs headless (RendererAPI::API::Headless), so
+     * the Application main loop can run on machines without a display or
+     * GPU. Events are queued for a frame and delivered, in queue order, by
+     * the OnUpdate() call of that frame; frames are counted from 0 by
+     * OnUpdate() calls, which the Application makes once per main loop
+     * iteration. Resize events also change the reported window size.
+     *
+     * Events come from QueueEvent() or from a script file:
+     * @code
+     * # <frame> <command> [arguments]
+     * 0   resize 1280 720
+     * 10  key_down W          # key name or KeyCode value; "key_down W repeat" for auto-repeat
+     * 40  key_up W
+     * 50  mouse_move 640 360
+     * 55  mouse_down 0        # MouseCode value
+     * 56  mouse_up 0
+     * 60  scroll 0 1
+     * 70  char 97             # KeyTyped character code
+     * 80  lost_focus
+     * 81  focus
+     * 120 close
+     * @endcode
+     */
+    class HeadlessWindow : public Window
+    {
+    public:
+        explicit HeadlessWindow(const WindowProps& props);
+        ~HeadlessWindow() override = default;
+
+        // Window interface
+        void OnUpdate() override;
+
+        /**
+         * @brief Deliver events due this frame; otherwise sleep for a finite timeout
+         *
+         * An infinite wait (negative timeout) skips ahead to the frame of the
+         * next scheduled event and delivers that frame's events. With no event
+         * scheduled it delivers a WindowCloseEvent, since nothing else could
+         * ever wake the window.
+         */
+        bool WaitEvents(float64 timeoutSeconds) override;
+
+        uint32 GetWidth() const override { return m_Width; }
+        uint32 GetHeight() const override { return m_Height; }
+        void SetEventCallback(const EventCallback& callback) override { m_EventCallback = callback; }
+        void* GetNativeWindow() const override { return nullptr; }
+
+        // =====================================================================
+        // Event Injection
+        // =====================================================================
+
+        /**
+         * @brief Deliver a copy of an event during the given frame
+         * @param event Any window or input event (engine-generated events are ignored)
+         * @param frame Frame index; frames that already started get it on the next OnUpdate()
+         */
+        void QueueEvent(const Event& event, uint64 frame);
+
+        /**
+         * @brief Deliver a copy of an event during the next OnUpdate()
+         */
+        void QueueEvent(const Event& event) { QueueEvent(event, m_FrameIndex); }
+
+        /**
+         * @brief Queue every event of a script file (see class description)
+         * @return false if the file could not be read; invalid lines are skipped with a warning
+         */
+        bool LoadScript(const std::string& path);
+
+        /**
+         * @brief Index of the frame the next OnUpdate() delivers
+         */
+        uint64 GetFrameIndex() const { return m_FrameIndex; }
+
+        /**
+         * @brief Number of OnUpdate() calls, which excludes frames skipped by WaitEvents()
+         */
+        uint64 GetUpdateCount() const { return m_UpdateCount; }
+
+        /**
+         * @brief Number of queued events not yet delivered
+         */
+        usize GetPendingEventCount() const { return m_Queue.size() - m_NextEvent; }
+
+    private:
+        struct ScheduledEvent
+        {
+            uint64 Frame;
+            EventLogRecord Record;
+        };
+
+        void QueueRecord(const EventLogRecord& record, uint64 frame);
+
+        /**
+         * @brief Dispatch queued events scheduled before the given frame
+         * @return true if any event was delivered
+         */
+        bool DeliverEventsBefore(uint64 frame);
+
+        void OnEvent(Event& event);
+
+    private:
+        std::string m_Title;
+        uint32 m_Width = 0;
+        uint32 m_Height = 0;
+        EventCallback m_EventCallback;
+
+        std::vector<ScheduledEvent> m_Queue;    // Sorted by frame (stable) from m_NextEvent on
+        usize m_NextEvent = 0;
+        uint64 m_FrameIndex = 0;
+        uint64 m_UpdateCount = 0;
+    };
+
+} // namespace NanSu
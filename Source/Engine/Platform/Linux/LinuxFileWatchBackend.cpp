@@ -0,0 +1,134 @@
+#include "EnginePCH.h"
+#include "Asset/FileWatchBackend.h"
+
+#ifdef __linux__
+
+#include <filesystem>
+
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace NanSu
+{
+    namespace
+    {
+        constexpr uint32 WATCH_MASK = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+
+        /**
+         * @brief inotify backend; one watch descriptor per directory
+         */
+        class LinuxFileWatchBackend : public FileWatchBackend
+        {
+        public:
+            ~LinuxFileWatchBackend() override
+            {
+                if (m_Fd >= 0)
+                {
+                    ::close(m_Fd);
+                }
+            }
+
+            bool Start(const std::vector<std::string>& directories) override
+            {
+                m_Fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+                if (m_Fd < 0)
+                {
+                    return false;
+                }
+
+                for (const std::string& directory : directories)
+                {
+                    AddWatchRecursive(directory);
+                }
+
+                return !m_WatchedDirectories.empty();
+            }
+
+            void Poll(uint32 timeoutMs, std::vector<std::string>& outChangedFiles) override
+            {
+                pollfd descriptor = {};
+                descriptor.fd = m_Fd;
+                descriptor.events = POLLIN;
+
+                if (::poll(&descriptor, 1, static_cast<int>(timeoutMs)) <= 0)
+                {
+                    return;
+                }
+
+                alignas(inotify_event) char buffer[4096];
+                for (;;)
+                {
+                    ssize_t length = ::read(m_Fd, buffer, sizeof(buffer));
+                    if (length <= 0)
+                    {
+                        break;
+                    }
+
+                    for (char* ptr = buffer; ptr < buffer + length; )
+                    {
+                        const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+                        ptr += sizeof(inotify_event) + event->len;
+
+                        auto it = m_WatchedDirectories.find(event->wd);
+                        if (it == m_WatchedDirectories.end() || event->len == 0)
+                        {
+                            continue;
+                        }
+
+                        std::string path = it->second + "/" + event->name;
+                        if (event->mask & IN_ISDIR)
+                        {
+                            // Newly created sub-directories are watched as well
+                            if (event->mask & (IN_CREATE | IN_MOVED_TO))
+                            {
+                                AddWatchRecursive(path);
+                            }
+                            continue;
+                        }
+
+                        outChangedFiles.push_back(std::move(path));
+                    }
+                }
+            }
+
+        private:
+            void AddWatchRecursive(const std::string& directory)
+            {
+                namespace fs = std::filesystem;
+
+                AddWatch(directory);
+
+                std::error_code ec;
+                for (auto it = fs::recursive_directory_iterator(directory, ec);
+                     !ec && it != fs::recursive_directory_iterator(); it.increment(ec))
+                {
+                    if (it->is_directory(ec))
+                    {
+                        AddWatch(it->path().generic_string());
+                    }
+                }
+            }
+
+            void AddWatch(const std::string& directory)
+            {
+                int wd = ::inotify_add_watch(m_Fd, directory.c_str(), WATCH_MASK);
+                if (wd >= 0)
+                {
+                    m_WatchedDirectories[wd] = directory;
+                }
+            }
+
+        private:
+            int m_Fd = -1;
+            std::unordered_map<int, std::string> m_WatchedDirectories;
+        };
+    }
+
+    std::unique_ptr<FileWatchBackend> FileWatchBackend::Create()
+    {
+        return std::make_unique<LinuxFileWatchBackend>();
+    }
+}
+
+#endif // __linux__
@@ -0,0 +1,54 @@
+#include "EnginePCH.h"
+#include "Core/MappedFile.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace NanSu
+{
+    bool MappedFile::Open(const std::string& filePath)
+    {
+        Close();
+
+        int fd = ::open(filePath.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        struct stat info = {};
+        if (::fstat(fd, &info) != 0 || info.st_size == 0)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        void* view = ::mmap(nullptr, static_cast<usize>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);    // The mapping keeps its own reference to the file
+
+        if (view == MAP_FAILED)
+        {
+            return false;
+        }
+
+        m_Data = static_cast<const byte*>(view);
+        m_Size = static_cast<usize>(info.st_size);
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_Data)
+        {
+            ::munmap(const_cast<byte*>(m_Data), m_Size);
+            m_Data = nullptr;
+            m_Size = 0;
+        }
+    }
+}
+
+#endif // __unix__ || __APPLE__
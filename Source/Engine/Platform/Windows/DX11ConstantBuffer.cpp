@@ -5,7 +5,7 @@
 
 #include "Core/Application.h"
 
-#include <d3d11.h>
+#include <d3d11_1.h>
 
 namespace NanSu
 {
@@ -30,23 +30,43 @@ namespace NanSu
         // DX11 requires constant buffer size to be multiple of 16 bytes
         uint32 alignedSize = (size + 15) & ~15;
         m_Size = alignedSize;
+        m_Shadow.assign(alignedSize, 0);
 
         D3D11_BUFFER_DESC bufferDesc = {};
-        bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+        bufferDesc.Usage = D3D11_USAGE_DEFAULT;
         bufferDesc.ByteWidth = alignedSize;
         bufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-        bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        bufferDesc.CPUAccessFlags = 0;
         bufferDesc.MiscFlags = 0;
         bufferDesc.StructureByteStride = 0;
 
-        HRESULT hr = device->CreateBuffer(&bufferDesc, nullptr, &m_Buffer);
+        D3D11_SUBRESOURCE_DATA initData = {};
+        initData.pSysMem = m_Shadow.data();
+
+        HRESULT hr = device->CreateBuffer(&bufferDesc, &initData, &m_Buffer);
         NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create constant buffer");
 
+        // Partial updates need a Direct3D 11.1 context and driver support
+        D3D11_FEATURE_DATA_D3D11_OPTIONS options = {};
+        if (SUCCEEDED(device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options))) &&
+            options.ConstantBufferPartialUpdate)
+        {
+            auto* deviceContext = static_cast<ID3D11DeviceContext*>(
+                Application::Get().GetGraphicsContext().GetNativeDeviceContext());
+            deviceContext->QueryInterface(__uuidof(ID3D11DeviceContext1), reinterpret_cast<void**>(&m_DeviceContext1));
+        }
+
         NS_ENGINE_INFO("Constant buffer created (size: {} bytes, aligned: {} bytes)", size, alignedSize);
     }
 
     DX11ConstantBuffer::~DX11ConstantBuffer()
     {
+        if (m_DeviceContext1)
+        {
+            m_DeviceContext1->Release();
+            m_DeviceContext1 = nullptr;
+        }
+
         if (m_Buffer)
         {
             m_Buffer->Release();
@@ -59,16 +79,49 @@ namespace NanSu
         NS_ENGINE_ASSERT(size <= m_Size, "Data size ({}) exceeds buffer size ({})", size, m_Size);
         NS_ENGINE_ASSERT(data != nullptr, "Data pointer is null");
 
-        auto* deviceContext = static_cast<ID3D11DeviceContext*>(
-            Application::Get().GetGraphicsContext().GetNativeDeviceContext());
+        memcpy(m_Shadow.data(), data, size);
+        Upload(0, m_Size);
+    }
+
+    void DX11ConstantBuffer::SetSubData(const void* data, uint32 offset, uint32 size)
+    {
+        NS_ENGINE_ASSERT(offset + size <= m_Size,
+            "Range [{}, {}) exceeds buffer size ({})", offset, offset + size, m_Size);
+        NS_ENGINE_ASSERT(data != nullptr, "Data pointer is null");
+
+        if (size == 0)
+        {
+            return;
+        }
+
+        memcpy(m_Shadow.data() + offset, data, size);
+        Upload(offset, size);
+    }
 
-        D3D11_MAPPED_SUBRESOURCE mappedResource;
-        HRESULT hr = deviceContext->Map(m_Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to map constant buffer");
+    void DX11ConstantBuffer::Upload(uint32 offset, uint32 size)
+    {
+        // Partial updates must cover whole 16-byte registers
+        uint32 begin = offset & ~15u;
+        uint32 end = (offset + size + 15) & ~15u;
+
+        if (m_DeviceContext1 && (begin != 0 || end != m_Size))
+        {
+            D3D11_BOX box = {};
+            box.left = begin;
+            box.right = end;
+            box.top = 0;
+            box.bottom = 1;
+            box.front = 0;
+            box.back = 1;
+
+            m_DeviceContext1->UpdateSubresource1(m_Buffer, 0, &box, m_Shadow.data() + begin, 0, 0, 0);
+            return;
+        }
 
-        memcpy(mappedResource.pData, data, size);
+        auto* deviceContext = static_cast<ID3D11DeviceContext*>(
+            Application::Get().GetGraphicsContext().GetNativeDeviceContext());
 
-        deviceContext->Unmap(m_Buffer, 0);
+        deviceContext->UpdateSubresource(m_Buffer, 0, nullptr, m_Shadow.data(), 0, 0);
     }
 
     void DX11ConstantBuffer::Bind(uint32 slot) const
@@ -2,17 +2,23 @@
 
 #include "Renderer/ConstantBuffer.h"
 
+#include <vector>
+
 #ifdef NS_PLATFORM_WINDOWS
 
 // Forward declaration to avoid including DX11 headers in header file
 struct ID3D11Buffer;
+struct ID3D11DeviceContext1;
 
 namespace NanSu
 {
     /**
      * @brief DirectX 11 implementation of ConstantBuffer
      *
-     * Uses D3D11_USAGE_DYNAMIC for efficient per-frame updates.
+     * Uses D3D11_USAGE_DEFAULT with a CPU shadow copy of the contents. On
+     * Direct3D 11.1 drivers that support partial constant buffer updates,
+     * SetSubData() transfers only the registers covering the changed range
+     * (UpdateSubresource1); otherwise the whole shadow is uploaded.
      */
     class DX11ConstantBuffer : public ConstantBuffer
     {
@@ -25,12 +31,26 @@ namespace NanSu
         ~DX11ConstantBuffer();
 
         void SetData(const void* data, uint32 size) override;
+        void SetSubData(const void* data, uint32 offset, uint32 size) override;
         void Bind(uint32 slot) const override;
         void Unbind(uint32 slot) const override;
+        uint32 GetSize() const override { return m_Size; }
+
+    private:
+        /**
+         * @brief Upload the shadow bytes covering [offset, offset + size) to the GPU
+         */
+        void Upload(uint32 offset, uint32 size);
 
     private:
         ID3D11Buffer* m_Buffer = nullptr;
         uint32 m_Size = 0;
+
+        // CPU copy of the buffer contents (source of partial and full uploads)
+        std::vector<byte> m_Shadow;
+
+        // Set when the driver supports partial constant buffer updates
+        ID3D11DeviceContext1* m_DeviceContext1 = nullptr;
     };
 
 }
@@ -4,7 +4,7 @@
 #ifdef NS_PLATFORM_WINDOWS
 
 #include <d3d11.h>
-#include <dxgi.h>
+#include <dxgi1_5.h>
 
 // Link required libraries
 #pragma comment(lib, "d3d11.lib")
@@ -12,6 +12,37 @@
 
 namespace NanSu
 {
+    namespace
+    {
+        /**
+         * @brief Check whether the display stack can present without waiting for vblank
+         * (variable refresh rate displays, uncapped benchmarks)
+         */
+        bool CheckTearingSupport()
+        {
+            IDXGIFactory1* factory = nullptr;
+            if (FAILED(CreateDXGIFactory1(__uuidof(IDXGIFactory1), reinterpret_cast<void**>(&factory))))
+            {
+                return false;
+            }
+
+            BOOL allowTearing = FALSE;
+            IDXGIFactory5* factory5 = nullptr;
+            if (SUCCEEDED(factory->QueryInterface(__uuidof(IDXGIFactory5), reinterpret_cast<void**>(&factory5))))
+            {
+                if (FAILED(factory5->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING,
+                                                         &allowTearing, sizeof(allowTearing))))
+                {
+                    allowTearing = FALSE;
+                }
+                factory5->Release();
+            }
+
+            factory->Release();
+            return allowTearing == TRUE;
+        }
+    }
+
     // Factory method implementation
     GraphicsContext* GraphicsContext::Create(void* windowHandle, uint32 width, uint32 height)
     {
@@ -34,6 +65,14 @@ namespace NanSu
     {
         NS_ENGINE_INFO("Initializing DirectX 11 context ({}x{})", m_Width, m_Height);
 
+        // Tearing must be enabled on the swap chain to present uncapped in windowed mode
+        m_TearingSupported = CheckTearingSupport();
+        m_SwapChainFlags = DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH;
+        if (m_TearingSupported)
+        {
+            m_SwapChainFlags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
+        }
+
         // Describe the swap chain
         DXGI_SWAP_CHAIN_DESC swapChainDesc = {};
         swapChainDesc.BufferCount = 2;  // Double buffering
@@ -48,7 +87,7 @@ namespace NanSu
         swapChainDesc.SampleDesc.Quality = 0;
         swapChainDesc.Windowed = TRUE;
         swapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;  // Modern swap effect
-        swapChainDesc.Flags = DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH;
+        swapChainDesc.Flags = m_SwapChainFlags;
 
         // Feature levels to try (ordered by preference)
         D3D_FEATURE_LEVEL featureLevels[] =
@@ -95,6 +134,7 @@ namespace NanSu
         NS_ENGINE_INFO("  Feature Level: {}.{}",
                       (featureLevelObtained >> 12) & 0xF,
                       (featureLevelObtained >> 8) & 0xF);
+        NS_ENGINE_INFO("  Tearing: {}", m_TearingSupported ? "supported" : "not supported");
 
         // Create render target view
         if (!CreateRenderTargetView())
@@ -173,8 +213,13 @@ namespace NanSu
 
     void DX11Context::SwapBuffers()
     {
-        // Present with vsync (1) or without (0)
-        HRESULT hr = m_SwapChain->Present(1, 0);  // VSync enabled
+        // Immediate and capped modes do not wait for vblank; capped is paced by the FramePacer
+        UINT syncInterval = m_PresentMode.Mode == PresentMode::Type::VSync ? 1 : 0;
+        UINT presentFlags = (syncInterval == 0 && m_TearingSupported) ? DXGI_PRESENT_ALLOW_TEARING : 0;
+
+        m_FramePacer.BeginPresent();
+        HRESULT hr = m_SwapChain->Present(syncInterval, presentFlags);
+        m_FramePacer.EndPresent();
 
         if (FAILED(hr))
         {
@@ -216,7 +261,7 @@ namespace NanSu
             0,                              // Keep buffer count
             width, height,                  // New dimensions
             DXGI_FORMAT_UNKNOWN,            // Keep format
-            DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH
+            m_SwapChainFlags                // Must match the creation flags
         );
 
         if (FAILED(hr))
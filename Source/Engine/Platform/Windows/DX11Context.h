@@ -68,6 +68,10 @@ namespace NanSu
 
         // Render targets
         ID3D11RenderTargetView* m_RenderTargetView = nullptr;
+
+        // Presentation
+        uint32 m_SwapChainFlags = 0;
+        bool m_TearingSupported = false;
     };
 }
 
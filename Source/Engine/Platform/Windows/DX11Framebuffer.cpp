@@ -0,0 +1,424 @@
+#include "EnginePCH.h"
+#include "Platform/Windows/DX11Framebuffer.h"
+
+#ifdef NS_PLATFORM_WINDOWS
+
+#include "Core/Application.h"
+#include "Renderer/RenderCommand.h"
+
+#include <d3d11.h>
+
+#include <cstring>
+
+namespace NanSu
+{
+    namespace
+    {
+        // Texture slots unbound before rendering, so no attachment is read and written at once
+        constexpr uint32 UNBOUND_TEXTURE_SLOTS = 16;
+
+        DXGI_FORMAT ToDXGIFormat(FramebufferFormat format)
+        {
+            switch (format)
+            {
+                case FramebufferFormat::RGBA8:              return DXGI_FORMAT_R8G8B8A8_UNORM;
+                case FramebufferFormat::RGBA16F:            return DXGI_FORMAT_R16G16B16A16_FLOAT;
+                case FramebufferFormat::R32UInt:            return DXGI_FORMAT_R32_UINT;
+                case FramebufferFormat::Depth24Stencil8:    return DXGI_FORMAT_D24_UNORM_S8_UINT;
+                case FramebufferFormat::None:
+                default:
+                    NS_ENGINE_ASSERT(false, "Invalid FramebufferFormat");
+                    return DXGI_FORMAT_UNKNOWN;
+            }
+        }
+
+        ID3D11Device* GetDevice()
+        {
+            return static_cast<ID3D11Device*>(
+                Application::Get().GetGraphicsContext().GetNativeDevice());
+        }
+
+        ID3D11DeviceContext* GetDeviceContext()
+        {
+            return static_cast<ID3D11DeviceContext*>(
+                Application::Get().GetGraphicsContext().GetNativeDeviceContext());
+        }
+    }
+
+    // =========================================================================
+    // Factory Method
+    // =========================================================================
+
+    Framebuffer* Framebuffer::Create(const FramebufferSpecification& spec)
+    {
+        return new DX11Framebuffer(spec);
+    }
+
+    // =========================================================================
+    // DX11FramebufferAttachment
+    // =========================================================================
+
+    DX11FramebufferAttachment::DX11FramebufferAttachment(FramebufferFormat format, uint32 width, uint32 height)
+        : m_Format(format)
+        , m_Width(width)
+        , m_Height(height)
+    {
+        Create();
+    }
+
+    DX11FramebufferAttachment::~DX11FramebufferAttachment()
+    {
+        Release();
+    }
+
+    void DX11FramebufferAttachment::Bind(uint32 slot) const
+    {
+        GetDeviceContext()->PSSetShaderResources(slot, 1, &m_ShaderResourceView);
+    }
+
+    void DX11FramebufferAttachment::Unbind(uint32 slot) const
+    {
+        ID3D11ShaderResourceView* nullSRV = nullptr;
+        GetDeviceContext()->PSSetShaderResources(slot, 1, &nullSRV);
+    }
+
+    void DX11FramebufferAttachment::SetData(const void* data, uint32 size)
+    {
+        uint32 rowPitch = m_Width * GetBytesPerPixel(m_Format);
+        NS_ENGINE_ASSERT(size == rowPitch * m_Height,
+            "Data size ({}) does not match attachment size ({})", size, rowPitch * m_Height);
+
+        GetDeviceContext()->UpdateSubresource(m_Texture, 0, nullptr, data, rowPitch, 0);
+    }
+
+    void DX11FramebufferAttachment::Recreate(uint32 width, uint32 height)
+    {
+        Release();
+
+        m_Width = width;
+        m_Height = height;
+        Create();
+    }
+
+    bool DX11FramebufferAttachment::ReadPixels(uint32 x, uint32 y, uint32 width, uint32 height, void* outData)
+    {
+        if (x + width > m_Width || y + height > m_Height || width == 0 || height == 0)
+        {
+            NS_ENGINE_ERROR("ReadPixels rectangle ({}, {}, {}x{}) is outside the {}x{} attachment",
+                            x, y, width, height, m_Width, m_Height);
+            return false;
+        }
+
+        ID3D11DeviceContext* deviceContext = GetDeviceContext();
+
+        // Full-size staging copy, kept for later reads until the next resize
+        if (!m_StagingTexture)
+        {
+            D3D11_TEXTURE2D_DESC stagingDesc = {};
+            stagingDesc.Width = m_Width;
+            stagingDesc.Height = m_Height;
+            stagingDesc.MipLevels = 1;
+            stagingDesc.ArraySize = 1;
+            stagingDesc.Format = ToDXGIFormat(m_Format);
+            stagingDesc.SampleDesc.Count = 1;
+            stagingDesc.Usage = D3D11_USAGE_STAGING;
+            stagingDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+
+            HRESULT hr = GetDevice()->CreateTexture2D(&stagingDesc, nullptr, &m_StagingTexture);
+            if (FAILED(hr))
+            {
+                NS_ENGINE_ERROR("Failed to create framebuffer staging texture. HRESULT: {:#x}",
+                                static_cast<uint32>(hr));
+                return false;
+            }
+        }
+
+        // Only the requested rectangle is copied
+        D3D11_BOX sourceBox = {};
+        sourceBox.left = x;
+        sourceBox.right = x + width;
+        sourceBox.top = y;
+        sourceBox.bottom = y + height;
+        sourceBox.front = 0;
+        sourceBox.back = 1;
+        deviceContext->CopySubresourceRegion(m_StagingTexture, 0, 0, 0, 0, m_Texture, 0, &sourceBox);
+
+        // Blocks until the copy has executed on the GPU
+        D3D11_MAPPED_SUBRESOURCE mapped = {};
+        HRESULT hr = deviceContext->Map(m_StagingTexture, 0, D3D11_MAP_READ, 0, &mapped);
+        if (FAILED(hr))
+        {
+            NS_ENGINE_ERROR("Failed to map framebuffer staging texture. HRESULT: {:#x}",
+                            static_cast<uint32>(hr));
+            return false;
+        }
+
+        uint32 rowSize = width * GetBytesPerPixel(m_Format);
+        const byte* source = static_cast<const byte*>(mapped.pData);
+        byte* destination = static_cast<byte*>(outData);
+        for (uint32 row = 0; row < height; ++row)
+        {
+            std::memcpy(destination + row * rowSize, source + row * mapped.RowPitch, rowSize);
+        }
+
+        deviceContext->Unmap(m_StagingTexture, 0);
+        return true;
+    }
+
+    void DX11FramebufferAttachment::Create()
+    {
+        ID3D11Device* device = GetDevice();
+
+        D3D11_TEXTURE2D_DESC textureDesc = {};
+        textureDesc.Width = m_Width;
+        textureDesc.Height = m_Height;
+        textureDesc.MipLevels = 1;
+        textureDesc.ArraySize = 1;
+        textureDesc.Format = ToDXGIFormat(m_Format);
+        textureDesc.SampleDesc.Count = 1;
+        textureDesc.SampleDesc.Quality = 0;
+        textureDesc.Usage = D3D11_USAGE_DEFAULT;
+        textureDesc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+
+        HRESULT hr = device->CreateTexture2D(&textureDesc, nullptr, &m_Texture);
+        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create framebuffer color attachment");
+
+        hr = device->CreateRenderTargetView(m_Texture, nullptr, &m_RenderTargetView);
+        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create framebuffer render target view");
+
+        hr = device->CreateShaderResourceView(m_Texture, nullptr, &m_ShaderResourceView);
+        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create framebuffer shader resource view");
+    }
+
+    void DX11FramebufferAttachment::Release()
+    {
+        if (m_StagingTexture)
+        {
+            m_StagingTexture->Release();
+            m_StagingTexture = nullptr;
+        }
+
+        if (m_ShaderResourceView)
+        {
+            m_ShaderResourceView->Release();
+            m_ShaderResourceView = nullptr;
+        }
+
+        if (m_RenderTargetView)
+        {
+            m_RenderTargetView->Release();
+            m_RenderTargetView = nullptr;
+        }
+
+        if (m_Texture)
+        {
+            m_Texture->Release();
+            m_Texture = nullptr;
+        }
+    }
+
+    // =========================================================================
+    // DX11Framebuffer
+    // =========================================================================
+
+    DX11Framebuffer::DX11Framebuffer(const FramebufferSpecification& spec)
+        : m_Specification(spec)
+    {
+        NS_ENGINE_ASSERT(spec.Width > 0 && spec.Height > 0, "Framebuffer size must not be zero");
+
+        for (FramebufferFormat format : spec.Attachments)
+        {
+            if (IsDepthFormat(format))
+            {
+                NS_ENGINE_ASSERT(m_DepthFormat == FramebufferFormat::None, "Framebuffer has more than one depth attachment");
+                m_DepthFormat = format;
+            }
+            else
+            {
+                m_ColorAttachments.push_back(
+                    std::make_unique<DX11FramebufferAttachment>(format, spec.Width, spec.Height));
+            }
+        }
+
+        NS_ENGINE_ASSERT(m_ColorAttachments.size() <= D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT,
+                         "Too many framebuffer color attachments");
+
+        CreateDepthAttachment();
+
+        NS_ENGINE_INFO("Framebuffer created ({}x{}, {} color attachment(s){})",
+                       spec.Width, spec.Height, m_ColorAttachments.size(),
+                       m_DepthStencilView ? ", depth" : "");
+    }
+
+    DX11Framebuffer::~DX11Framebuffer()
+    {
+        NS_ENGINE_ASSERT(!m_Bound, "Framebuffer destroyed while bound");
+
+        ReleaseDepthAttachment();
+    }
+
+    void DX11Framebuffer::Bind()
+    {
+        NS_ENGINE_ASSERT(!m_Bound, "Framebuffer is already bound");
+
+        ID3D11DeviceContext* deviceContext = GetDeviceContext();
+
+        // Attachments sampled by the previous pass must not stay bound as inputs
+        ID3D11ShaderResourceView* nullSRVs[UNBOUND_TEXTURE_SLOTS] = {};
+        deviceContext->PSSetShaderResources(0, UNBOUND_TEXTURE_SLOTS, nullSRVs);
+
+        ID3D11RenderTargetView* renderTargets[D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT] = {};
+        for (usize i = 0; i < m_ColorAttachments.size(); ++i)
+        {
+            renderTargets[i] = m_ColorAttachments[i]->GetRenderTargetView();
+        }
+        deviceContext->OMSetRenderTargets(static_cast<UINT>(m_ColorAttachments.size()),
+                                          renderTargets, m_DepthStencilView);
+
+        // Remember the window viewport, then cover the whole framebuffer
+        UINT viewportCount = 1;
+        D3D11_VIEWPORT previous = {};
+        deviceContext->RSGetViewports(&viewportCount, &previous);
+        m_SavedViewport[0] = previous.TopLeftX;
+        m_SavedViewport[1] = previous.TopLeftY;
+        m_SavedViewport[2] = previous.Width;
+        m_SavedViewport[3] = previous.Height;
+        m_SavedViewport[4] = previous.MinDepth;
+        m_SavedViewport[5] = previous.MaxDepth;
+
+        RenderCommand::SetViewport(0, 0, m_Specification.Width, m_Specification.Height);
+
+        m_Bound = true;
+    }
+
+    void DX11Framebuffer::Unbind()
+    {
+        NS_ENGINE_ASSERT(m_Bound, "Framebuffer is not bound");
+
+        RenderCommand::BindRenderTarget();
+
+        D3D11_VIEWPORT viewport = {};
+        viewport.TopLeftX = m_SavedViewport[0];
+        viewport.TopLeftY = m_SavedViewport[1];
+        viewport.Width = m_SavedViewport[2];
+        viewport.Height = m_SavedViewport[3];
+        viewport.MinDepth = m_SavedViewport[4];
+        viewport.MaxDepth = m_SavedViewport[5];
+        GetDeviceContext()->RSSetViewports(1, &viewport);
+
+        m_Bound = false;
+    }
+
+    void DX11Framebuffer::Resize(uint32 width, uint32 height)
+    {
+        if (width == 0 || height == 0)
+        {
+            return;  // Minimized viewport panels report zero sizes
+        }
+
+        if (width == m_Specification.Width && height == m_Specification.Height)
+        {
+            return;
+        }
+
+        m_Specification.Width = width;
+        m_Specification.Height = height;
+
+        for (auto& attachment : m_ColorAttachments)
+        {
+            attachment->Recreate(width, height);
+        }
+
+        ReleaseDepthAttachment();
+        CreateDepthAttachment();
+
+        // Re-bind the new views when resized mid-pass
+        if (m_Bound)
+        {
+            Unbind();
+            Bind();
+        }
+    }
+
+    void DX11Framebuffer::Clear(const vec4& color)
+    {
+        ID3D11DeviceContext* deviceContext = GetDeviceContext();
+
+        for (const auto& attachment : m_ColorAttachments)
+        {
+            deviceContext->ClearRenderTargetView(attachment->GetRenderTargetView(), &color.x);
+        }
+
+        if (m_DepthStencilView)
+        {
+            deviceContext->ClearDepthStencilView(m_DepthStencilView,
+                                                 D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
+        }
+    }
+
+    void DX11Framebuffer::ClearAttachment(uint32 index, const vec4& value)
+    {
+        NS_ENGINE_ASSERT(index < m_ColorAttachments.size(), "Color attachment index out of range");
+
+        GetDeviceContext()->ClearRenderTargetView(m_ColorAttachments[index]->GetRenderTargetView(), &value.x);
+    }
+
+    Texture2D* DX11Framebuffer::GetColorAttachment(uint32 index) const
+    {
+        NS_ENGINE_ASSERT(index < m_ColorAttachments.size(), "Color attachment index out of range");
+
+        return m_ColorAttachments[index].get();
+    }
+
+    bool DX11Framebuffer::ReadPixels(uint32 index, uint32 x, uint32 y, uint32 width, uint32 height, void* outData)
+    {
+        NS_ENGINE_ASSERT(index < m_ColorAttachments.size(), "Color attachment index out of range");
+
+        return m_ColorAttachments[index]->ReadPixels(x, y, width, height, outData);
+    }
+
+    void DX11Framebuffer::CreateDepthAttachment()
+    {
+        if (m_DepthFormat == FramebufferFormat::None)
+        {
+            return;
+        }
+
+        ID3D11Device* device = GetDevice();
+
+        D3D11_TEXTURE2D_DESC depthDesc = {};
+        depthDesc.Width = m_Specification.Width;
+        depthDesc.Height = m_Specification.Height;
+        depthDesc.MipLevels = 1;
+        depthDesc.ArraySize = 1;
+        depthDesc.Format = ToDXGIFormat(m_DepthFormat);
+        depthDesc.SampleDesc.Count = 1;
+        depthDesc.SampleDesc.Quality = 0;
+        depthDesc.Usage = D3D11_USAGE_DEFAULT;
+        depthDesc.BindFlags = D3D11_BIND_DEPTH_STENCIL;
+
+        HRESULT hr = device->CreateTexture2D(&depthDesc, nullptr, &m_DepthTexture);
+        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create framebuffer depth attachment");
+
+        hr = device->CreateDepthStencilView(m_DepthTexture, nullptr, &m_DepthStencilView);
+        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create framebuffer depth stencil view");
+    }
+
+    void DX11Framebuffer::ReleaseDepthAttachment()
+    {
+        if (m_DepthStencilView)
+        {
+            m_DepthStencilView->Release();
+            m_DepthStencilView = nullptr;
+        }
+
+        if (m_DepthTexture)
+        {
+            m_DepthTexture->Release();
+            m_DepthTexture = nullptr;
+        }
+    }
+
+} // namespace NanSu
+
+#endif // NS_PLATFORM_WINDOWS
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Renderer/Framebuffer.h"
+#include "Renderer/Texture.h"
+
+#ifdef NS_PLATFORM_WINDOWS
+
+#include <memory>
+
+// Forward declarations to avoid including DX11 headers
+struct ID3D11Texture2D;
+struct ID3D11RenderTargetView;
+struct ID3D11ShaderResourceView;
+struct ID3D11DepthStencilView;
+
+namespace NanSu
+{
+    /**
+     * @brief Color attachment of a DX11Framebuffer, sampleable as a Texture2D
+     *
+     * Owns the render target, its render target and shader resource views,
+     * and a staging copy created on the first ReadPixels(). The framebuffer
+     * recreates the resources in place on resize, so pointers handed out to
+     * Renderer2D or materials stay valid.
+     */
+    class DX11FramebufferAttachment : public Texture2D
+    {
+    public:
+        DX11FramebufferAttachment(FramebufferFormat format, uint32 width, uint32 height);
+        ~DX11FramebufferAttachment();
+
+        // Texture interface
+        uint32 GetWidth() const override { return m_Width; }
+        uint32 GetHeight() const override { return m_Height; }
+        void Bind(uint32 slot = 0) const override;
+        void Unbind(uint32 slot = 0) const override;
+
+        // Texture2D interface
+        void SetData(const void* data, uint32 size) override;
+        bool Reload() override { return false; }
+
+        /**
+         * @brief Release and recreate the GPU resources with a new size
+         */
+        void Recreate(uint32 width, uint32 height);
+
+        /**
+         * @brief Copy a rectangle to CPU memory through the staging texture
+         */
+        bool ReadPixels(uint32 x, uint32 y, uint32 width, uint32 height, void* outData);
+
+        FramebufferFormat GetFormat() const { return m_Format; }
+        ID3D11RenderTargetView* GetRenderTargetView() const { return m_RenderTargetView; }
+
+    private:
+        void Create();
+        void Release();
+
+    private:
+        FramebufferFormat m_Format;
+        uint32 m_Width = 0;
+        uint32 m_Height = 0;
+
+        // DX11 resources
+        ID3D11Texture2D* m_Texture = nullptr;
+        ID3D11RenderTargetView* m_RenderTargetView = nullptr;
+        ID3D11ShaderResourceView* m_ShaderResourceView = nullptr;
+        ID3D11Texture2D* m_StagingTexture = nullptr;    // CPU-readable copy, created on demand
+    };
+
+    /**
+     * @brief DirectX 11 implementation of Framebuffer
+     *
+     * Binds all color attachments as simultaneous render targets together
+     * with the optional depth/stencil buffer.
+     */
+    class DX11Framebuffer : public Framebuffer
+    {
+    public:
+        DX11Framebuffer(const FramebufferSpecification& spec);
+        ~DX11Framebuffer();
+
+        void Bind() override;
+        void Unbind() override;
+        void Resize(uint32 width, uint32 height) override;
+
+        void Clear(const vec4& color) override;
+        void ClearAttachment(uint32 index, const vec4& value) override;
+
+        Texture2D* GetColorAttachment(uint32 index = 0) const override;
+        uint32 GetColorAttachmentCount() const override { return static_cast<uint32>(m_ColorAttachments.size()); }
+
+        bool ReadPixels(uint32 index, uint32 x, uint32 y, uint32 width, uint32 height, void* outData) override;
+
+        const FramebufferSpecification& GetSpecification() const override { return m_Specification; }
+
+    private:
+        void CreateDepthAttachment();
+        void ReleaseDepthAttachment();
+
+    private:
+        FramebufferSpecification m_Specification;
+
+        std::vector<std::unique_ptr<DX11FramebufferAttachment>> m_ColorAttachments;
+        FramebufferFormat m_DepthFormat = FramebufferFormat::None;
+
+        ID3D11Texture2D* m_DepthTexture = nullptr;
+        ID3D11DepthStencilView* m_DepthStencilView = nullptr;
+
+        // Viewport saved by Bind() (x, y, width, height, min depth, max depth)
+        float32 m_SavedViewport[6] = {};
+        bool m_Bound = false;
+    };
+
+} // namespace NanSu
+
+#endif // NS_PLATFORM_WINDOWS
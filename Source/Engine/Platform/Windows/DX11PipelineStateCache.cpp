@@ -0,0 +1,249 @@
+#include "EnginePCH.h"
+#include "Platform/Windows/DX11PipelineStateCache.h"
+
+#ifdef NS_PLATFORM_WINDOWS
+
+#include "Core/Application.h"
+
+#include <d3d11.h>
+
+namespace NanSu
+{
+    // =========================================================================
+    // Helper Functions
+    // =========================================================================
+
+    namespace
+    {
+        ID3D11Device* GetDevice()
+        {
+            return static_cast<ID3D11Device*>(
+                Application::Get().GetGraphicsContext().GetNativeDevice());
+        }
+
+        D3D11_COMPARISON_FUNC CompareFuncToDX11(CompareFunc func)
+        {
+            switch (func)
+            {
+                case CompareFunc::Never:        return D3D11_COMPARISON_NEVER;
+                case CompareFunc::Less:         return D3D11_COMPARISON_LESS;
+                case CompareFunc::Equal:        return D3D11_COMPARISON_EQUAL;
+                case CompareFunc::LessEqual:    return D3D11_COMPARISON_LESS_EQUAL;
+                case CompareFunc::Greater:      return D3D11_COMPARISON_GREATER;
+                case CompareFunc::NotEqual:     return D3D11_COMPARISON_NOT_EQUAL;
+                case CompareFunc::GreaterEqual: return D3D11_COMPARISON_GREATER_EQUAL;
+                case CompareFunc::Always:       return D3D11_COMPARISON_ALWAYS;
+            }
+
+            NS_ENGINE_ASSERT(false, "Invalid CompareFunc");
+            return D3D11_COMPARISON_ALWAYS;
+        }
+
+        D3D11_CULL_MODE CullModeToDX11(CullMode mode)
+        {
+            switch (mode)
+            {
+                case CullMode::None:    return D3D11_CULL_NONE;
+                case CullMode::Front:   return D3D11_CULL_FRONT;
+                case CullMode::Back:    return D3D11_CULL_BACK;
+            }
+
+            NS_ENGINE_ASSERT(false, "Invalid CullMode");
+            return D3D11_CULL_NONE;
+        }
+
+        D3D11_TEXTURE_ADDRESS_MODE SamplerWrapToDX11(SamplerWrap wrap)
+        {
+            switch (wrap)
+            {
+                case SamplerWrap::Repeat:   return D3D11_TEXTURE_ADDRESS_WRAP;
+                case SamplerWrap::Clamp:    return D3D11_TEXTURE_ADDRESS_CLAMP;
+                case SamplerWrap::Mirror:   return D3D11_TEXTURE_ADDRESS_MIRROR;
+            }
+
+            NS_ENGINE_ASSERT(false, "Invalid SamplerWrap");
+            return D3D11_TEXTURE_ADDRESS_WRAP;
+        }
+
+        void SetBlendFactors(D3D11_RENDER_TARGET_BLEND_DESC& target, BlendMode mode)
+        {
+            target.BlendEnable = TRUE;
+            target.BlendOp = D3D11_BLEND_OP_ADD;
+            target.BlendOpAlpha = D3D11_BLEND_OP_ADD;
+            target.SrcBlendAlpha = D3D11_BLEND_ONE;
+            target.DestBlendAlpha = D3D11_BLEND_INV_SRC_ALPHA;
+
+            switch (mode)
+            {
+                case BlendMode::None:
+                    target.BlendEnable = FALSE;
+                    target.SrcBlend = D3D11_BLEND_ONE;
+                    target.DestBlend = D3D11_BLEND_ZERO;
+                    target.DestBlendAlpha = D3D11_BLEND_ZERO;
+                    break;
+
+                case BlendMode::Alpha:
+                    target.SrcBlend = D3D11_BLEND_SRC_ALPHA;
+                    target.DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
+                    break;
+
+                case BlendMode::Additive:
+                    // Adds light without covering what is underneath (destination alpha kept)
+                    target.SrcBlend = D3D11_BLEND_SRC_ALPHA;
+                    target.DestBlend = D3D11_BLEND_ONE;
+                    target.SrcBlendAlpha = D3D11_BLEND_ZERO;
+                    target.DestBlendAlpha = D3D11_BLEND_ONE;
+                    break;
+
+                case BlendMode::Multiply:
+                    // Source color arrives premultiplied: dst * (src * a + 1 - a), so
+                    // transparent texels leave the destination untouched
+                    target.SrcBlend = D3D11_BLEND_DEST_COLOR;
+                    target.DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
+                    target.SrcBlendAlpha = D3D11_BLEND_ZERO;
+                    target.DestBlendAlpha = D3D11_BLEND_ONE;
+                    break;
+
+                case BlendMode::Premultiplied:
+                    target.SrcBlend = D3D11_BLEND_ONE;
+                    target.DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
+                    break;
+
+                default:
+                    NS_ENGINE_ASSERT(false, "Invalid BlendMode");
+                    break;
+            }
+        }
+    }
+
+    // =========================================================================
+    // State Lookup
+    // =========================================================================
+
+    ID3D11BlendState* DX11PipelineStateCache::GetBlendState(const PipelineState& state)
+    {
+        uint32 key = state.GetBlendKey();
+        if (auto it = m_BlendStates.find(key); it != m_BlendStates.end())
+        {
+            return it->second;
+        }
+
+        D3D11_BLEND_DESC blendDesc = {};
+        blendDesc.AlphaToCoverageEnable = FALSE;
+        blendDesc.IndependentBlendEnable = FALSE;
+        SetBlendFactors(blendDesc.RenderTarget[0], state.Blend);
+        blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+
+        ID3D11BlendState* blendState = nullptr;
+        HRESULT hr = GetDevice()->CreateBlendState(&blendDesc, &blendState);
+        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create blend state");
+
+        m_BlendStates.emplace(key, blendState);
+        return blendState;
+    }
+
+    ID3D11DepthStencilState* DX11PipelineStateCache::GetDepthStencilState(const PipelineState& state)
+    {
+        uint32 key = state.GetDepthKey();
+        if (auto it = m_DepthStencilStates.find(key); it != m_DepthStencilStates.end())
+        {
+            return it->second;
+        }
+
+        D3D11_DEPTH_STENCIL_DESC depthDesc = {};
+        depthDesc.DepthEnable = state.DepthTest ? TRUE : FALSE;
+        depthDesc.DepthWriteMask = state.DepthWrite ? D3D11_DEPTH_WRITE_MASK_ALL : D3D11_DEPTH_WRITE_MASK_ZERO;
+        depthDesc.DepthFunc = CompareFuncToDX11(state.DepthCompare);
+        depthDesc.StencilEnable = FALSE;
+
+        ID3D11DepthStencilState* depthState = nullptr;
+        HRESULT hr = GetDevice()->CreateDepthStencilState(&depthDesc, &depthState);
+        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create depth stencil state");
+
+        m_DepthStencilStates.emplace(key, depthState);
+        return depthState;
+    }
+
+    ID3D11RasterizerState* DX11PipelineStateCache::GetRasterizerState(const PipelineState& state)
+    {
+        uint32 key = state.GetRasterizerKey();
+        if (auto it = m_RasterizerStates.find(key); it != m_RasterizerStates.end())
+        {
+            return it->second;
+        }
+
+        D3D11_RASTERIZER_DESC rasterizerDesc = {};
+        rasterizerDesc.FillMode = D3D11_FILL_SOLID;
+        rasterizerDesc.CullMode = CullModeToDX11(state.Cull);
+        rasterizerDesc.FrontCounterClockwise = FALSE;
+        rasterizerDesc.DepthClipEnable = TRUE;
+
+        ID3D11RasterizerState* rasterizerState = nullptr;
+        HRESULT hr = GetDevice()->CreateRasterizerState(&rasterizerDesc, &rasterizerState);
+        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create rasterizer state");
+
+        m_RasterizerStates.emplace(key, rasterizerState);
+        return rasterizerState;
+    }
+
+    ID3D11SamplerState* DX11PipelineStateCache::GetSamplerState(const PipelineState& state)
+    {
+        uint32 key = state.GetSamplerKey();
+        if (auto it = m_SamplerStates.find(key); it != m_SamplerStates.end())
+        {
+            return it->second;
+        }
+
+        D3D11_TEXTURE_ADDRESS_MODE address = SamplerWrapToDX11(state.Wrap);
+
+        D3D11_SAMPLER_DESC samplerDesc = {};
+        switch (state.Filter)
+        {
+            case SamplerFilter::Point:          samplerDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_POINT; break;
+            case SamplerFilter::Linear:         samplerDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR; break;
+            case SamplerFilter::Anisotropic:    samplerDesc.Filter = D3D11_FILTER_ANISOTROPIC; break;
+        }
+        samplerDesc.AddressU = address;
+        samplerDesc.AddressV = address;
+        samplerDesc.AddressW = address;
+        samplerDesc.MipLODBias = 0.0f;
+        samplerDesc.MaxAnisotropy = state.Filter == SamplerFilter::Anisotropic ? 8 : 1;
+        samplerDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
+        samplerDesc.MinLOD = 0.0f;
+        samplerDesc.MaxLOD = D3D11_FLOAT32_MAX;
+
+        ID3D11SamplerState* samplerState = nullptr;
+        HRESULT hr = GetDevice()->CreateSamplerState(&samplerDesc, &samplerState);
+        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create sampler state");
+
+        m_SamplerStates.emplace(key, samplerState);
+        return samplerState;
+    }
+
+    // =========================================================================
+    // Cleanup
+    // =========================================================================
+
+    void DX11PipelineStateCache::Clear()
+    {
+        auto releaseAll = [](auto& states)
+        {
+            for (auto& [key, state] : states)
+            {
+                if (state)
+                {
+                    state->Release();
+                }
+            }
+            states.clear();
+        };
+
+        releaseAll(m_BlendStates);
+        releaseAll(m_DepthStencilStates);
+        releaseAll(m_RasterizerStates);
+        releaseAll(m_SamplerStates);
+    }
+
+}
+
+#endif
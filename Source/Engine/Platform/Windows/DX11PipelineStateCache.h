@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Renderer/PipelineState.h"
+
+#ifdef NS_PLATFORM_WINDOWS
+
+#include <unordered_map>
+
+// Forward declarations to avoid including DX11 headers
+struct ID3D11BlendState;
+struct ID3D11DepthStencilState;
+struct ID3D11RasterizerState;
+struct ID3D11SamplerState;
+
+namespace NanSu
+{
+    /**
+     * @brief Owns every DX11 fixed-function state object created by the engine
+     *
+     * Each part of a PipelineState (blend, depth, rasterizer, sampler) maps to
+     * its own native object, keyed by the packed description of that part.
+     * States are created on first request and shared afterwards, so e.g. all
+     * pipelines using alpha blending reference the same ID3D11BlendState.
+     */
+    class DX11PipelineStateCache
+    {
+    public:
+        DX11PipelineStateCache() = default;
+        ~DX11PipelineStateCache() { Clear(); }
+
+        // Non-copyable
+        DX11PipelineStateCache(const DX11PipelineStateCache&) = delete;
+        DX11PipelineStateCache& operator=(const DX11PipelineStateCache&) = delete;
+
+        ID3D11BlendState* GetBlendState(const PipelineState& state);
+        ID3D11DepthStencilState* GetDepthStencilState(const PipelineState& state);
+        ID3D11RasterizerState* GetRasterizerState(const PipelineState& state);
+        ID3D11SamplerState* GetSamplerState(const PipelineState& state);
+
+        /**
+         * @brief Release every cached state object
+         */
+        void Clear();
+
+        /**
+         * @brief Total number of native state objects created
+         */
+        usize GetStateCount() const
+        {
+            return m_BlendStates.size() + m_DepthStencilStates.size() +
+                   m_RasterizerStates.size() + m_SamplerStates.size();
+        }
+
+    private:
+        std::unordered_map<uint32, ID3D11BlendState*> m_BlendStates;
+        std::unordered_map<uint32, ID3D11DepthStencilState*> m_DepthStencilStates;
+        std::unordered_map<uint32, ID3D11RasterizerState*> m_RasterizerStates;
+        std::unordered_map<uint32, ID3D11SamplerState*> m_SamplerStates;
+    };
+
+}
+
+#endif
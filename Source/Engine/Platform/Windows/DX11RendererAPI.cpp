@@ -50,34 +50,13 @@ namespace NanSu
     {
         NS_ENGINE_INFO("Initializing DirectX 11 Renderer API");
 
-        auto* device = static_cast<ID3D11Device*>(
-            Application::Get().GetGraphicsContext().GetNativeDevice());
         auto* deviceContext = static_cast<ID3D11DeviceContext*>(
             Application::Get().GetGraphicsContext().GetNativeDeviceContext());
 
         deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-        // Create blend state for alpha blending
-        {
-            D3D11_BLEND_DESC blendDesc = {};
-            blendDesc.AlphaToCoverageEnable = FALSE;
-            blendDesc.IndependentBlendEnable = FALSE;
-            blendDesc.RenderTarget[0].BlendEnable = TRUE;
-            blendDesc.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA;
-            blendDesc.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
-            blendDesc.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD;
-            blendDesc.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ONE;
-            blendDesc.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_INV_SRC_ALPHA;
-            blendDesc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
-            blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
-
-            HRESULT hr = device->CreateBlendState(&blendDesc, &m_BlendState);
-            NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create blend state");
-
-            // Bind the blend state
-            float blendFactor[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
-            deviceContext->OMSetBlendState(m_BlendState, blendFactor, 0xFFFFFFFF);
-        }
+        // Default state: alpha blending, no depth test, no culling, linear/repeat sampler
+        SetPipelineState(PipelineState{});
 
         NS_ENGINE_INFO("DirectX 11 Renderer API initialized");
     }
@@ -86,11 +65,12 @@ namespace NanSu
     {
         NS_ENGINE_INFO("Shutting down DirectX 11 Renderer API");
 
-        if (m_BlendState)
-        {
-            m_BlendState->Release();
-            m_BlendState = nullptr;
-        }
+        NS_ENGINE_INFO("Pipeline state cache: {} state objects, {} redundant binds skipped",
+                       m_StateCache.GetStateCount(), m_SkippedStateBinds);
+
+        InvalidateBoundState();
+        m_HasCurrentState = false;
+        m_StateCache.Clear();
     }
 
     void DX11RendererAPI::SetViewport(uint32 x, uint32 y, uint32 width, uint32 height)
@@ -135,12 +115,66 @@ namespace NanSu
     {
         Application::Get().GetGraphicsContext().BindRenderTarget();
 
-        // Re-bind blend state (ImGui may have changed it)
+        // Re-bind pipeline state (ImGui may have changed it)
+        if (m_HasCurrentState)
+        {
+            InvalidateBoundState();
+            SetPipelineState(m_CurrentState);
+        }
+    }
+
+    void DX11RendererAPI::SetPipelineState(const PipelineState& state)
+    {
+        // Bound objects are null after InvalidateBoundState(), forcing a full re-bind
+        if (m_HasCurrentState && state == m_CurrentState && m_BoundBlendState)
+        {
+            ++m_SkippedStateBinds;
+            return;
+        }
+
+        m_CurrentState = state;
+        m_HasCurrentState = true;
+
         auto* deviceContext = static_cast<ID3D11DeviceContext*>(
             Application::Get().GetGraphicsContext().GetNativeDeviceContext());
 
-        float blendFactor[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
-        deviceContext->OMSetBlendState(m_BlendState, blendFactor, 0xFFFFFFFF);
+        // Only the parts that differ from what is bound reach the device context
+        ID3D11BlendState* blendState = m_StateCache.GetBlendState(state);
+        if (blendState != m_BoundBlendState)
+        {
+            float blendFactor[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            deviceContext->OMSetBlendState(blendState, blendFactor, 0xFFFFFFFF);
+            m_BoundBlendState = blendState;
+        }
+
+        ID3D11DepthStencilState* depthState = m_StateCache.GetDepthStencilState(state);
+        if (depthState != m_BoundDepthStencilState)
+        {
+            deviceContext->OMSetDepthStencilState(depthState, 0);
+            m_BoundDepthStencilState = depthState;
+        }
+
+        ID3D11RasterizerState* rasterizerState = m_StateCache.GetRasterizerState(state);
+        if (rasterizerState != m_BoundRasterizerState)
+        {
+            deviceContext->RSSetState(rasterizerState);
+            m_BoundRasterizerState = rasterizerState;
+        }
+
+        ID3D11SamplerState* samplerState = m_StateCache.GetSamplerState(state);
+        if (samplerState != m_BoundSamplerState)
+        {
+            deviceContext->PSSetSamplers(0, 1, &samplerState);
+            m_BoundSamplerState = samplerState;
+        }
+    }
+
+    void DX11RendererAPI::InvalidateBoundState()
+    {
+        m_BoundBlendState = nullptr;
+        m_BoundDepthStencilState = nullptr;
+        m_BoundRasterizerState = nullptr;
+        m_BoundSamplerState = nullptr;
     }
 
     void DX11RendererAPI::DrawIndexed(const IndexBuffer* indexBuffer, uint32 indexCount)
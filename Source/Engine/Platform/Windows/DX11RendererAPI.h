@@ -1,11 +1,15 @@
 #pragma once
 
 #include "Renderer/RendererAPI.h"
+#include "Platform/Windows/DX11PipelineStateCache.h"
 
 #ifdef NS_PLATFORM_WINDOWS
 
 // Forward declarations to avoid including DX11 headers
 struct ID3D11BlendState;
+struct ID3D11DepthStencilState;
+struct ID3D11RasterizerState;
+struct ID3D11SamplerState;
 
 namespace NanSu
 {
@@ -29,13 +33,30 @@ namespace NanSu
         void Clear() override;
         void SetPrimitiveTopology(PrimitiveTopology topology) override;
         void BindRenderTarget() override;
+        void SetPipelineState(const PipelineState& state) override;
         void DrawIndexed(const IndexBuffer* indexBuffer, uint32 indexCount = 0) override;
 
+    private:
+        /**
+         * @brief Forget what is bound so the next SetPipelineState binds every part
+         */
+        void InvalidateBoundState();
+
     private:
         float32 m_ClearColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
 
-        // DX11 pipeline states
-        ID3D11BlendState* m_BlendState = nullptr;
+        // DX11 pipeline states (owned by the cache)
+        DX11PipelineStateCache m_StateCache;
+        PipelineState m_CurrentState;
+        bool m_HasCurrentState = false;
+
+        // Objects currently bound to the device context (redundant bind filter)
+        ID3D11BlendState* m_BoundBlendState = nullptr;
+        ID3D11DepthStencilState* m_BoundDepthStencilState = nullptr;
+        ID3D11RasterizerState* m_BoundRasterizerState = nullptr;
+        ID3D11SamplerState* m_BoundSamplerState = nullptr;
+
+        uint32 m_SkippedStateBinds = 0;
     };
 
 }
@@ -4,12 +4,13 @@
 #ifdef NS_PLATFORM_WINDOWS
 
 #include "Core/Application.h"
+#include "Renderer/ShaderCache.h"
+#include "Asset/AssetWatcher.h"
 
 #include <d3d11.h>
+#include <d3d11shader.h>
 #include <d3dcompiler.h>
 
-#include <fstream>
-#include <sstream>
 #include <algorithm>
 
 #pragma comment(lib, "d3dcompiler.lib")
@@ -45,6 +46,58 @@ namespace NanSu
             return DXGI_FORMAT_UNKNOWN;
         }
 
+        ShaderDataType ReflectedTypeToShaderDataType(const D3D11_SHADER_TYPE_DESC& typeDesc)
+        {
+            if (typeDesc.Elements > 0)
+            {
+                return ShaderDataType::None;  // Arrays are written as raw bytes
+            }
+
+            if (typeDesc.Class == D3D_SVC_MATRIX_COLUMNS || typeDesc.Class == D3D_SVC_MATRIX_ROWS)
+            {
+                if (typeDesc.Type == D3D_SVT_FLOAT && typeDesc.Rows == typeDesc.Columns)
+                {
+                    if (typeDesc.Rows == 3) return ShaderDataType::Mat3;
+                    if (typeDesc.Rows == 4) return ShaderDataType::Mat4;
+                }
+                return ShaderDataType::None;
+            }
+
+            if (typeDesc.Class != D3D_SVC_SCALAR && typeDesc.Class != D3D_SVC_VECTOR)
+            {
+                return ShaderDataType::None;
+            }
+
+            switch (typeDesc.Type)
+            {
+                case D3D_SVT_FLOAT:
+                    switch (typeDesc.Columns)
+                    {
+                        case 1: return ShaderDataType::Float;
+                        case 2: return ShaderDataType::Float2;
+                        case 3: return ShaderDataType::Float3;
+                        case 4: return ShaderDataType::Float4;
+                    }
+                    break;
+                case D3D_SVT_INT:
+                case D3D_SVT_UINT:
+                    switch (typeDesc.Columns)
+                    {
+                        case 1: return ShaderDataType::Int;
+                        case 2: return ShaderDataType::Int2;
+                        case 3: return ShaderDataType::Int3;
+                        case 4: return ShaderDataType::Int4;
+                    }
+                    break;
+                case D3D_SVT_BOOL:
+                    return typeDesc.Columns == 1 ? ShaderDataType::Bool : ShaderDataType::None;
+                default:
+                    break;
+            }
+
+            return ShaderDataType::None;
+        }
+
         std::string ExtractNameFromPath(const std::string& filePath)
         {
             // Find last slash or backslash
@@ -85,39 +138,14 @@ namespace NanSu
         : m_FilePath(filePath)
         , m_Name(ExtractNameFromPath(filePath))
     {
-        std::string source = ReadFile(filePath);
+        AssetData sourceData = ReadFile(filePath);
+        std::string_view source = sourceData.AsString();
 
-        // Compile vertex shader
-        m_VSBlob = CompileShader(source, "VSMain", "vs_5_0");
-        NS_ENGINE_ASSERT(m_VSBlob, "Failed to compile vertex shader");
+        [[maybe_unused]] bool created = CreateShaders(source, source, m_VertexShader, m_PixelShader,
+                                                      m_VSBytecode, m_UniformBuffers);
+        NS_ENGINE_ASSERT(created, "Failed to create shader '{}'", m_Name);
 
-        // Compile pixel shader
-        auto* psBlob = static_cast<ID3DBlob*>(CompileShader(source, "PSMain", "ps_5_0"));
-        NS_ENGINE_ASSERT(psBlob, "Failed to compile pixel shader");
-
-        // Create shaders
-        auto* device = static_cast<ID3D11Device*>(
-            Application::Get().GetGraphicsContext().GetNativeDevice());
-
-        auto* vsBlob = static_cast<ID3DBlob*>(m_VSBlob);
-        HRESULT hr = device->CreateVertexShader(
-            vsBlob->GetBufferPointer(),
-            vsBlob->GetBufferSize(),
-            nullptr,
-            &m_VertexShader
-        );
-        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create vertex shader");
-
-        hr = device->CreatePixelShader(
-            psBlob->GetBufferPointer(),
-            psBlob->GetBufferSize(),
-            nullptr,
-            &m_PixelShader
-        );
-        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create pixel shader");
-
-        // Release PS blob (VS blob kept for input layout creation)
-        psBlob->Release();
+        m_WatchHandle = AssetWatcher::Watch(filePath, [this](const std::string&) { Reload(); });
 
         NS_ENGINE_INFO("Shader '{}' created from file: {}", m_Name, filePath);
     }
@@ -127,43 +155,17 @@ namespace NanSu
                            const std::string& pixelSource)
         : m_Name(name)
     {
-        // Compile vertex shader
-        m_VSBlob = CompileShader(vertexSource, "VSMain", "vs_5_0");
-        NS_ENGINE_ASSERT(m_VSBlob, "Failed to compile vertex shader");
-
-        // Compile pixel shader
-        auto* psBlob = static_cast<ID3DBlob*>(CompileShader(pixelSource, "PSMain", "ps_5_0"));
-        NS_ENGINE_ASSERT(psBlob, "Failed to compile pixel shader");
-
-        // Create shaders
-        auto* device = static_cast<ID3D11Device*>(
-            Application::Get().GetGraphicsContext().GetNativeDevice());
-
-        auto* vsBlob = static_cast<ID3DBlob*>(m_VSBlob);
-        HRESULT hr = device->CreateVertexShader(
-            vsBlob->GetBufferPointer(),
-            vsBlob->GetBufferSize(),
-            nullptr,
-            &m_VertexShader
-        );
-        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create vertex shader");
-
-        hr = device->CreatePixelShader(
-            psBlob->GetBufferPointer(),
-            psBlob->GetBufferSize(),
-            nullptr,
-            &m_PixelShader
-        );
-        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create pixel shader");
-
-        // Release PS blob (VS blob kept for input layout creation)
-        psBlob->Release();
+        [[maybe_unused]] bool created = CreateShaders(vertexSource, pixelSource, m_VertexShader, m_PixelShader,
+                                                      m_VSBytecode, m_UniformBuffers);
+        NS_ENGINE_ASSERT(created, "Failed to create shader '{}'", m_Name);
 
         NS_ENGINE_INFO("Shader '{}' created from source", m_Name);
     }
 
     DX11Shader::~DX11Shader()
     {
+        AssetWatcher::Unwatch(m_WatchHandle);
+
         if (m_InputLayout)
         {
             m_InputLayout->Release();
@@ -182,11 +184,6 @@ namespace NanSu
             m_VertexShader = nullptr;
         }
 
-        if (m_VSBlob)
-        {
-            static_cast<ID3DBlob*>(m_VSBlob)->Release();
-            m_VSBlob = nullptr;
-        }
     }
 
     void DX11Shader::Bind() const
@@ -215,50 +212,240 @@ namespace NanSu
 
     void DX11Shader::SetInputLayout(const BufferLayout& layout)
     {
+        m_Layout = layout;
         CreateInputLayout(layout);
     }
 
-    std::string DX11Shader::ReadFile(const std::string& filePath)
+    bool DX11Shader::Reload()
     {
-        std::ifstream file(filePath, std::ios::in | std::ios::binary);
+        if (m_FilePath.empty())
+        {
+            return false;
+        }
 
-        if (!file)
+        AssetData sourceData = AssetSystem::Load(m_FilePath);
+        if (!sourceData.IsValid())
+        {
+            NS_ENGINE_ERROR("Shader '{}' reload failed: cannot read {}", m_Name, m_FilePath);
+            return false;
+        }
+
+        std::string_view source = sourceData.AsString();
+
+        ID3D11VertexShader* vertexShader = nullptr;
+        ID3D11PixelShader* pixelShader = nullptr;
+        std::vector<byte> vsBytecode;
+        std::vector<ShaderUniformBuffer> uniformBuffers;
+        if (!CreateShaders(source, source, vertexShader, pixelShader, vsBytecode, uniformBuffers))
+        {
+            NS_ENGINE_ERROR("Shader '{}' reload failed, keeping the previous version", m_Name);
+            return false;
+        }
+
+        // The input layout is validated against the VS signature, so rebuild it
+        // from the new bytecode before anything is swapped
+        ID3D11InputLayout* inputLayout = nullptr;
+        if (!m_Layout.GetElements().empty() && !BuildInputLayout(m_Layout, vsBytecode, inputLayout))
+        {
+            vertexShader->Release();
+            pixelShader->Release();
+            NS_ENGINE_ERROR("Shader '{}' reload failed: input signature no longer matches the vertex layout, "
+                            "keeping the previous version", m_Name);
+            return false;
+        }
+
+        // Swap in place so existing Shader pointers pick up the new version
+        m_VertexShader->Release();
+        m_PixelShader->Release();
+        m_VertexShader = vertexShader;
+        m_PixelShader = pixelShader;
+        m_VSBytecode = std::move(vsBytecode);
+        m_UniformBuffers = std::move(uniformBuffers);
+
+        if (inputLayout)
+        {
+            if (m_InputLayout)
+            {
+                m_InputLayout->Release();
+            }
+            m_InputLayout = inputLayout;
+        }
+
+        NS_ENGINE_INFO("Shader '{}' reloaded", m_Name);
+        return true;
+    }
+
+    AssetData DX11Shader::ReadFile(const std::string& filePath)
+    {
+        AssetData data = AssetSystem::Load(filePath);
+
+        if (!data.IsValid())
         {
             NS_ENGINE_ERROR("Failed to open shader file: {}", filePath);
             NS_ENGINE_ASSERT(false, "Shader file not found");
-            return "";
         }
 
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        return buffer.str();
+        return data;
     }
 
-    void* DX11Shader::CompileShader(const std::string& source,
-                                     const char* entryPoint,
-                                     const char* target)
+    bool DX11Shader::CreateShaders(std::string_view vertexSource,
+                                   std::string_view pixelSource,
+                                   ID3D11VertexShader*& outVertexShader,
+                                   ID3D11PixelShader*& outPixelShader,
+                                   std::vector<byte>& outVSBytecode,
+                                   std::vector<ShaderUniformBuffer>& outUniformBuffers)
     {
-        UINT compileFlags = 0;
-#ifdef NS_DEBUG
-        compileFlags |= D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
-#else
-        compileFlags |= D3DCOMPILE_OPTIMIZATION_LEVEL3;
-#endif
+        // Compile vertex shader (bytecode kept for input layout creation)
+        std::vector<byte> vsBytecode;
+        if (!CompileShader(vertexSource, "VSMain", "vs_5_0", vsBytecode))
+        {
+            NS_ENGINE_ERROR("Failed to compile vertex shader");
+            return false;
+        }
 
-        ID3DBlob* shaderBlob = nullptr;
+        // Compile pixel shader
+        std::vector<byte> psBytecode;
+        if (!CompileShader(pixelSource, "PSMain", "ps_5_0", psBytecode))
+        {
+            NS_ENGINE_ERROR("Failed to compile pixel shader");
+            return false;
+        }
+
+        // Reflect constant buffer layouts of both stages
+        std::vector<ShaderUniformBuffer> uniformBuffers;
+        if (!ReflectUniformBuffers(vsBytecode, uniformBuffers) ||
+            !ReflectUniformBuffers(psBytecode, uniformBuffers))
+        {
+            NS_ENGINE_ERROR("Failed to reflect shader constant buffers");
+            return false;
+        }
+
+        // Create shaders
+        auto* device = static_cast<ID3D11Device*>(
+            Application::Get().GetGraphicsContext().GetNativeDevice());
+
+        ID3D11VertexShader* vertexShader = nullptr;
+        HRESULT hr = device->CreateVertexShader(
+            vsBytecode.data(),
+            vsBytecode.size(),
+            nullptr,
+            &vertexShader
+        );
+        if (FAILED(hr))
+        {
+            NS_ENGINE_ERROR("Failed to create vertex shader");
+            return false;
+        }
+
+        ID3D11PixelShader* pixelShader = nullptr;
+        hr = device->CreatePixelShader(
+            psBytecode.data(),
+            psBytecode.size(),
+            nullptr,
+            &pixelShader
+        );
+        if (FAILED(hr))
+        {
+            NS_ENGINE_ERROR("Failed to create pixel shader");
+            vertexShader->Release();
+            return false;
+        }
+
+        outVertexShader = vertexShader;
+        outPixelShader = pixelShader;
+        outVSBytecode = std::move(vsBytecode);
+        outUniformBuffers = std::move(uniformBuffers);
+        return true;
+    }
+
+    bool DX11Shader::ReflectUniformBuffers(const std::vector<byte>& bytecode,
+                                           std::vector<ShaderUniformBuffer>& uniformBuffers)
+    {
+        ID3D11ShaderReflection* reflection = nullptr;
+        HRESULT hr = D3DReflect(bytecode.data(), bytecode.size(),
+                                __uuidof(ID3D11ShaderReflection),
+                                reinterpret_cast<void**>(&reflection));
+        if (FAILED(hr))
+        {
+            return false;
+        }
+
+        D3D11_SHADER_DESC shaderDesc = {};
+        reflection->GetDesc(&shaderDesc);
+
+        for (UINT i = 0; i < shaderDesc.ConstantBuffers; ++i)
+        {
+            ID3D11ShaderReflectionConstantBuffer* constantBuffer = reflection->GetConstantBufferByIndex(i);
+
+            D3D11_SHADER_BUFFER_DESC bufferDesc = {};
+            constantBuffer->GetDesc(&bufferDesc);
+            if (bufferDesc.Type != D3D_CT_CBUFFER)
+            {
+                continue;  // tbuffers and structured buffers are not constant buffers
+            }
+
+            D3D11_SHADER_INPUT_BIND_DESC bindDesc = {};
+            if (FAILED(reflection->GetResourceBindingDescByName(bufferDesc.Name, &bindDesc)))
+            {
+                continue;
+            }
+
+            ShaderUniformBuffer buffer;
+            buffer.Name = bufferDesc.Name;
+            buffer.Slot = bindDesc.BindPoint;
+            buffer.Size = bufferDesc.Size;
+
+            for (UINT v = 0; v < bufferDesc.Variables; ++v)
+            {
+                ID3D11ShaderReflectionVariable* variable = constantBuffer->GetVariableByIndex(v);
+
+                D3D11_SHADER_VARIABLE_DESC variableDesc = {};
+                D3D11_SHADER_TYPE_DESC typeDesc = {};
+                variable->GetDesc(&variableDesc);
+                variable->GetType()->GetDesc(&typeDesc);
+
+                ShaderUniform uniform;
+                uniform.Name = variableDesc.Name;
+                uniform.Type = ReflectedTypeToShaderDataType(typeDesc);
+                uniform.Offset = variableDesc.StartOffset;
+                uniform.Size = variableDesc.Size;
+                buffer.Uniforms.push_back(std::move(uniform));
+            }
+
+            // The same cbuffer is usually visible to both stages; keep one entry per slot
+            auto existing = std::find_if(uniformBuffers.begin(), uniformBuffers.end(),
+                [&](const ShaderUniformBuffer& other) { return other.Slot == buffer.Slot; });
+
+            if (existing == uniformBuffers.end())
+            {
+                uniformBuffers.push_back(std::move(buffer));
+            }
+            else if (!existing->IsLayoutCompatible(buffer))
+            {
+                NS_ENGINE_WARN("Shader '{}': stages disagree on the layout of cbuffer slot b{} ('{}' vs '{}')",
+                               m_Name, buffer.Slot, existing->Name, buffer.Name);
+            }
+        }
+
+        reflection->Release();
+
+        std::sort(uniformBuffers.begin(), uniformBuffers.end(),
+            [](const ShaderUniformBuffer& a, const ShaderUniformBuffer& b) { return a.Slot < b.Slot; });
+        return true;
+    }
+
+    bool DX11Shader::PreprocessShader(std::string_view source, std::string& outPreprocessed)
+    {
+        ID3DBlob* textBlob = nullptr;
         ID3DBlob* errorBlob = nullptr;
 
-        HRESULT hr = D3DCompile(
-            source.c_str(),
+        HRESULT hr = D3DPreprocess(
+            source.data(),
             source.size(),
             m_FilePath.empty() ? nullptr : m_FilePath.c_str(),
             nullptr,    // Defines
             nullptr,    // Include handler
-            entryPoint,
-            target,
-            compileFlags,
-            0,          // Effect compilation flags
-            &shaderBlob,
+            &textBlob,
             &errorBlob
         );
 
@@ -266,37 +453,129 @@ namespace NanSu
         {
             if (errorBlob)
             {
-                NS_ENGINE_ERROR("Shader compilation failed for '{}' entry point '{}':",
-                                m_Name, entryPoint);
+                NS_ENGINE_ERROR("Shader preprocessing failed for '{}':", m_Name);
                 NS_ENGINE_ERROR("{}", static_cast<const char*>(errorBlob->GetBufferPointer()));
                 errorBlob->Release();
             }
-            return nullptr;
+            return false;
         }
 
         if (errorBlob)
         {
-            // Warnings
-            NS_ENGINE_WARN("Shader compilation warnings for '{}' entry point '{}':",
-                           m_Name, entryPoint);
-            NS_ENGINE_WARN("{}", static_cast<const char*>(errorBlob->GetBufferPointer()));
             errorBlob->Release();
         }
 
-        return shaderBlob;
+        // The preprocessed text is null-terminated
+        outPreprocessed.assign(static_cast<const char*>(textBlob->GetBufferPointer()));
+        textBlob->Release();
+        return true;
+    }
+
+    bool DX11Shader::CompileShader(std::string_view source,
+                                   const char* entryPoint,
+                                   const char* target,
+                                   std::vector<byte>& outBytecode)
+    {
+        // Hash the preprocessed text so edits to included files invalidate the cache
+        std::string preprocessed;
+        if (!PreprocessShader(source, preprocessed))
+        {
+            return false;
+        }
+
+        UINT compileFlags = 0;
+#ifdef NS_DEBUG
+        compileFlags |= D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
+#else
+        compileFlags |= D3DCOMPILE_OPTIMIZATION_LEVEL3;
+#endif
+
+        ShaderCompileRequest request;
+        request.Source = preprocessed;
+        request.SourceName = m_FilePath.empty() ? std::string_view(m_Name) : std::string_view(m_FilePath);
+        request.EntryPoint = entryPoint;
+        request.Target = target;
+        request.Flags = compileFlags;
+        request.CompilerId = "d3dcompiler_" NS_STRINGIFY_MACRO(D3D_COMPILER_VERSION);
+
+        auto compiler = [this](const ShaderCompileRequest& req, std::vector<byte>& bytecode)
+        {
+            std::string entry(req.EntryPoint);
+            std::string profile(req.Target);
+
+            ID3DBlob* shaderBlob = nullptr;
+            ID3DBlob* errorBlob = nullptr;
+
+            HRESULT hr = D3DCompile(
+                req.Source.data(),
+                req.Source.size(),
+                m_FilePath.empty() ? nullptr : m_FilePath.c_str(),
+                nullptr,    // Defines (already applied by the preprocessor)
+                nullptr,    // Include handler
+                entry.c_str(),
+                profile.c_str(),
+                req.Flags,
+                0,          // Effect compilation flags
+                &shaderBlob,
+                &errorBlob
+            );
+
+            if (FAILED(hr))
+            {
+                if (errorBlob)
+                {
+                    NS_ENGINE_ERROR("Shader compilation failed for '{}' entry point '{}':",
+                                    m_Name, entry);
+                    NS_ENGINE_ERROR("{}", static_cast<const char*>(errorBlob->GetBufferPointer()));
+                    errorBlob->Release();
+                }
+                return false;
+            }
+
+            if (errorBlob)
+            {
+                // Warnings
+                NS_ENGINE_WARN("Shader compilation warnings for '{}' entry point '{}':",
+                               m_Name, entry);
+                NS_ENGINE_WARN("{}", static_cast<const char*>(errorBlob->GetBufferPointer()));
+                errorBlob->Release();
+            }
+
+            const auto* code = static_cast<const byte*>(shaderBlob->GetBufferPointer());
+            bytecode.assign(code, code + shaderBlob->GetBufferSize());
+            shaderBlob->Release();
+            return true;
+        };
+
+        if (!ShaderCache::Compile(request, compiler, outBytecode))
+        {
+            outBytecode.clear();
+            return false;
+        }
+
+        return true;
     }
 
     void DX11Shader::CreateInputLayout(const BufferLayout& layout)
     {
-        auto* device = static_cast<ID3D11Device*>(
-            Application::Get().GetGraphicsContext().GetNativeDevice());
+        ID3D11InputLayout* inputLayout = nullptr;
+        [[maybe_unused]] bool created = BuildInputLayout(layout, m_VSBytecode, inputLayout);
+        NS_ENGINE_ASSERT(created, "Failed to create input layout");
 
         // Release existing input layout if any
         if (m_InputLayout)
         {
             m_InputLayout->Release();
-            m_InputLayout = nullptr;
         }
+        m_InputLayout = inputLayout;
+    }
+
+    bool DX11Shader::BuildInputLayout(const BufferLayout& layout,
+                                      const std::vector<byte>& vsBytecode,
+                                      ID3D11InputLayout*& outInputLayout)
+    {
+        auto* device = static_cast<ID3D11Device*>(
+            Application::Get().GetGraphicsContext().GetNativeDevice());
 
         const auto& elements = layout.GetElements();
 
@@ -360,20 +639,28 @@ namespace NanSu
             }
         }
 
-        NS_ENGINE_ASSERT(m_VSBlob, "Vertex shader bytecode not available for input layout creation");
+        NS_ENGINE_ASSERT(!vsBytecode.empty(), "Vertex shader bytecode not available for input layout creation");
 
-        auto* vsBlob = static_cast<ID3DBlob*>(m_VSBlob);
+        ID3D11InputLayout* inputLayout = nullptr;
         HRESULT hr = device->CreateInputLayout(
             inputElements.data(),
             static_cast<UINT>(inputElements.size()),
-            vsBlob->GetBufferPointer(),
-            vsBlob->GetBufferSize(),
-            &m_InputLayout
+            vsBytecode.data(),
+            vsBytecode.size(),
+            &inputLayout
         );
 
-        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create input layout");
+        if (FAILED(hr))
+        {
+            NS_ENGINE_ERROR("Failed to create input layout for shader '{}' (HRESULT 0x{:08X})",
+                            m_Name, static_cast<uint32>(hr));
+            return false;
+        }
+
+        outInputLayout = inputLayout;
         NS_ENGINE_INFO("Input layout created with {} elements for shader '{}'",
                        inputElements.size(), m_Name);
+        return true;
     }
 
 } // namespace NanSu
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "Renderer/Shader.h"
+#include "Asset/AssetSystem.h"
+
+#include <string_view>
+#include <vector>
 
 #ifdef NS_PLATFORM_WINDOWS
 
@@ -39,25 +43,63 @@ namespace NanSu
         void Unbind() const override;
         void SetInputLayout(const BufferLayout& layout) override;
         const std::string& GetName() const override { return m_Name; }
+        bool Reload() override;
+        const std::vector<ShaderUniformBuffer>& GetUniformBuffers() const override { return m_UniformBuffers; }
 
     private:
         /**
-         * @brief Read shader file from disk
+         * @brief Read shader file through the asset system (pack or disk)
          * @param filePath Path to the shader file
-         * @return File contents as string
+         * @return File contents (zero-copy when served from the asset pack)
          */
-        std::string ReadFile(const std::string& filePath);
+        AssetData ReadFile(const std::string& filePath);
 
         /**
-         * @brief Compile HLSL source to bytecode
+         * @brief Compile both stages and create the D3D shader objects
+         * @param vertexSource HLSL source containing VSMain
+         * @param pixelSource HLSL source containing PSMain
+         * @param outVertexShader Receives the vertex shader (untouched on failure)
+         * @param outPixelShader Receives the pixel shader (untouched on failure)
+         * @param outVSBytecode Receives the vertex shader bytecode
+         * @param outUniformBuffers Receives the reflected constant buffers of both stages
+         * @return true if both stages were created
+         */
+        bool CreateShaders(std::string_view vertexSource,
+                           std::string_view pixelSource,
+                           ID3D11VertexShader*& outVertexShader,
+                           ID3D11PixelShader*& outPixelShader,
+                           std::vector<byte>& outVSBytecode,
+                           std::vector<ShaderUniformBuffer>& outUniformBuffers);
+
+        /**
+         * @brief Add the constant buffers of one stage to a merged list
+         * @param bytecode Compiled bytecode of the stage
+         * @param uniformBuffers Buffers of the stages reflected so far (merged by slot)
+         * @return false if the bytecode could not be reflected
+         */
+        bool ReflectUniformBuffers(const std::vector<byte>& bytecode,
+                                   std::vector<ShaderUniformBuffer>& uniformBuffers);
+
+        /**
+         * @brief Run the HLSL preprocessor (macros, #include) on the source
+         * @param source HLSL source code
+         * @param outPreprocessed Receives the expanded source
+         * @return true on success
+         */
+        bool PreprocessShader(std::string_view source, std::string& outPreprocessed);
+
+        /**
+         * @brief Compile HLSL source to bytecode through the shader cache
          * @param source HLSL source code
          * @param entryPoint Entry point function name (e.g., "VSMain")
          * @param target Shader model target (e.g., "vs_5_0")
-         * @return Compiled shader blob (ID3DBlob*)
+         * @param outBytecode Receives the compiled bytecode (empty on failure)
+         * @return true on success (cache hit or successful compile)
          */
-        void* CompileShader(const std::string& source,
-                            const char* entryPoint,
-                            const char* target);
+        bool CompileShader(std::string_view source,
+                           const char* entryPoint,
+                           const char* target,
+                           std::vector<byte>& outBytecode);
 
         /**
          * @brief Create input layout from BufferLayout and VS bytecode
@@ -65,6 +107,17 @@ namespace NanSu
          */
         void CreateInputLayout(const BufferLayout& layout);
 
+        /**
+         * @brief Build an input layout against the given VS bytecode
+         * @param layout Vertex buffer layout
+         * @param vsBytecode Vertex shader bytecode the layout is validated against
+         * @param outInputLayout Receives the input layout (untouched on failure)
+         * @return false if the layout does not match the VS input signature
+         */
+        bool BuildInputLayout(const BufferLayout& layout,
+                              const std::vector<byte>& vsBytecode,
+                              ID3D11InputLayout*& outInputLayout);
+
     private:
         std::string m_Name;
         std::string m_FilePath;
@@ -73,8 +126,15 @@ namespace NanSu
         ID3D11PixelShader* m_PixelShader = nullptr;
         ID3D11InputLayout* m_InputLayout = nullptr;
 
-        // Keep VS bytecode for creating input layouts (ID3DBlob*)
-        void* m_VSBlob = nullptr;
+        // Keep VS bytecode and layout for (re)creating input layouts
+        std::vector<byte> m_VSBytecode;
+        BufferLayout m_Layout;
+
+        // Reflected constant buffer layouts (VS and PS merged)
+        std::vector<ShaderUniformBuffer> m_UniformBuffers;
+
+        // Hot reload registration (0 if not watched)
+        uint32 m_WatchHandle = 0;
     };
 
 } // namespace NanSu
@@ -4,12 +4,53 @@
 #ifdef NS_PLATFORM_WINDOWS
 
 #include "Core/Application.h"
+#include "Asset/AssetSystem.h"
+#include "Asset/AssetWatcher.h"
 
 #include <d3d11.h>
 #include <stb_image.h>
 
+#include <filesystem>
+
 namespace NanSu
 {
+    namespace
+    {
+        DXGI_FORMAT ToDXGIFormat(CookedTextureFormat format)
+        {
+            switch (format)
+            {
+                case CookedTextureFormat::RGBA8:    return DXGI_FORMAT_R8G8B8A8_UNORM;
+                case CookedTextureFormat::BC1:      return DXGI_FORMAT_BC1_UNORM;
+                case CookedTextureFormat::BC3:      return DXGI_FORMAT_BC3_UNORM;
+                case CookedTextureFormat::BC7:      return DXGI_FORMAT_BC7_UNORM;
+            }
+
+            NS_ENGINE_ASSERT(false, "Unknown cooked texture format");
+            return DXGI_FORMAT_UNKNOWN;
+        }
+
+        std::string GetCookedPath(const std::string& filePath)
+        {
+            std::filesystem::path cookedPath = filePath;
+            cookedPath.replace_extension(COOKED_TEXTURE_EXTENSION);
+            return cookedPath.string();
+        }
+
+        /**
+         * @brief Check whether a loose source image was edited after it was cooked
+         */
+        bool IsSourceNewer(const std::string& sourcePath, const std::string& cookedPath)
+        {
+            std::error_code sourceError, cookedError;
+            auto sourceTime = std::filesystem::last_write_time(sourcePath, sourceError);
+            auto cookedTime = std::filesystem::last_write_time(cookedPath, cookedError);
+
+            // Without both loose files (e.g. pack-only assets) the cooked version is authoritative
+            return !sourceError && !cookedError && sourceTime > cookedTime;
+        }
+    }
+
     // =========================================================================
     // Factory Methods
     // =========================================================================
@@ -31,35 +72,24 @@ namespace NanSu
     DX11Texture2D::DX11Texture2D(const std::string& filePath)
         : m_FilePath(filePath)
     {
-        // Flip vertically for DirectX coordinate system (top-left origin)
-        stbi_set_flip_vertically_on_load(true);
+        LoadFromFile(filePath);
 
-        int width, height, channels;
-        stbi_uc* data = stbi_load(
-            filePath.c_str(),
-            &width,
-            &height,
-            &channels,
-            STBI_rgb_alpha  // Force 4 channels (RGBA)
-        );
+        // Re-cooking the texture reloads it as well as editing the source image.
+        // Both files are read from disk from then on, so a cooked copy in the
+        // asset pack cannot shadow an edited source image.
+        std::string cookedPath = GetCookedPath(filePath);
+        auto reload = [this, cookedPath](const std::string&)
+        {
+            AssetSystem::PreferDiskVersion(m_FilePath);
+            AssetSystem::PreferDiskVersion(cookedPath);
+            Reload();
+        };
+        m_WatchHandles[0] = AssetWatcher::Watch(filePath, reload);
 
-        if (!data)
+        if (cookedPath != filePath)
         {
-            NS_ENGINE_ERROR("Failed to load texture: {}", filePath);
-            NS_ENGINE_ERROR("stbi_failure_reason: {}", stbi_failure_reason());
-            return;
+            m_WatchHandles[1] = AssetWatcher::Watch(cookedPath, reload);
         }
-
-        m_Width = static_cast<uint32>(width);
-        m_Height = static_cast<uint32>(height);
-
-        CreateTexture(data);
-        CreateSampler();
-
-        stbi_image_free(data);
-
-        NS_ENGINE_INFO("Texture loaded: {} ({}x{}, {} channels)",
-                       filePath, m_Width, m_Height, channels);
     }
 
     DX11Texture2D::DX11Texture2D(uint32 width, uint32 height)
@@ -67,17 +97,15 @@ namespace NanSu
         , m_Height(height)
     {
         CreateTexture(nullptr);
-        CreateSampler();
 
         NS_ENGINE_INFO("Empty texture created ({}x{})", width, height);
     }
 
     DX11Texture2D::~DX11Texture2D()
     {
-        if (m_SamplerState)
+        for (uint32 handle : m_WatchHandles)
         {
-            m_SamplerState->Release();
-            m_SamplerState = nullptr;
+            AssetWatcher::Unwatch(handle);
         }
 
         if (m_ShaderResourceView)
@@ -99,7 +127,6 @@ namespace NanSu
             Application::Get().GetGraphicsContext().GetNativeDeviceContext());
 
         deviceContext->PSSetShaderResources(slot, 1, &m_ShaderResourceView);
-        deviceContext->PSSetSamplers(slot, 1, &m_SamplerState);
     }
 
     void DX11Texture2D::Unbind(uint32 slot) const
@@ -108,13 +135,13 @@ namespace NanSu
             Application::Get().GetGraphicsContext().GetNativeDeviceContext());
 
         ID3D11ShaderResourceView* nullSRV = nullptr;
-        ID3D11SamplerState* nullSampler = nullptr;
         deviceContext->PSSetShaderResources(slot, 1, &nullSRV);
-        deviceContext->PSSetSamplers(slot, 1, &nullSampler);
     }
 
     void DX11Texture2D::SetData(const void* data, uint32 size)
     {
+        NS_ENGINE_ASSERT(!IsBlockCompressed(m_Format), "SetData is not supported on block-compressed textures");
+
         uint32 expectedSize = m_Width * m_Height * 4;  // RGBA = 4 bytes per pixel
         NS_ENGINE_ASSERT(size == expectedSize,
             "Data size ({}) does not match texture size ({})", size, expectedSize);
@@ -135,7 +162,144 @@ namespace NanSu
         deviceContext->UpdateSubresource(m_Texture, 0, &destBox, data, rowPitch, 0);
     }
 
-    void DX11Texture2D::CreateTexture(const void* data)
+    bool DX11Texture2D::Reload()
+    {
+        if (m_FilePath.empty())
+        {
+            return false;
+        }
+
+        // Keep the current resources until the new version is created
+        ID3D11Texture2D* oldTexture = m_Texture;
+        ID3D11ShaderResourceView* oldView = m_ShaderResourceView;
+        uint32 oldWidth = m_Width;
+        uint32 oldHeight = m_Height;
+        uint32 oldMipCount = m_MipCount;
+        CookedTextureFormat oldFormat = m_Format;
+
+        m_Texture = nullptr;
+        m_ShaderResourceView = nullptr;
+        m_MipCount = 1;
+        m_Format = CookedTextureFormat::RGBA8;
+
+        if (!LoadFromFile(m_FilePath))
+        {
+            m_Texture = oldTexture;
+            m_ShaderResourceView = oldView;
+            m_Width = oldWidth;
+            m_Height = oldHeight;
+            m_MipCount = oldMipCount;
+            m_Format = oldFormat;
+
+            NS_ENGINE_ERROR("Texture reload failed, keeping the previous version: {}", m_FilePath);
+            return false;
+        }
+
+        if (oldView)
+        {
+            oldView->Release();
+        }
+        if (oldTexture)
+        {
+            oldTexture->Release();
+        }
+
+        return true;
+    }
+
+    bool DX11Texture2D::LoadFromFile(const std::string& filePath)
+    {
+        // Prefer the cooked texture when the TextureCooker output is available
+        // and not older than the source image
+        std::string cookedPath = GetCookedPath(filePath);
+        if (AssetSystem::Exists(cookedPath))
+        {
+            if (cookedPath != filePath && IsSourceNewer(filePath, cookedPath))
+            {
+                NS_ENGINE_WARN("Cooked texture is older than its source, loading the source image: {}", filePath);
+            }
+            else if (LoadCookedFile(cookedPath))
+            {
+                return true;
+            }
+        }
+
+        return LoadImageFile(filePath);
+    }
+
+    bool DX11Texture2D::LoadImageFile(const std::string& filePath)
+    {
+        // Flip vertically for DirectX coordinate system (top-left origin)
+        stbi_set_flip_vertically_on_load(true);
+
+        AssetData fileData = AssetSystem::Load(filePath);
+        if (!fileData.IsValid())
+        {
+            NS_ENGINE_ERROR("Failed to load texture: {}", filePath);
+            return false;
+        }
+
+        int width, height, channels;
+        stbi_uc* data = stbi_load_from_memory(
+            fileData.GetData(),
+            static_cast<int>(fileData.GetSize()),
+            &width,
+            &height,
+            &channels,
+            STBI_rgb_alpha  // Force 4 channels (RGBA)
+        );
+
+        if (!data)
+        {
+            NS_ENGINE_ERROR("Failed to load texture: {}", filePath);
+            NS_ENGINE_ERROR("stbi_failure_reason: {}", stbi_failure_reason());
+            return false;
+        }
+
+        m_Width = static_cast<uint32>(width);
+        m_Height = static_cast<uint32>(height);
+
+        CreateTexture(data);
+
+        stbi_image_free(data);
+
+        NS_ENGINE_INFO("Texture loaded: {} ({}x{}, {} channels)",
+                       filePath, m_Width, m_Height, channels);
+        return true;
+    }
+
+    bool DX11Texture2D::LoadCookedFile(const std::string& filePath)
+    {
+        // Single read (or zero-copy pack view); payloads are uploaded straight from this buffer
+        AssetData contents = AssetSystem::Load(filePath);
+        if (!contents.IsValid())
+        {
+            NS_ENGINE_ERROR("Failed to read cooked texture: {}", filePath);
+            return false;
+        }
+
+        if (!ValidateCookedTexture(contents.GetData(), contents.GetSize()))
+        {
+            NS_ENGINE_ERROR("Invalid or outdated cooked texture: {}", filePath);
+            return false;
+        }
+
+        const auto* header = reinterpret_cast<const CookedTextureHeader*>(contents.GetData());
+        const auto* mips = reinterpret_cast<const CookedMipEntry*>(contents.GetData() + sizeof(CookedTextureHeader));
+
+        m_Width = header->Width;
+        m_Height = header->Height;
+        m_MipCount = header->MipCount;
+        m_Format = header->Format;
+
+        CreateTexture(contents.GetData(), mips);
+
+        NS_ENGINE_INFO("Cooked texture loaded: {} ({}x{}, {} mips, {:.1f} KB)",
+                       filePath, m_Width, m_Height, m_MipCount, contents.GetSize() / 1024.0);
+        return true;
+    }
+
+    void DX11Texture2D::CreateTexture(const void* data, const CookedMipEntry* mips)
     {
         auto* device = static_cast<ID3D11Device*>(
             Application::Get().GetGraphicsContext().GetNativeDevice());
@@ -144,9 +308,9 @@ namespace NanSu
         D3D11_TEXTURE2D_DESC textureDesc = {};
         textureDesc.Width = m_Width;
         textureDesc.Height = m_Height;
-        textureDesc.MipLevels = 1;
+        textureDesc.MipLevels = m_MipCount;
         textureDesc.ArraySize = 1;
-        textureDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+        textureDesc.Format = ToDXGIFormat(m_Format);
         textureDesc.SampleDesc.Count = 1;
         textureDesc.SampleDesc.Quality = 0;
         textureDesc.Usage = D3D11_USAGE_DEFAULT;
@@ -156,7 +320,20 @@ namespace NanSu
 
         HRESULT hr;
 
-        if (data)
+        if (data && mips)
+        {
+            // Cooked texture: one subresource per mip, pointing into the file buffer
+            std::vector<D3D11_SUBRESOURCE_DATA> initData(m_MipCount);
+            for (uint32 i = 0; i < m_MipCount; ++i)
+            {
+                initData[i].pSysMem = static_cast<const byte*>(data) + mips[i].Offset;
+                initData[i].SysMemPitch = mips[i].RowPitch;
+                initData[i].SysMemSlicePitch = 0;
+            }
+
+            hr = device->CreateTexture2D(&textureDesc, initData.data(), &m_Texture);
+        }
+        else if (data)
         {
             // Initialize with data
             D3D11_SUBRESOURCE_DATA initData = {};
@@ -178,36 +355,12 @@ namespace NanSu
         srvDesc.Format = textureDesc.Format;
         srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
         srvDesc.Texture2D.MostDetailedMip = 0;
-        srvDesc.Texture2D.MipLevels = 1;
+        srvDesc.Texture2D.MipLevels = m_MipCount;
 
         hr = device->CreateShaderResourceView(m_Texture, &srvDesc, &m_ShaderResourceView);
         NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create shader resource view");
     }
 
-    void DX11Texture2D::CreateSampler()
-    {
-        auto* device = static_cast<ID3D11Device*>(
-            Application::Get().GetGraphicsContext().GetNativeDevice());
-
-        D3D11_SAMPLER_DESC samplerDesc = {};
-        samplerDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;  // Trilinear filtering
-        samplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_WRAP;
-        samplerDesc.AddressV = D3D11_TEXTURE_ADDRESS_WRAP;
-        samplerDesc.AddressW = D3D11_TEXTURE_ADDRESS_WRAP;
-        samplerDesc.MipLODBias = 0.0f;
-        samplerDesc.MaxAnisotropy = 1;
-        samplerDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
-        samplerDesc.BorderColor[0] = 0.0f;
-        samplerDesc.BorderColor[1] = 0.0f;
-        samplerDesc.BorderColor[2] = 0.0f;
-        samplerDesc.BorderColor[3] = 0.0f;
-        samplerDesc.MinLOD = 0.0f;
-        samplerDesc.MaxLOD = D3D11_FLOAT32_MAX;
-
-        HRESULT hr = device->CreateSamplerState(&samplerDesc, &m_SamplerState);
-        NS_ENGINE_ASSERT(SUCCEEDED(hr), "Failed to create sampler state");
-    }
-
 } // namespace NanSu
 
 #endif // NS_PLATFORM_WINDOWS
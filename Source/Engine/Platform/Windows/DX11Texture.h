@@ -1,27 +1,32 @@
 #pragma once
 
 #include "Renderer/Texture.h"
+#include "Renderer/CookedTexture.h"
 
 #ifdef NS_PLATFORM_WINDOWS
 
 // Forward declarations to avoid including DX11 headers
 struct ID3D11Texture2D;
 struct ID3D11ShaderResourceView;
-struct ID3D11SamplerState;
 
 namespace NanSu
 {
     /**
      * @brief DirectX 11 implementation of Texture2D
      *
-     * Manages ID3D11Texture2D, ID3D11ShaderResourceView, and ID3D11SamplerState.
+     * Manages ID3D11Texture2D and ID3D11ShaderResourceView. Sampling state is
+     * part of the PipelineState and shared through the renderer's state cache.
+     *
+     * Cooked textures (.nstx) are uploaded as-is with their full mip chain and
+     * block-compressed format. When a source image is requested and a cooked
+     * file with the same name exists next to it, the cooked file is preferred.
      */
     class DX11Texture2D : public Texture2D
     {
     public:
         /**
          * @brief Create a texture from a file path
-         * @param filePath Path to the image file
+         * @param filePath Path to the image file (.png, ... or cooked .nstx)
          */
         DX11Texture2D(const std::string& filePath);
 
@@ -42,28 +47,48 @@ namespace NanSu
 
         // Texture2D interface
         void SetData(const void* data, uint32 size) override;
+        bool Reload() override;
 
     private:
         /**
-         * @brief Create the texture and shader resource view from raw data
-         * @param data RGBA pixel data (can be nullptr for empty texture)
+         * @brief Load from a file, preferring its cooked (.nstx) version
+         * @return true on success
+         */
+        bool LoadFromFile(const std::string& filePath);
+
+        /**
+         * @brief Load a source image through stb_image (single RGBA8 mip)
+         * @return true on success
          */
-        void CreateTexture(const void* data);
+        bool LoadImageFile(const std::string& filePath);
 
         /**
-         * @brief Create a sampler state with default settings
+         * @brief Load a cooked texture file with a single read, no decoding
+         * @return true on success
          */
-        void CreateSampler();
+        bool LoadCookedFile(const std::string& filePath);
+
+        /**
+         * @brief Create the texture and shader resource view from raw data
+         * @param data RGBA pixel data (can be nullptr for empty texture), or the
+         *             start of a cooked texture file when mips is given
+         * @param mips Cooked mip table; offsets are relative to data
+         */
+        void CreateTexture(const void* data, const CookedMipEntry* mips = nullptr);
 
     private:
         std::string m_FilePath;
         uint32 m_Width = 0;
         uint32 m_Height = 0;
+        uint32 m_MipCount = 1;
+        CookedTextureFormat m_Format = CookedTextureFormat::RGBA8;
 
         // DX11 resources
         ID3D11Texture2D* m_Texture = nullptr;
         ID3D11ShaderResourceView* m_ShaderResourceView = nullptr;
-        ID3D11SamplerState* m_SamplerState = nullptr;
+
+        // Hot reload registrations for the source and cooked files (0 if not watched)
+        uint32 m_WatchHandles[2] = { 0, 0 };
     };
 
 } // namespace NanSu
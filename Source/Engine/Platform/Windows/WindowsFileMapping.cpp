@@ -0,0 +1,79 @@
+#include "EnginePCH.h"
+#include "Core/MappedFile.h"
+
+#ifdef NS_PLATFORM_WINDOWS
+
+namespace NanSu
+{
+    bool MappedFile::Open(const std::string& filePath)
+    {
+        Close();
+
+        HANDLE file = CreateFileA(
+            filePath.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS,
+            nullptr
+        );
+
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize = {};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        m_Data = static_cast<const byte*>(view);
+        m_Size = static_cast<usize>(fileSize.QuadPart);
+        m_FileHandle = file;
+        m_MappingHandle = mapping;
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_Data)
+        {
+            UnmapViewOfFile(m_Data);
+            m_Data = nullptr;
+            m_Size = 0;
+        }
+
+        if (m_MappingHandle)
+        {
+            CloseHandle(static_cast<HANDLE>(m_MappingHandle));
+            m_MappingHandle = nullptr;
+        }
+
+        if (m_FileHandle)
+        {
+            CloseHandle(static_cast<HANDLE>(m_FileHandle));
+            m_FileHandle = nullptr;
+        }
+    }
+}
+
+#endif // NS_PLATFORM_WINDOWS
@@ -0,0 +1,158 @@
+#include "EnginePCH.h"
+#include "Asset/FileWatchBackend.h"
+
+#ifdef NS_PLATFORM_WINDOWS
+
+namespace NanSu
+{
+    namespace
+    {
+        constexpr DWORD NOTIFY_FILTER = FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME;
+        constexpr DWORD NOTIFY_BUFFER_SIZE = 16 * 1024;
+
+        /**
+         * @brief One overlapped ReadDirectoryChangesW request per watched root
+         */
+        struct WatchedDirectory
+        {
+            std::string Path;
+            HANDLE Handle = INVALID_HANDLE_VALUE;
+            OVERLAPPED Overlapped = {};
+            alignas(DWORD) byte Buffer[NOTIFY_BUFFER_SIZE];
+        };
+
+        class WindowsFileWatchBackend : public FileWatchBackend
+        {
+        public:
+            ~WindowsFileWatchBackend() override
+            {
+                for (auto& directory : m_Directories)
+                {
+                    CancelIoEx(directory->Handle, &directory->Overlapped);
+                    // Wait for the cancellation so the kernel no longer writes into Buffer
+                    DWORD transferred = 0;
+                    GetOverlappedResult(directory->Handle, &directory->Overlapped, &transferred, TRUE);
+                    CloseHandle(directory->Overlapped.hEvent);
+                    CloseHandle(directory->Handle);
+                }
+            }
+
+            bool Start(const std::vector<std::string>& directories) override
+            {
+                for (const std::string& path : directories)
+                {
+                    auto directory = std::make_unique<WatchedDirectory>();
+                    directory->Path = path;
+                    directory->Handle = CreateFileA(
+                        path.c_str(),
+                        FILE_LIST_DIRECTORY,
+                        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                        nullptr,
+                        OPEN_EXISTING,
+                        FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED,
+                        nullptr
+                    );
+
+                    if (directory->Handle == INVALID_HANDLE_VALUE)
+                    {
+                        continue;
+                    }
+
+                    directory->Overlapped.hEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+                    if (!directory->Overlapped.hEvent || !IssueRead(*directory))
+                    {
+                        if (directory->Overlapped.hEvent)
+                        {
+                            CloseHandle(directory->Overlapped.hEvent);
+                        }
+                        CloseHandle(directory->Handle);
+                        continue;
+                    }
+
+                    m_Events.push_back(directory->Overlapped.hEvent);
+                    m_Directories.push_back(std::move(directory));
+                }
+
+                return !m_Directories.empty();
+            }
+
+            void Poll(uint32 timeoutMs, std::vector<std::string>& outChangedFiles) override
+            {
+                DWORD result = WaitForMultipleObjects(
+                    static_cast<DWORD>(m_Events.size()), m_Events.data(), FALSE, timeoutMs);
+
+                if (result < WAIT_OBJECT_0 || result >= WAIT_OBJECT_0 + m_Events.size())
+                {
+                    return;
+                }
+
+                WatchedDirectory& directory = *m_Directories[result - WAIT_OBJECT_0];
+
+                DWORD transferred = 0;
+                if (GetOverlappedResult(directory.Handle, &directory.Overlapped, &transferred, FALSE) &&
+                    transferred > 0)
+                {
+                    const byte* ptr = directory.Buffer;
+                    for (;;)
+                    {
+                        const auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(ptr);
+                        if (info->Action == FILE_ACTION_MODIFIED ||
+                            info->Action == FILE_ACTION_ADDED ||
+                            info->Action == FILE_ACTION_RENAMED_NEW_NAME)
+                        {
+                            outChangedFiles.push_back(directory.Path + "/" + ToUtf8(info));
+                        }
+
+                        if (info->NextEntryOffset == 0)
+                        {
+                            break;
+                        }
+                        ptr += info->NextEntryOffset;
+                    }
+                }
+
+                ResetEvent(directory.Overlapped.hEvent);
+                IssueRead(directory);
+            }
+
+        private:
+            static bool IssueRead(WatchedDirectory& directory)
+            {
+                return ReadDirectoryChangesW(
+                    directory.Handle,
+                    directory.Buffer,
+                    NOTIFY_BUFFER_SIZE,
+                    TRUE,       // Watch subtree
+                    NOTIFY_FILTER,
+                    nullptr,
+                    &directory.Overlapped,
+                    nullptr
+                ) != FALSE;
+            }
+
+            static std::string ToUtf8(const FILE_NOTIFY_INFORMATION* info)
+            {
+                int wideLength = static_cast<int>(info->FileNameLength / sizeof(WCHAR));
+                int size = WideCharToMultiByte(CP_UTF8, 0, info->FileName, wideLength, nullptr, 0, nullptr, nullptr);
+
+                std::string result(static_cast<usize>(size), '\0');
+                WideCharToMultiByte(CP_UTF8, 0, info->FileName, wideLength, result.data(), size, nullptr, nullptr);
+
+                // Relative names use backslashes
+                std::replace(result.begin(), result.end(), '\\', '/');
+                return result;
+            }
+
+        private:
+            std::vector<std::unique_ptr<WatchedDirectory>> m_Directories;
+            std::vector<HANDLE> m_Events;
+        };
+    }
+
+    std::unique_ptr<FileWatchBackend> FileWatchBackend::Create()
+    {
+        return std::make_unique<WindowsFileWatchBackend>();
+    }
+}
+
+#endif // NS_PLATFORM_WINDOWS
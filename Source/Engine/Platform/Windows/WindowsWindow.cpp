@@ -6,6 +6,7 @@
 #include "Input/KeyCodes.h"
 #include "Input/MouseCodes.h"
 #include <windowsx.h>
+#include <cmath>
 
 // Forward declare ImGui Win32 handler
 extern LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
@@ -121,6 +122,19 @@ namespace NanSu
         }
     }
 
+    bool WindowsWindow::WaitEvents(float64 timeoutSeconds)
+    {
+        DWORD timeout = timeoutSeconds < 0.0
+            ? INFINITE
+            : static_cast<DWORD>(std::ceil(timeoutSeconds * 1000.0));
+
+        // MWMO_INPUTAVAILABLE also wakes for messages that were queued before the call
+        DWORD result = MsgWaitForMultipleObjectsEx(0, nullptr, timeout, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+
+        OnUpdate();
+        return result == WAIT_OBJECT_0;
+    }
+
     LRESULT CALLBACK WindowsWindow::WindowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
     {
         // Handle WM_NCCREATE to store the WindowsWindow pointer
@@ -19,6 +19,7 @@ namespace NanSu
         virtual ~WindowsWindow();
 
         void OnUpdate() override;
+        bool WaitEvents(float64 timeoutSeconds) override;
 
         uint32 GetWidth() const override { return m_Data.Width; }
         uint32 GetHeight() const override { return m_Data.Height; }
@@ -36,6 +36,23 @@ namespace NanSu
          */
         virtual void SetData(const void* data, uint32 size) = 0;
 
+        /**
+         * @brief Upload a byte range of the constant buffer
+         * @param data Pointer to the new contents of the range
+         * @param offset Byte offset of the range inside the buffer
+         * @param size Size of the range in bytes
+         *
+         * The rest of the buffer keeps its previous contents. Backends that
+         * support partial constant buffer updates only transfer the
+         * 16-byte registers covering the range.
+         */
+        virtual void SetSubData(const void* data, uint32 offset, uint32 size) = 0;
+
+        /**
+         * @brief Get the buffer size in bytes (aligned to 16)
+         */
+        virtual uint32 GetSize() const = 0;
+
         /**
          * @brief Bind this constant buffer to a shader slot
          * @param slot The constant buffer slot (0 = b0, 1 = b1, etc.)
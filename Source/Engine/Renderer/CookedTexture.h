@@ -0,0 +1,204 @@
+#pragma once
+
+#include "Core/Types.h"
+
+namespace NanSu
+{
+    // =========================================================================
+    // Cooked Texture Format (.nstx)
+    // =========================================================================
+    //
+    // Binary texture container produced offline by the TextureCooker tool.
+    // The runtime uploads the payload directly to the GPU (no image decoding).
+    //
+    // File layout:
+    //   [CookedTextureHeader]
+    //   [CookedMipEntry x MipCount]
+    //   [Mip payloads, each aligned to COOKED_TEXTURE_PAYLOAD_ALIGNMENT]
+    //
+    // Mip 0 is the full-resolution image. Rows are stored flipped vertically,
+    // matching the orientation DX11Texture2D produces when loading PNG files.
+    // =========================================================================
+
+    constexpr uint32 COOKED_TEXTURE_MAGIC = 0x5854534E;    // "NSTX" (little-endian)
+    constexpr uint32 COOKED_TEXTURE_VERSION = 1;
+    constexpr uint32 COOKED_TEXTURE_PAYLOAD_ALIGNMENT = 16;
+    constexpr const char* COOKED_TEXTURE_EXTENSION = ".nstx";
+
+    /**
+     * @brief Pixel storage format of a cooked texture
+     */
+    enum class CookedTextureFormat : uint32
+    {
+        RGBA8 = 0,  // Uncompressed, 4 bytes per pixel
+        BC1,        // 4x4 blocks, 8 bytes per block (RGB + 1-bit alpha)
+        BC3,        // 4x4 blocks, 16 bytes per block (RGB + interpolated alpha)
+        BC7         // 4x4 blocks, 16 bytes per block (high quality RGBA)
+    };
+
+    /**
+     * @brief Header at the start of every cooked texture file
+     */
+    struct CookedTextureHeader
+    {
+        uint32 Magic = COOKED_TEXTURE_MAGIC;
+        uint32 Version = COOKED_TEXTURE_VERSION;
+        CookedTextureFormat Format = CookedTextureFormat::RGBA8;
+        uint32 Width = 0;
+        uint32 Height = 0;
+        uint32 MipCount = 0;
+        uint32 Reserved[2] = { 0, 0 };
+    };
+
+    /**
+     * @brief Describes a single mip level payload inside the file
+     */
+    struct CookedMipEntry
+    {
+        uint32 Width = 0;
+        uint32 Height = 0;
+        uint32 RowPitch = 0;    // Bytes per row (per row of blocks for BC formats)
+        uint32 Reserved = 0;
+        uint64 Offset = 0;      // Byte offset from the start of the file
+        uint64 Size = 0;        // Payload size in bytes
+    };
+
+    static_assert(sizeof(CookedTextureHeader) == 32, "CookedTextureHeader layout changed");
+    static_assert(sizeof(CookedMipEntry) == 32, "CookedMipEntry layout changed");
+
+    /**
+     * @brief Check whether a format stores 4x4 compressed blocks
+     */
+    inline bool IsBlockCompressed(CookedTextureFormat format)
+    {
+        return format != CookedTextureFormat::RGBA8;
+    }
+
+    /**
+     * @brief Bytes per 4x4 block for compressed formats, bytes per pixel for RGBA8
+     */
+    inline uint32 CookedTextureUnitSize(CookedTextureFormat format)
+    {
+        switch (format)
+        {
+            case CookedTextureFormat::RGBA8:    return 4;
+            case CookedTextureFormat::BC1:      return 8;
+            case CookedTextureFormat::BC3:      return 16;
+            case CookedTextureFormat::BC7:      return 16;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Compute the row pitch of a mip level in bytes
+     */
+    inline uint32 CookedTextureRowPitch(CookedTextureFormat format, uint32 width)
+    {
+        if (IsBlockCompressed(format))
+        {
+            return ((width + 3) / 4) * CookedTextureUnitSize(format);
+        }
+        return width * CookedTextureUnitSize(format);
+    }
+
+    /**
+     * @brief Compute the payload size of a mip level in bytes
+     */
+    inline uint64 CookedTextureMipSize(CookedTextureFormat format, uint32 width, uint32 height)
+    {
+        uint32 rows = IsBlockCompressed(format) ? (height + 3) / 4 : height;
+        return static_cast<uint64>(CookedTextureRowPitch(format, width)) * rows;
+    }
+
+    /**
+     * @brief Check whether a raw format value names a known CookedTextureFormat
+     */
+    inline bool IsValidCookedTextureFormat(CookedTextureFormat format)
+    {
+        return static_cast<uint32>(format) <= static_cast<uint32>(CookedTextureFormat::BC7);
+    }
+
+    /**
+     * @brief Validate header and mip table of an in-memory cooked texture
+     * @param data Pointer to the start of the file contents
+     * @param size Size of the file contents in bytes
+     * @return true if the format is known, the mip table describes a chain of
+     *         successive halvings with pitches and sizes matching the format,
+     *         and all mip payloads lie inside the buffer
+     */
+    inline bool ValidateCookedTexture(const byte* data, usize size)
+    {
+        if (data == nullptr || size < sizeof(CookedTextureHeader))
+        {
+            return false;
+        }
+
+        const auto* header = reinterpret_cast<const CookedTextureHeader*>(data);
+        if (header->Magic != COOKED_TEXTURE_MAGIC || header->Version != COOKED_TEXTURE_VERSION)
+        {
+            return false;
+        }
+
+        if (!IsValidCookedTextureFormat(header->Format))
+        {
+            return false;
+        }
+
+        if (header->MipCount == 0 || header->Width == 0 || header->Height == 0)
+        {
+            return false;
+        }
+
+        // Block-compressed mip 0 must consist of whole 4x4 blocks
+        if (IsBlockCompressed(header->Format) && (header->Width % 4 != 0 || header->Height % 4 != 0))
+        {
+            return false;
+        }
+
+        // No more levels than the full chain down to 1x1
+        uint32 maxMipCount = 1;
+        for (uint32 extent = header->Width > header->Height ? header->Width : header->Height; extent > 1; extent /= 2)
+        {
+            ++maxMipCount;
+        }
+        if (header->MipCount > maxMipCount)
+        {
+            return false;
+        }
+
+        usize tableEnd = sizeof(CookedTextureHeader) + sizeof(CookedMipEntry) * header->MipCount;
+        if (tableEnd > size)
+        {
+            return false;
+        }
+
+        const auto* mips = reinterpret_cast<const CookedMipEntry*>(data + sizeof(CookedTextureHeader));
+        uint32 expectedWidth = header->Width;
+        uint32 expectedHeight = header->Height;
+        for (uint32 i = 0; i < header->MipCount; ++i)
+        {
+            const CookedMipEntry& mip = mips[i];
+            if (mip.Width != expectedWidth || mip.Height != expectedHeight)
+            {
+                return false;
+            }
+            if (mip.RowPitch != CookedTextureRowPitch(header->Format, mip.Width))
+            {
+                return false;
+            }
+            if (mip.Size != CookedTextureMipSize(header->Format, mip.Width, mip.Height))
+            {
+                return false;
+            }
+            if (mip.Offset < tableEnd || mip.Offset > size || mip.Size > size - mip.Offset)
+            {
+                return false;
+            }
+
+            expectedWidth = expectedWidth > 1 ? expectedWidth / 2 : 1;
+            expectedHeight = expectedHeight > 1 ? expectedHeight / 2 : 1;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,271 @@
+#include "EnginePCH.h"
+#include "Renderer/Font.h"
+#include "Renderer/SubTexture2D.h"
+#include "Renderer/TextureAtlas.h"
+#include "Asset/AssetSystem.h"
+
+#include <stb_truetype.h>
+
+namespace NanSu
+{
+    namespace
+    {
+        constexpr uint32 FALLBACK_CODEPOINT = '?';
+        constexpr uint32 REPLACEMENT_CODEPOINT = 0xFFFD;
+        constexpr uint32 TAB_WIDTH_IN_SPACES = 4;
+
+        // SDF value on the glyph outline; the shader treats 0.5 as the edge
+        constexpr uint8 SDF_ON_EDGE_VALUE = 128;
+
+        /**
+         * @brief Decode one UTF-8 sequence and advance the cursor
+         * @return The codepoint, or U+FFFD for malformed input
+         */
+        uint32 DecodeUTF8(std::string_view text, usize& cursor)
+        {
+            uint8 lead = static_cast<uint8>(text[cursor++]);
+            if (lead < 0x80)
+            {
+                return lead;
+            }
+
+            uint32 length = (lead >= 0xF0) ? 4 : (lead >= 0xE0) ? 3 : (lead >= 0xC0) ? 2 : 0;
+            if (length == 0 || cursor + length - 1 > text.size())
+            {
+                return REPLACEMENT_CODEPOINT;
+            }
+
+            uint32 codepoint = lead & (0x7F >> length);
+            for (uint32 i = 1; i < length; ++i)
+            {
+                uint8 continuation = static_cast<uint8>(text[cursor]);
+                if ((continuation & 0xC0) != 0x80)
+                {
+                    return REPLACEMENT_CODEPOINT;
+                }
+
+                codepoint = (codepoint << 6) | (continuation & 0x3F);
+                ++cursor;
+            }
+
+            return codepoint;
+        }
+    }
+
+    Font::Font(const std::string& filePath, float32 bakeSize)
+        : m_FilePath(filePath)
+        , m_BakeSize(bakeSize)
+    {
+        AssetData fileData = AssetSystem::Load(filePath);
+        if (!fileData.IsValid())
+        {
+            NS_ENGINE_ERROR("Failed to load font: {}", filePath);
+            return;
+        }
+
+        // stb_truetype reads outlines lazily, so the font file has to stay in memory
+        m_FontData.assign(fileData.GetData(), fileData.GetData() + fileData.GetSize());
+
+        auto info = std::make_unique<stbtt_fontinfo>();
+        int offset = stbtt_GetFontOffsetForIndex(m_FontData.data(), 0);
+        if (offset < 0 || !stbtt_InitFont(info.get(), m_FontData.data(), offset))
+        {
+            NS_ENGINE_ERROR("Invalid TrueType font: {}", filePath);
+            m_FontData.clear();
+            return;
+        }
+
+        m_Info = std::move(info);
+        m_Scale = stbtt_ScaleForPixelHeight(m_Info.get(), m_BakeSize);
+
+        int ascent, descent, lineGap;
+        stbtt_GetFontVMetrics(m_Info.get(), &ascent, &descent, &lineGap);
+        m_Ascent = ascent * m_Scale / m_BakeSize;
+        m_Descent = descent * m_Scale / m_BakeSize;
+        m_LineHeight = (ascent - descent + lineGap) * m_Scale / m_BakeSize;
+
+        m_Atlas = std::make_unique<TextureAtlas>(ATLAS_PAGE_SIZE, 1);
+
+        // Printable ASCII up front; everything else is baked on first use
+        for (uint32 codepoint = 32; codepoint < 127; ++codepoint)
+        {
+            GetGlyph(codepoint);
+        }
+        UploadAtlas();
+
+        NS_ENGINE_INFO("Font loaded: {} ({} glyphs, {} atlas page(s))",
+                       filePath, m_Glyphs.size(), m_Atlas->GetPageCount());
+    }
+
+    Font::~Font() = default;
+
+    // =========================================================================
+    // Glyphs
+    // =========================================================================
+
+    const Glyph& Font::GetGlyph(uint32 codepoint)
+    {
+        auto it = m_Glyphs.find(codepoint);
+        if (it != m_Glyphs.end())
+        {
+            return it->second;
+        }
+
+        if (!IsLoaded())
+        {
+            static const Glyph s_EmptyGlyph;
+            return s_EmptyGlyph;
+        }
+
+        // Codepoints missing from the font share the fallback glyph
+        if (codepoint != FALLBACK_CODEPOINT && stbtt_FindGlyphIndex(m_Info.get(), static_cast<int>(codepoint)) == 0)
+        {
+            Glyph fallback = GetGlyph(FALLBACK_CODEPOINT);
+            return m_Glyphs.emplace(codepoint, fallback).first->second;
+        }
+
+        return m_Glyphs.emplace(codepoint, BakeGlyph(codepoint)).first->second;
+    }
+
+    float32 Font::GetKerning(uint32 left, uint32 right) const
+    {
+        if (!IsLoaded())
+        {
+            return 0.0f;
+        }
+
+        int kerning = stbtt_GetCodepointKernAdvance(m_Info.get(), static_cast<int>(left), static_cast<int>(right));
+        return kerning * m_Scale / m_BakeSize;
+    }
+
+    Glyph Font::BakeGlyph(uint32 codepoint)
+    {
+        Glyph glyph;
+
+        int advance, leftSideBearing;
+        stbtt_GetCodepointHMetrics(m_Info.get(), static_cast<int>(codepoint), &advance, &leftSideBearing);
+        glyph.Advance = advance * m_Scale / m_BakeSize;
+
+        // Distance spread around the outline, in atlas pixels
+        int padding = std::max(2, static_cast<int>(m_BakeSize / 8.0f));
+        float32 pixelDistanceScale = static_cast<float32>(SDF_ON_EDGE_VALUE) / static_cast<float32>(padding);
+
+        int width, height, offsetX, offsetY;
+        byte* sdf = stbtt_GetCodepointSDF(m_Info.get(), m_Scale, static_cast<int>(codepoint), padding,
+                                          SDF_ON_EDGE_VALUE, pixelDistanceScale,
+                                          &width, &height, &offsetX, &offsetY);
+        if (!sdf)
+        {
+            return glyph;  // No outline (e.g. space)
+        }
+
+        // Distance goes to alpha so the atlas can be sampled like any RGBA texture.
+        // stb_truetype writes rows top-down; the atlas stores rows bottom row
+        // first (Texture2D::SetData order, as AddFromFile loads images), so
+        // glyph regions are sampled exactly like every other atlas region.
+        std::vector<uint32> pixels(static_cast<usize>(width) * height);
+        for (int row = 0; row < height; ++row)
+        {
+            const byte* source = sdf + static_cast<usize>(row) * width;
+            uint32* destination = pixels.data() + static_cast<usize>(height - 1 - row) * width;
+            for (int column = 0; column < width; ++column)
+            {
+                destination[column] = 0x00FFFFFFu | (static_cast<uint32>(source[column]) << 24);
+            }
+        }
+        stbtt_FreeSDF(sdf, nullptr);
+
+        glyph.Region = m_Atlas->Add(std::to_string(codepoint), pixels.data(),
+                                    static_cast<uint32>(width), static_cast<uint32>(height));
+
+        // The bitmap spans offsetY (top, y-down) to offsetY + height below it; flip to y-up
+        glyph.Min = vec2(static_cast<float32>(offsetX), static_cast<float32>(-(offsetY + height))) / m_BakeSize;
+        glyph.Max = vec2(static_cast<float32>(offsetX + width), static_cast<float32>(-offsetY)) / m_BakeSize;
+
+        m_AtlasDirty = true;
+        return glyph;
+    }
+
+    // =========================================================================
+    // Layout
+    // =========================================================================
+
+    const TextLayout& Font::GetLayout(std::string_view text)
+    {
+        auto it = m_Layouts.find(text);
+        if (it != m_Layouts.end())
+        {
+            return it->second;
+        }
+
+        if (m_Layouts.size() >= MAX_CACHED_LAYOUTS)
+        {
+            m_Layouts.clear();
+        }
+
+        TextLayout layout;
+        layout.Quads.reserve(text.size());
+
+        vec2 pen(0.0f);
+        uint32 previous = 0;
+        uint32 lineCount = 1;
+
+        usize cursor = 0;
+        while (cursor < text.size())
+        {
+            uint32 codepoint = DecodeUTF8(text, cursor);
+
+            if (codepoint == '\n')
+            {
+                layout.Size.x = std::max(layout.Size.x, pen.x);
+                pen.x = 0.0f;
+                pen.y -= m_LineHeight;
+                previous = 0;
+                ++lineCount;
+                continue;
+            }
+
+            if (codepoint == '\t')
+            {
+                pen.x += GetGlyph(' ').Advance * TAB_WIDTH_IN_SPACES;
+                previous = 0;
+                continue;
+            }
+
+            if (previous)
+            {
+                pen.x += GetKerning(previous, codepoint);
+            }
+
+            const Glyph& glyph = GetGlyph(codepoint);
+            if (glyph.Region)
+            {
+                layout.Quads.push_back({ glyph.Region, pen + glyph.Min, pen + glyph.Max });
+            }
+
+            pen.x += glyph.Advance;
+            previous = codepoint;
+        }
+
+        layout.Size.x = std::max(layout.Size.x, pen.x);
+        layout.Size.y = (m_Ascent - m_Descent) + (lineCount - 1) * m_LineHeight;
+
+        return m_Layouts.emplace(std::string(text), std::move(layout)).first->second;
+    }
+
+    // =========================================================================
+    // GPU
+    // =========================================================================
+
+    void Font::UploadAtlas()
+    {
+        if (!m_AtlasDirty)
+        {
+            return;
+        }
+
+        m_Atlas->Upload();
+        m_AtlasDirty = false;
+    }
+
+} // namespace NanSu
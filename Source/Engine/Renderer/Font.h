@@ -0,0 +1,153 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Core/Math.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Forward declaration to avoid including stb_truetype in header file
+struct stbtt_fontinfo;
+
+namespace NanSu
+{
+    // Forward declarations
+    class SubTexture2D;
+    class TextureAtlas;
+
+    /**
+     * @brief Metrics and atlas region of one rasterized glyph
+     *
+     * All distances are in font units where 1.0 is the font height
+     * (ascent - descent), with y pointing up from the baseline.
+     */
+    struct Glyph
+    {
+        const SubTexture2D* Region = nullptr;   // nullptr for glyphs without outline (space)
+        vec2 Min = vec2(0.0f);                  // Quad bounds relative to the pen position
+        vec2 Max = vec2(0.0f);
+        float32 Advance = 0.0f;                 // Horizontal pen advance
+    };
+
+    /**
+     * @brief Laid out string: glyph quads relative to the first baseline
+     */
+    struct TextLayout
+    {
+        struct GlyphQuad
+        {
+            const SubTexture2D* Region;
+            vec2 Min;
+            vec2 Max;
+        };
+
+        std::vector<GlyphQuad> Quads;
+        vec2 Size = vec2(0.0f);     // Width of the widest line, total height of all lines
+    };
+
+    /**
+     * @brief TrueType font rasterized into a signed distance field glyph atlas
+     *
+     * Glyphs are rendered with stb_truetype as single-channel SDFs at a fixed
+     * bake size and packed into a TextureAtlas; printable ASCII is baked at
+     * load time and other codepoints on first use. Because the shader
+     * reconstructs edges from distances, the same atlas stays sharp at any
+     * on-screen size.
+     *
+     * Layouts (kerning, advances, line breaks) are cached per string, so
+     * drawing the same label every frame does no shaping work.
+     *
+     * Example usage:
+     * @code
+     * Font font("../../Assets/Fonts/Roboto-Regular.ttf");
+     * TextRenderer::DrawString("Hello", &font, {0.0f, 0.0f, 0.0f}, 0.25f);
+     * @endcode
+     */
+    class Font
+    {
+    public:
+        static constexpr float32 DEFAULT_BAKE_SIZE = 48.0f;
+        static constexpr uint32 ATLAS_PAGE_SIZE = 1024;
+
+        // Cached layouts beyond this count are dropped (all at once) before adding more
+        static constexpr usize MAX_CACHED_LAYOUTS = 4096;
+
+        /**
+         * @brief Load a TrueType font and bake its ASCII glyphs
+         * @param filePath Path to the .ttf file (resolved through AssetSystem)
+         * @param bakeSize Glyph height in atlas pixels (larger = finer detail)
+         */
+        explicit Font(const std::string& filePath, float32 bakeSize = DEFAULT_BAKE_SIZE);
+        ~Font();
+
+        // Non-copyable
+        Font(const Font&) = delete;
+        Font& operator=(const Font&) = delete;
+
+        bool IsLoaded() const { return m_Info != nullptr; }
+        const std::string& GetFilePath() const { return m_FilePath; }
+
+        /**
+         * @brief Get a glyph, rasterizing it into the atlas on first use
+         * @return The glyph, or the fallback glyph ('?') if the font lacks the codepoint
+         */
+        const Glyph& GetGlyph(uint32 codepoint);
+
+        /**
+         * @brief Kerning adjustment between two consecutive codepoints (font units)
+         */
+        float32 GetKerning(uint32 left, uint32 right) const;
+
+        /**
+         * @brief Get the cached layout of a UTF-8 string, building it on first use
+         *
+         * '\n' starts a new line. The reference is invalidated when a later call
+         * trims the cache (see MAX_CACHED_LAYOUTS).
+         */
+        const TextLayout& GetLayout(std::string_view text);
+
+        float32 GetAscent() const { return m_Ascent; }
+        float32 GetDescent() const { return m_Descent; }
+        float32 GetLineHeight() const { return m_LineHeight; }
+
+        /**
+         * @brief Upload atlas pages that received new glyphs
+         */
+        void UploadAtlas();
+
+        const TextureAtlas& GetAtlas() const { return *m_Atlas; }
+
+    private:
+        /**
+         * @brief Rasterize a glyph as an SDF and pack it into the atlas
+         */
+        Glyph BakeGlyph(uint32 codepoint);
+
+    private:
+        std::string m_FilePath;
+        std::vector<byte> m_FontData;   // Must outlive m_Info
+        std::unique_ptr<stbtt_fontinfo> m_Info;
+
+        float32 m_BakeSize;
+        float32 m_Scale = 0.0f;         // Font design units to atlas pixels
+        float32 m_Ascent = 0.0f;
+        float32 m_Descent = 0.0f;
+        float32 m_LineHeight = 0.0f;
+
+        std::unique_ptr<TextureAtlas> m_Atlas;
+        std::unordered_map<uint32, Glyph> m_Glyphs;
+
+        // Transparent hash: lookups by string_view do not allocate
+        struct LayoutKeyHash
+        {
+            using is_transparent = void;
+            usize operator()(std::string_view text) const { return std::hash<std::string_view>{}(text); }
+        };
+        std::unordered_map<std::string, TextLayout, LayoutKeyHash, std::equal_to<>> m_Layouts;
+        bool m_AtlasDirty = false;
+    };
+
+} // namespace NanSu
@@ -0,0 +1,185 @@
+#include "EnginePCH.h"
+#include "Renderer/FramePacer.h"
+
+#include <cmath>
+#include <thread>
+
+#ifdef NS_PLATFORM_WINDOWS
+    #include <timeapi.h>
+    #pragma comment(lib, "winmm.lib")
+
+    // Windows 10 1803+; older systems fail the timer creation and use timeBeginPeriod
+    #ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+        #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+    #endif
+#endif
+
+namespace NanSu
+{
+    namespace
+    {
+        // Sleeps shorter than this are left to the spin
+        constexpr float64 MIN_SLEEP = 0.0002;
+
+        // Weight of the newest sample in the overshoot estimate (~20 samples of memory)
+        constexpr float64 OVERSHOOT_WEIGHT = 0.05;
+
+        float64 ToSeconds(FramePacer::Clock::duration duration)
+        {
+            return std::chrono::duration<float64>(duration).count();
+        }
+    }
+
+    FramePacer::FramePacer()
+    {
+        Clock::time_point now = Clock::now();
+        m_FrameStart = now;
+        m_PresentStart = now;
+        m_LastPresentEnd = now;
+        m_NextFrame = now;
+
+#ifdef NS_PLATFORM_WINDOWS
+        m_Timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+        if (!m_Timer)
+        {
+            // Without it, Sleep() granularity is the system timer period (15.6 ms by default)
+            m_RaisedTimerPeriod = timeBeginPeriod(1) == TIMERR_NOERROR;
+        }
+#endif
+    }
+
+    FramePacer::~FramePacer()
+    {
+#ifdef NS_PLATFORM_WINDOWS
+        if (m_Timer)
+        {
+            CloseHandle(m_Timer);
+        }
+        if (m_RaisedTimerPeriod)
+        {
+            timeEndPeriod(1);
+        }
+#endif
+    }
+
+    void FramePacer::SetTargetFrameRate(float64 framesPerSecond)
+    {
+        m_TargetFrameRate = std::max(framesPerSecond, 0.0);
+        m_FramePeriod = m_TargetFrameRate > 0.0
+            ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float64>(1.0 / m_TargetFrameRate))
+            : Clock::duration::zero();
+
+        // Restart the schedule from the next present
+        m_NextFrame = Clock::now() + m_FramePeriod;
+    }
+
+    void FramePacer::BeginPresent()
+    {
+        m_PresentStart = Clock::now();
+    }
+
+    void FramePacer::EndPresent()
+    {
+        Clock::time_point presentEnd = Clock::now();
+
+        m_Statistics.PresentTime = ToSeconds(presentEnd - m_PresentStart);
+        RecordFrame(ToSeconds(presentEnd - m_LastPresentEnd), ToSeconds(presentEnd - m_FrameStart));
+        m_LastPresentEnd = presentEnd;
+
+        m_Statistics.WaitTime = 0.0;
+        if (m_FramePeriod > Clock::duration::zero())
+        {
+            // Fixed schedule so timing errors do not accumulate; resync after a long stall
+            if (presentEnd - m_NextFrame > m_FramePeriod)
+            {
+                m_NextFrame = presentEnd;
+            }
+
+            WaitUntil(m_NextFrame);
+            m_NextFrame += m_FramePeriod;
+
+            Clock::time_point released = Clock::now();
+            m_Statistics.WaitTime = ToSeconds(released - presentEnd);
+            m_FrameStart = released;
+        }
+        else
+        {
+            m_FrameStart = presentEnd;
+        }
+    }
+
+    void FramePacer::WaitUntil(Clock::time_point deadline)
+    {
+        // Sleep until the expected overshoot would reach the deadline
+        while (true)
+        {
+            float64 requested = ToSeconds(deadline - Clock::now()) - (m_OvershootMean + m_OvershootDeviation);
+            if (requested < MIN_SLEEP)
+            {
+                break;
+            }
+
+            Clock::time_point sleepStart = Clock::now();
+            SleepFor(requested);
+            float64 overshoot = ToSeconds(Clock::now() - sleepStart) - requested;
+
+            // Recent sleeps dominate, so the estimate recovers after a burst of late wake-ups
+            m_OvershootMean += OVERSHOOT_WEIGHT * (overshoot - m_OvershootMean);
+            m_OvershootDeviation += OVERSHOOT_WEIGHT * (std::abs(overshoot - m_OvershootMean) - m_OvershootDeviation);
+        }
+
+        // Spin for the rest
+        while (Clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    void FramePacer::SleepFor(float64 seconds)
+    {
+#ifdef NS_PLATFORM_WINDOWS
+        if (m_Timer)
+        {
+            // Negative due time: relative, in 100 ns units
+            LARGE_INTEGER dueTime;
+            dueTime.QuadPart = -static_cast<LONGLONG>(seconds * 1.0e7);
+            if (SetWaitableTimerEx(m_Timer, &dueTime, 0, nullptr, nullptr, nullptr, 0))
+            {
+                WaitForSingleObject(m_Timer, INFINITE);
+                return;
+            }
+        }
+#endif
+        std::this_thread::sleep_for(std::chrono::duration<float64>(seconds));
+    }
+
+    void FramePacer::RecordFrame(float64 frameTime, float64 latency)
+    {
+        uint32 slot = static_cast<uint32>(m_Statistics.FrameCount % STATISTICS_WINDOW);
+        m_FrameTimes[slot] = frameTime;
+        m_Latencies[slot] = latency;
+        ++m_Statistics.FrameCount;
+
+        uint32 count = static_cast<uint32>(std::min<uint64>(m_Statistics.FrameCount, STATISTICS_WINDOW));
+
+        float64 frameTimeSum = 0.0;
+        float64 latencySum = 0.0;
+        float64 minFrameTime = m_FrameTimes[0];
+        float64 maxFrameTime = m_FrameTimes[0];
+        for (uint32 i = 0; i < count; ++i)
+        {
+            frameTimeSum += m_FrameTimes[i];
+            latencySum += m_Latencies[i];
+            minFrameTime = std::min(minFrameTime, m_FrameTimes[i]);
+            maxFrameTime = std::max(maxFrameTime, m_FrameTimes[i]);
+        }
+
+        m_Statistics.FrameTime = frameTime;
+        m_Statistics.AverageFrameTime = frameTimeSum / count;
+        m_Statistics.MinFrameTime = minFrameTime;
+        m_Statistics.MaxFrameTime = maxFrameTime;
+        m_Statistics.Latency = latency;
+        m_Statistics.AverageLatency = latencySum / count;
+    }
+
+} // namespace NanSu
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "Core/Types.h"
+
+#include <array>
+#include <chrono>
+
+namespace NanSu
+{
+    // =========================================================================
+    // PresentMode
+    // =========================================================================
+
+    /**
+     * @brief How frames are handed to the display
+     *
+     * Example usage:
+     * @code
+     * context.SetPresentMode(PresentMode::VSync());
+     * context.SetPresentMode(PresentMode::Immediate());   // Uncapped (benchmarks)
+     * context.SetPresentMode(PresentMode::Capped(90));    // CPU-paced, no vsync
+     * @endcode
+     */
+    struct PresentMode
+    {
+        enum class Type : uint8
+        {
+            VSync = 0,      // Wait for vertical blank
+            Immediate,      // Present as fast as possible (tearing allowed when supported)
+            Capped          // Present immediately, paced by the CPU frame limiter
+        };
+
+        Type Mode = Type::VSync;
+        float64 FrameRate = 0.0;    // Frames per second (Capped only)
+
+        static PresentMode VSync() { return { Type::VSync, 0.0 }; }
+        static PresentMode Immediate() { return { Type::Immediate, 0.0 }; }
+        static PresentMode Capped(float64 framesPerSecond) { return { Type::Capped, framesPerSecond }; }
+
+        bool operator==(const PresentMode& other) const = default;
+    };
+
+    // =========================================================================
+    // FrameStatistics
+    // =========================================================================
+
+    /**
+     * @brief Frame timing measured around the present call (seconds)
+     *
+     * Latency is the time from the start of a frame (after the limiter
+     * released it, so input is sampled as late as possible) until its
+     * present call returned.
+     */
+    struct FrameStatistics
+    {
+        float64 FrameTime = 0.0;            // Between the last two presents
+        float64 AverageFrameTime = 0.0;     // Averages, minimum and maximum over STATISTICS_WINDOW frames
+        float64 MinFrameTime = 0.0;
+        float64 MaxFrameTime = 0.0;
+
+        float64 Latency = 0.0;
+        float64 AverageLatency = 0.0;
+
+        float64 PresentTime = 0.0;          // Blocked inside the present call
+        float64 WaitTime = 0.0;             // Spent in the frame limiter
+
+        uint64 FrameCount = 0;
+
+        float64 GetFramesPerSecond() const { return AverageFrameTime > 0.0 ? 1.0 / AverageFrameTime : 0.0; }
+    };
+
+    // =========================================================================
+    // FramePacer
+    // =========================================================================
+
+    /**
+     * @brief Backend-independent frame limiter and frame time statistics
+     *
+     * Graphics contexts call BeginPresent() and EndPresent() around their
+     * native present. When a target frame rate is set, EndPresent() waits
+     * until the next frame slot before returning: it sleeps while the slot is
+     * far away and spins for the final stretch, since OS sleeps overshoot
+     * their request. The overshoot is tracked as an exponentially weighted
+     * mean and deviation, so the spin only covers what the sleeps cannot hit
+     * precisely and follows changes in timer resolution or system load.
+     *
+     * On Windows the sleeps use a high-resolution waitable timer; where that
+     * is unavailable the system timer period is raised to 1 ms while the
+     * pacer exists.
+     *
+     * Waiting after the present (rather than before it) starts the next frame
+     * as late as possible, which keeps input-to-display latency low.
+     */
+    class FramePacer
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr uint32 STATISTICS_WINDOW = 120;
+
+        FramePacer();
+        ~FramePacer();
+
+        // Non-copyable (owns the OS timer)
+        FramePacer(const FramePacer&) = delete;
+        FramePacer& operator=(const FramePacer&) = delete;
+
+        /**
+         * @brief Limit the frame rate (0 = unlimited)
+         */
+        void SetTargetFrameRate(float64 framesPerSecond);
+        float64 GetTargetFrameRate() const { return m_TargetFrameRate; }
+
+        /**
+         * @brief Call right before the native present
+         */
+        void BeginPresent();
+
+        /**
+         * @brief Call right after the native present; waits for the next frame slot
+         */
+        void EndPresent();
+
+        const FrameStatistics& GetStatistics() const { return m_Statistics; }
+
+    private:
+        /**
+         * @brief Hybrid sleep/spin wait until a point in time
+         */
+        void WaitUntil(Clock::time_point deadline);
+
+        /**
+         * @brief Block the thread for about the given time (may overshoot)
+         */
+        void SleepFor(float64 seconds);
+
+        void RecordFrame(float64 frameTime, float64 latency);
+
+    private:
+        float64 m_TargetFrameRate = 0.0;
+        Clock::duration m_FramePeriod = Clock::duration::zero();
+        Clock::time_point m_NextFrame;
+
+        Clock::time_point m_FrameStart;
+        Clock::time_point m_PresentStart;
+        Clock::time_point m_LastPresentEnd;
+
+        // Exponentially weighted mean and mean deviation of the sleep overshoot
+        float64 m_OvershootMean = 0.001;
+        float64 m_OvershootDeviation = 0.001;
+
+        // High-resolution waitable timer (Windows), null when sleeping through the scheduler
+        void* m_Timer = nullptr;
+        bool m_RaisedTimerPeriod = false;
+
+        std::array<float64, STATISTICS_WINDOW> m_FrameTimes = {};
+        std::array<float64, STATISTICS_WINDOW> m_Latencies = {};
+        FrameStatistics m_Statistics;
+    };
+
+} // namespace NanSu
@@ -0,0 +1,196 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Core/Math.h"
+
+#include <initializer_list>
+#include <vector>
+
+namespace NanSu
+{
+    // Forward declarations
+    class Texture2D;
+
+    // =========================================================================
+    // FramebufferFormat
+    // =========================================================================
+
+    /**
+     * @brief Pixel formats of framebuffer attachments
+     */
+    enum class FramebufferFormat : uint8
+    {
+        None = 0,
+
+        // Color
+        RGBA8,              // 8-bit unorm per channel
+        RGBA16F,            // 16-bit float per channel (HDR, post-processing)
+        R32UInt,            // Single 32-bit integer (object ids for picking)
+
+        // Depth / stencil
+        Depth24Stencil8
+    };
+
+    /**
+     * @brief Check whether a format is a depth/stencil format
+     */
+    inline bool IsDepthFormat(FramebufferFormat format)
+    {
+        return format == FramebufferFormat::Depth24Stencil8;
+    }
+
+    /**
+     * @brief Size of one pixel of a format in bytes (as returned by ReadPixels)
+     */
+    inline uint32 GetBytesPerPixel(FramebufferFormat format)
+    {
+        switch (format)
+        {
+            case FramebufferFormat::RGBA8:              return 4;
+            case FramebufferFormat::RGBA16F:            return 8;
+            case FramebufferFormat::R32UInt:            return 4;
+            case FramebufferFormat::Depth24Stencil8:    return 4;
+            case FramebufferFormat::None:
+            default:                                    return 0;
+        }
+    }
+
+    // =========================================================================
+    // FramebufferSpecification
+    // =========================================================================
+
+    /**
+     * @brief Size and attachment formats of a framebuffer
+     *
+     * Color attachments are numbered in the order they appear (SV_Target0,
+     * SV_Target1, ...); at most one depth attachment may be given.
+     */
+    struct FramebufferSpecification
+    {
+        uint32 Width = 0;
+        uint32 Height = 0;
+        std::vector<FramebufferFormat> Attachments = { FramebufferFormat::RGBA8, FramebufferFormat::Depth24Stencil8 };
+
+        FramebufferSpecification() = default;
+        FramebufferSpecification(uint32 width, uint32 height, std::initializer_list<FramebufferFormat> attachments)
+            : Width(width), Height(height), Attachments(attachments) {}
+    };
+
+    // =========================================================================
+    // Framebuffer
+    // =========================================================================
+
+    /**
+     * @brief Abstract interface for off-screen render targets
+     *
+     * While bound, all draws go to the framebuffer's attachments instead of
+     * the window. Color attachments are exposed as Texture2D, so the result
+     * can be drawn with Renderer2D like any other texture. The attachment
+     * objects stay the same across Resize(); only their contents and size
+     * change.
+     *
+     * Use Framebuffer::Create() to create the platform-specific implementation.
+     *
+     * Example usage:
+     * @code
+     * auto* viewport = Framebuffer::Create({ 1280, 720, { FramebufferFormat::RGBA8, FramebufferFormat::Depth24Stencil8 } });
+     *
+     * viewport->Bind();
+     * viewport->Clear({ 0.1f, 0.1f, 0.1f, 1.0f });
+     * Renderer2D::BeginScene(camera);
+     * // ... draw the scene ...
+     * Renderer2D::EndScene();
+     * viewport->Unbind();
+     *
+     * Renderer2D::DrawQuad({ 0.0f, 0.0f }, { 1.6f, 0.9f }, viewport->GetColorAttachment());
+     * @endcode
+     */
+    class Framebuffer
+    {
+    public:
+        virtual ~Framebuffer() = default;
+
+        // Non-copyable
+        Framebuffer(const Framebuffer&) = delete;
+        Framebuffer& operator=(const Framebuffer&) = delete;
+
+        /**
+         * @brief Render into this framebuffer and set the viewport to its size
+         *
+         * The previous viewport is saved and restored by Unbind(). Framebuffers
+         * do not nest: unbind one before binding another.
+         */
+        virtual void Bind() = 0;
+
+        /**
+         * @brief Bind the main render target again and restore the viewport
+         */
+        virtual void Unbind() = 0;
+
+        /**
+         * @brief Recreate the attachments with a new size (contents are lost)
+         */
+        virtual void Resize(uint32 width, uint32 height) = 0;
+
+        /**
+         * @brief Clear all color attachments to a color and depth to 1.0
+         *
+         * RenderCommand::Clear() always clears the main render target, so
+         * framebuffers are cleared through this function.
+         */
+        virtual void Clear(const vec4& color) = 0;
+
+        /**
+         * @brief Clear a single color attachment
+         * @param index Color attachment index
+         * @param value Clear value (converted to the attachment format)
+         */
+        virtual void ClearAttachment(uint32 index, const vec4& value) = 0;
+
+        /**
+         * @brief Get a color attachment as a sampleable texture
+         * @param index Color attachment index
+         * @return The attachment (owned by the framebuffer)
+         *
+         * Do not sample an attachment while its framebuffer is bound.
+         */
+        virtual Texture2D* GetColorAttachment(uint32 index = 0) const = 0;
+
+        /**
+         * @brief Get the number of color attachments
+         */
+        virtual uint32 GetColorAttachmentCount() const = 0;
+
+        /**
+         * @brief Copy a rectangle of a color attachment to CPU memory
+         * @param index Color attachment index
+         * @param x Left edge in pixels
+         * @param y Top edge in pixels (row 0 is the top of the framebuffer)
+         * @param width Rectangle width in pixels
+         * @param height Rectangle height in pixels
+         * @param outData Destination, tightly packed rows of
+         *                GetBytesPerPixel(format) bytes per pixel
+         * @return true on success
+         *
+         * Waits for the GPU to finish rendering into the attachment, so avoid
+         * it on the per-frame path where possible.
+         */
+        virtual bool ReadPixels(uint32 index, uint32 x, uint32 y, uint32 width, uint32 height, void* outData) = 0;
+
+        /**
+         * @brief Get the current size and attachment formats
+         */
+        virtual const FramebufferSpecification& GetSpecification() const = 0;
+
+        /**
+         * @brief Create a framebuffer for the current platform
+         * @param spec Size and attachment formats
+         * @return Pointer to the created framebuffer (caller owns memory)
+         */
+        static Framebuffer* Create(const FramebufferSpecification& spec);
+
+    protected:
+        Framebuffer() = default;
+    };
+
+} // namespace NanSu
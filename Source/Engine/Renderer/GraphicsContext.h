@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Types.h"
+#include "Renderer/FramePacer.h"
 
 namespace NanSu
 {
@@ -13,8 +14,12 @@ namespace NanSu
      * Responsibilities:
      * - Initialize graphics device and swap chain
      * - Clear the render target
-     * - Present frames (swap buffers)
+     * - Present frames (swap buffers) in the selected PresentMode
      * - Handle window resize
+     *
+     * Frame pacing for PresentMode::Capped and the frame statistics are
+     * shared by all backends through the FramePacer; implementations wrap
+     * their native present in BeginPresent() / EndPresent().
      */
     class GraphicsContext
     {
@@ -48,10 +53,27 @@ namespace NanSu
 
         /**
          * @brief Present the back buffer (swap buffers)
-         * Should be called at the end of each frame
+         * Should be called at the end of each frame. With a capped present
+         * mode this also waits for the next frame slot.
          */
         virtual void SwapBuffers() = 0;
 
+        /**
+         * @brief Select vsync, immediate or CPU-capped presentation
+         */
+        void SetPresentMode(const PresentMode& mode)
+        {
+            m_PresentMode = mode;
+            m_FramePacer.SetTargetFrameRate(mode.Mode == PresentMode::Type::Capped ? mode.FrameRate : 0.0);
+        }
+
+        const PresentMode& GetPresentMode() const { return m_PresentMode; }
+
+        /**
+         * @brief Frame time and latency measured around the present
+         */
+        const FrameStatistics& GetFrameStatistics() const { return m_FramePacer.GetStatistics(); }
+
         /**
          * @brief Handle window resize
          * Recreates swap chain buffers to match new dimensions
@@ -89,5 +111,9 @@ namespace NanSu
 
     protected:
         GraphicsContext() = default;
+
+    protected:
+        PresentMode m_PresentMode;
+        FramePacer m_FramePacer;
     };
 }
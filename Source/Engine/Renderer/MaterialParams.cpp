@@ -0,0 +1,94 @@
+#include "EnginePCH.h"
+#include "Renderer/MaterialParams.h"
+#include "Renderer/ConstantBuffer.h"
+
+#include <cstring>
+
+namespace NanSu
+{
+    MaterialParams::MaterialParams(const ShaderUniformBuffer& layout)
+        : m_Layout(layout)
+        , m_Shadow(layout.Size, 0)
+    {
+        NS_ENGINE_ASSERT(layout.Size > 0, "Constant buffer '{}' is empty", layout.Name);
+        m_Buffer = ConstantBuffer::Create(layout.Size);
+    }
+
+    MaterialParams::~MaterialParams()
+    {
+        delete m_Buffer;
+        m_Buffer = nullptr;
+    }
+
+    // =========================================================================
+    // Parameters
+    // =========================================================================
+
+    bool MaterialParams::SetRaw(std::string_view name, const void* data, uint32 size)
+    {
+        const ShaderUniform* uniform = m_Layout.FindUniform(name);
+        if (!uniform)
+        {
+            NS_ENGINE_WARN("Constant buffer '{}' has no member '{}'", m_Layout.Name, name);
+            return false;
+        }
+
+        if (size > uniform->Size)
+        {
+            NS_ENGINE_WARN("Value for '{}.{}' is {} bytes, member is {} bytes",
+                           m_Layout.Name, name, size, uniform->Size);
+            return false;
+        }
+
+        byte* destination = m_Shadow.data() + uniform->Offset;
+        if (std::memcmp(destination, data, size) == 0)
+        {
+            return true;  // Unchanged, nothing to upload
+        }
+
+        std::memcpy(destination, data, size);
+
+        if (IsDirty())
+        {
+            m_DirtyBegin = std::min(m_DirtyBegin, uniform->Offset);
+            m_DirtyEnd = std::max(m_DirtyEnd, uniform->Offset + size);
+        }
+        else
+        {
+            m_DirtyBegin = uniform->Offset;
+            m_DirtyEnd = uniform->Offset + size;
+        }
+
+        return true;
+    }
+
+    bool MaterialParams::Set(std::string_view name, const mat3& value)
+    {
+        // float3x3 occupies three registers; the last column has no padding
+        vec4 columns[3] = { vec4(value[0], 0.0f), vec4(value[1], 0.0f), vec4(value[2], 0.0f) };
+        return SetRaw(name, columns, sizeof(vec4) * 2 + sizeof(vec3));
+    }
+
+    // =========================================================================
+    // GPU
+    // =========================================================================
+
+    void MaterialParams::Upload()
+    {
+        if (!IsDirty())
+        {
+            return;
+        }
+
+        m_Buffer->SetSubData(m_Shadow.data() + m_DirtyBegin, m_DirtyBegin, m_DirtyEnd - m_DirtyBegin);
+        m_DirtyBegin = 0;
+        m_DirtyEnd = 0;
+    }
+
+    void MaterialParams::Bind()
+    {
+        Upload();
+        m_Buffer->Bind(m_Layout.Slot);
+    }
+
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Core/Math.h"
+#include "Renderer/Shader.h"
+
+#include <string_view>
+#include <vector>
+
+namespace NanSu
+{
+    // Forward declarations
+    class ConstantBuffer;
+
+    /**
+     * @brief Named, reflection-driven parameters of one shader constant buffer
+     *
+     * The layout (member names, offsets and sizes) comes from the shader's
+     * reflected ShaderUniformBuffer, so no C++ struct has to mirror the HLSL
+     * cbuffer. Values are written into a packed CPU shadow; writes that change
+     * bytes extend a dirty range, and Upload()/Bind() send only that range to
+     * the GPU. Writing a value equal to the current one leaves the block clean.
+     *
+     * Matrices are stored as given: with the default column-major packing the
+     * shader sees the same matrix as glm, so HLSL should use mul(M, v).
+     *
+     * Example usage:
+     * @code
+     * const auto* layout = shader->FindUniformBuffer("SceneData");
+     * auto* params = new MaterialParams(*layout);
+     * params->Set("u_ViewProjection", camera.GetViewProjectionMatrix());
+     * params->Bind();  // Uploads the dirty range and binds to the reflected slot
+     * @endcode
+     */
+    class MaterialParams
+    {
+    public:
+        /**
+         * @brief Create the parameter block and its GPU constant buffer
+         * @param layout Reflected constant buffer layout
+         */
+        explicit MaterialParams(const ShaderUniformBuffer& layout);
+        ~MaterialParams();
+
+        // Non-copyable
+        MaterialParams(const MaterialParams&) = delete;
+        MaterialParams& operator=(const MaterialParams&) = delete;
+
+        // =====================================================================
+        // Parameters
+        // =====================================================================
+
+        /**
+         * @brief Write raw bytes into a named member
+         * @param name Member name as declared in the HLSL cbuffer
+         * @param data Source bytes
+         * @param size Number of bytes (must not exceed the member size)
+         * @return false if the member does not exist or the value does not fit
+         */
+        bool SetRaw(std::string_view name, const void* data, uint32 size);
+
+        bool Set(std::string_view name, float32 value) { return SetRaw(name, &value, sizeof(value)); }
+        bool Set(std::string_view name, int32 value) { return SetRaw(name, &value, sizeof(value)); }
+        bool Set(std::string_view name, const vec2& value) { return SetRaw(name, &value, sizeof(value)); }
+        bool Set(std::string_view name, const vec3& value) { return SetRaw(name, &value, sizeof(value)); }
+        bool Set(std::string_view name, const vec4& value) { return SetRaw(name, &value, sizeof(value)); }
+        bool Set(std::string_view name, const mat4& value) { return SetRaw(name, &value, sizeof(value)); }
+
+        /**
+         * @brief Write a 3x3 matrix (each column is padded to a 16-byte register)
+         */
+        bool Set(std::string_view name, const mat3& value);
+
+        /**
+         * @brief Check whether the layout has a member with this name
+         */
+        bool Has(std::string_view name) const { return m_Layout.FindUniform(name) != nullptr; }
+
+        // =====================================================================
+        // GPU
+        // =====================================================================
+
+        /**
+         * @brief Upload the dirty byte range, if any
+         */
+        void Upload();
+
+        /**
+         * @brief Upload pending changes and bind to the reflected slot
+         */
+        void Bind();
+
+        bool IsDirty() const { return m_DirtyBegin < m_DirtyEnd; }
+        const ShaderUniformBuffer& GetLayout() const { return m_Layout; }
+
+    private:
+        ShaderUniformBuffer m_Layout;
+        std::vector<byte> m_Shadow;
+        ConstantBuffer* m_Buffer = nullptr;
+
+        // Dirty byte range [begin, end); empty when begin >= end
+        uint32 m_DirtyBegin = 0;
+        uint32 m_DirtyEnd = 0;
+    };
+
+}
@@ -0,0 +1,267 @@
+#include "EnginePCH.h"
+#include "Renderer/ParticleSystem.h"
+#include "Renderer/Renderer2D.h"
+
+#include <execution>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+    #include <xmmintrin.h>
+    #define NS_PARTICLES_SSE 1
+#else
+    #define NS_PARTICLES_SSE 0
+#endif
+
+namespace NanSu
+{
+    namespace
+    {
+        constexpr uint32 SIMD_WIDTH = 4;
+
+        // Emitters with fewer live particles are not worth a worker thread
+        constexpr uint32 PARALLEL_UPDATE_THRESHOLD = 2048;
+
+        uint32 s_NextEmitterSeed = 0x9E3779B9u;
+    }
+
+    // =========================================================================
+    // ParticleEmitter
+    // =========================================================================
+
+    ParticleEmitter::ParticleEmitter(const ParticleEmitterProps& props)
+        : m_Props(props)
+        , m_Capacity((props.MaxParticles + SIMD_WIDTH - 1) / SIMD_WIDTH * SIMD_WIDTH)
+        , m_RandomState(s_NextEmitterSeed)
+    {
+        s_NextEmitterSeed = s_NextEmitterSeed * 1664525u + 1013904223u;
+        if (m_RandomState == 0)
+        {
+            m_RandomState = 1;  // xorshift must not start at zero
+        }
+
+        // Padded to the SIMD width so the vector loops never need a scalar tail
+        m_PositionX.resize(m_Capacity);
+        m_PositionY.resize(m_Capacity);
+        m_VelocityX.resize(m_Capacity);
+        m_VelocityY.resize(m_Capacity);
+        m_Rotation.resize(m_Capacity);
+        m_AngularVelocity.resize(m_Capacity);
+        m_Age.resize(m_Capacity);
+        m_AgeRate.resize(m_Capacity);
+        m_BaseSize.resize(m_Capacity);
+        m_Size.resize(m_Capacity);
+        m_Color.resize(m_Capacity);
+    }
+
+    void ParticleEmitter::Emit(uint32 count)
+    {
+        // The arrays were sized once from MaxParticles; a later, larger value cannot grow them
+        uint32 limit = std::min(m_Props.MaxParticles, m_Capacity);
+        count = std::min(count, limit - std::min(m_AliveCount, limit));
+
+        for (uint32 n = 0; n < count; ++n)
+        {
+            uint32 i = m_AliveCount++;
+
+            m_PositionX[i] = m_Props.Position.x + RandomRange(m_Props.PositionVariation.x);
+            m_PositionY[i] = m_Props.Position.y + RandomRange(m_Props.PositionVariation.y);
+            m_VelocityX[i] = m_Props.Velocity.x + RandomRange(m_Props.VelocityVariation.x);
+            m_VelocityY[i] = m_Props.Velocity.y + RandomRange(m_Props.VelocityVariation.y);
+            m_Rotation[i] = RandomFloat() * glm::two_pi<float32>();
+            m_AngularVelocity[i] = m_Props.AngularVelocity + RandomRange(m_Props.AngularVelocityVariation);
+
+            float32 lifeTime = std::max(m_Props.LifeTime + RandomRange(m_Props.LifeTimeVariation), 0.001f);
+            m_Age[i] = 0.0f;
+            m_AgeRate[i] = 1.0f / lifeTime;
+            m_BaseSize[i] = std::max(m_Props.Size + RandomRange(m_Props.SizeVariation), 0.0f);
+
+            m_Size[i] = m_BaseSize[i] * m_Props.SizeOverLife.Evaluate(0.0f);
+            m_Color[i] = m_Props.ColorOverLife.Evaluate(0.0f);
+        }
+    }
+
+    void ParticleEmitter::Update(float32 deltaTime)
+    {
+        // Continuous emission, carrying the fractional remainder to the next frame
+        if (m_Props.EmitRate > 0.0f)
+        {
+            m_EmitAccumulator += m_Props.EmitRate * deltaTime;
+            uint32 count = static_cast<uint32>(m_EmitAccumulator);
+            m_EmitAccumulator -= static_cast<float32>(count);
+            Emit(count);
+        }
+
+        Integrate(deltaTime);
+
+        // Swap-remove dead particles; the moved particle is re-checked in the same slot
+        for (uint32 i = 0; i < m_AliveCount;)
+        {
+            if (m_Age[i] >= 1.0f)
+            {
+                Kill(i);
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        // Over-life curves (table lookups)
+        for (uint32 i = 0; i < m_AliveCount; ++i)
+        {
+            float32 age = m_Age[i];
+            m_Size[i] = m_BaseSize[i] * m_Props.SizeOverLife.Evaluate(age);
+            m_Color[i] = m_Props.ColorOverLife.Evaluate(age);
+        }
+    }
+
+    void ParticleEmitter::Integrate(float32 deltaTime)
+    {
+        const uint32 count = m_AliveCount;
+
+#if NS_PARTICLES_SSE
+        const __m128 dt = _mm_set1_ps(deltaTime);
+        const __m128 accelerationX = _mm_set1_ps(m_Props.Acceleration.x * deltaTime);
+        const __m128 accelerationY = _mm_set1_ps(m_Props.Acceleration.y * deltaTime);
+
+        for (uint32 i = 0; i < count; i += SIMD_WIDTH)
+        {
+            __m128 velocityX = _mm_add_ps(_mm_loadu_ps(&m_VelocityX[i]), accelerationX);
+            __m128 velocityY = _mm_add_ps(_mm_loadu_ps(&m_VelocityY[i]), accelerationY);
+            _mm_storeu_ps(&m_VelocityX[i], velocityX);
+            _mm_storeu_ps(&m_VelocityY[i], velocityY);
+
+            _mm_storeu_ps(&m_PositionX[i], _mm_add_ps(_mm_loadu_ps(&m_PositionX[i]), _mm_mul_ps(velocityX, dt)));
+            _mm_storeu_ps(&m_PositionY[i], _mm_add_ps(_mm_loadu_ps(&m_PositionY[i]), _mm_mul_ps(velocityY, dt)));
+
+            __m128 angularVelocity = _mm_loadu_ps(&m_AngularVelocity[i]);
+            _mm_storeu_ps(&m_Rotation[i], _mm_add_ps(_mm_loadu_ps(&m_Rotation[i]), _mm_mul_ps(angularVelocity, dt)));
+
+            __m128 ageRate = _mm_loadu_ps(&m_AgeRate[i]);
+            _mm_storeu_ps(&m_Age[i], _mm_add_ps(_mm_loadu_ps(&m_Age[i]), _mm_mul_ps(ageRate, dt)));
+        }
+#else
+        const float32 accelerationX = m_Props.Acceleration.x * deltaTime;
+        const float32 accelerationY = m_Props.Acceleration.y * deltaTime;
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            m_VelocityX[i] += accelerationX;
+            m_VelocityY[i] += accelerationY;
+            m_PositionX[i] += m_VelocityX[i] * deltaTime;
+            m_PositionY[i] += m_VelocityY[i] * deltaTime;
+            m_Rotation[i] += m_AngularVelocity[i] * deltaTime;
+            m_Age[i] += m_AgeRate[i] * deltaTime;
+        }
+#endif
+    }
+
+    void ParticleEmitter::Kill(uint32 index)
+    {
+        uint32 last = --m_AliveCount;
+        if (index == last)
+        {
+            return;
+        }
+
+        m_PositionX[index] = m_PositionX[last];
+        m_PositionY[index] = m_PositionY[last];
+        m_VelocityX[index] = m_VelocityX[last];
+        m_VelocityY[index] = m_VelocityY[last];
+        m_Rotation[index] = m_Rotation[last];
+        m_AngularVelocity[index] = m_AngularVelocity[last];
+        m_Age[index] = m_Age[last];
+        m_AgeRate[index] = m_AgeRate[last];
+        m_BaseSize[index] = m_BaseSize[last];
+    }
+
+    void ParticleEmitter::Render() const
+    {
+        if (m_AliveCount == 0)
+        {
+            return;
+        }
+
+        BlendMode previousBlend = Renderer2D::GetBlendMode();
+        Renderer2D::SetBlendMode(m_Props.Blend);
+
+        Renderer2D::SpriteStream sprites;
+        sprites.Count = m_AliveCount;
+        sprites.PositionX = m_PositionX.data();
+        sprites.PositionY = m_PositionY.data();
+        sprites.Z = m_Props.Position.z;
+        sprites.Size = m_Size.data();
+        sprites.Rotation = m_Rotation.data();
+        sprites.Color = m_Color.data();
+        sprites.Texture = m_Props.Texture;
+        Renderer2D::DrawSprites(sprites);
+
+        Renderer2D::SetBlendMode(previousBlend);
+    }
+
+    float32 ParticleEmitter::RandomFloat()
+    {
+        // xorshift32: per-emitter state, so emitters can update on different threads
+        m_RandomState ^= m_RandomState << 13;
+        m_RandomState ^= m_RandomState >> 17;
+        m_RandomState ^= m_RandomState << 5;
+        return static_cast<float32>(m_RandomState >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // =========================================================================
+    // ParticleSystem
+    // =========================================================================
+
+    ParticleSystem::~ParticleSystem() = default;
+
+    ParticleEmitter* ParticleSystem::CreateEmitter(const ParticleEmitterProps& props)
+    {
+        m_Emitters.push_back(std::make_unique<ParticleEmitter>(props));
+        return m_Emitters.back().get();
+    }
+
+    void ParticleSystem::DestroyEmitter(ParticleEmitter* emitter)
+    {
+        auto it = std::find_if(m_Emitters.begin(), m_Emitters.end(),
+            [emitter](const std::unique_ptr<ParticleEmitter>& owned) { return owned.get() == emitter; });
+        NS_ENGINE_ASSERT(it != m_Emitters.end(), "Emitter does not belong to this particle system");
+
+        m_Emitters.erase(it);
+    }
+
+    void ParticleSystem::OnUpdate(float32 deltaTime)
+    {
+        auto update = [deltaTime](const std::unique_ptr<ParticleEmitter>& emitter)
+        {
+            emitter->Update(deltaTime);
+        };
+
+        // Emitters share no mutable state, so they can be simulated concurrently
+        if (m_Emitters.size() > 1 && GetAliveCount() >= PARALLEL_UPDATE_THRESHOLD)
+        {
+            std::for_each(std::execution::par, m_Emitters.begin(), m_Emitters.end(), update);
+        }
+        else
+        {
+            std::for_each(m_Emitters.begin(), m_Emitters.end(), update);
+        }
+    }
+
+    void ParticleSystem::OnRender() const
+    {
+        for (const auto& emitter : m_Emitters)
+        {
+            emitter->Render();
+        }
+    }
+
+    uint32 ParticleSystem::GetAliveCount() const
+    {
+        uint32 count = 0;
+        for (const auto& emitter : m_Emitters)
+        {
+            count += emitter->GetAliveCount();
+        }
+        return count;
+    }
+
+} // namespace NanSu
@@ -0,0 +1,306 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Core/Math.h"
+#include "Renderer/PipelineState.h"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace NanSu
+{
+    // Forward declarations
+    class Texture2D;
+
+    // =========================================================================
+    // ParticleCurve
+    // =========================================================================
+
+    /**
+     * @brief Piecewise-linear curve over normalized particle age, baked to a lookup table
+     *
+     * Keys are interpolated once when added; evaluating the curve per
+     * particle is a single table read.
+     *
+     * Example usage:
+     * @code
+     * ParticleCurve<vec4> color(vec4(1.0f, 0.8f, 0.2f, 1.0f));
+     * color.AddKey(1.0f, vec4(1.0f, 0.1f, 0.0f, 0.0f));  // Fade to transparent red
+     * @endcode
+     */
+    template<typename T>
+    class ParticleCurve
+    {
+    public:
+        static constexpr uint32 RESOLUTION = 64;
+
+        /**
+         * @brief Create a constant curve
+         */
+        explicit ParticleCurve(const T& value = T(1.0f))
+        {
+            m_Keys.push_back({ 0.0f, value });
+            Bake();
+        }
+
+        /**
+         * @brief Add a key and rebake the table
+         * @param time Normalized age (0.0 = birth, 1.0 = death)
+         * @param value Value at that age
+         */
+        void AddKey(float32 time, const T& value)
+        {
+            time = glm::clamp(time, 0.0f, 1.0f);
+            auto it = std::find_if(m_Keys.begin(), m_Keys.end(), [time](const Key& key) { return key.Time > time; });
+            m_Keys.insert(it, { time, value });
+            Bake();
+        }
+
+        /**
+         * @brief Remove all keys and set a constant value
+         */
+        void Reset(const T& value)
+        {
+            m_Keys.clear();
+            m_Keys.push_back({ 0.0f, value });
+            Bake();
+        }
+
+        /**
+         * @brief Look up the value at a normalized age (0.0 - 1.0)
+         */
+        const T& Evaluate(float32 time) const
+        {
+            uint32 index = static_cast<uint32>(time * (RESOLUTION - 1) + 0.5f);
+            return m_Table[index < RESOLUTION ? index : RESOLUTION - 1];
+        }
+
+    private:
+        struct Key
+        {
+            float32 Time;
+            T Value;
+        };
+
+        void Bake()
+        {
+            for (uint32 i = 0; i < RESOLUTION; ++i)
+            {
+                float32 time = static_cast<float32>(i) / (RESOLUTION - 1);
+
+                // Keys are sorted by time; hold the first/last value outside the key range
+                usize next = 0;
+                while (next < m_Keys.size() && m_Keys[next].Time < time)
+                {
+                    ++next;
+                }
+
+                if (next == 0)
+                {
+                    m_Table[i] = m_Keys.front().Value;
+                }
+                else if (next == m_Keys.size())
+                {
+                    m_Table[i] = m_Keys.back().Value;
+                }
+                else
+                {
+                    const Key& a = m_Keys[next - 1];
+                    const Key& b = m_Keys[next];
+                    float32 t = (time - a.Time) / std::max(b.Time - a.Time, 1e-6f);
+                    m_Table[i] = glm::mix(a.Value, b.Value, t);
+                }
+            }
+        }
+
+    private:
+        std::vector<Key> m_Keys;
+        std::array<T, RESOLUTION> m_Table;
+    };
+
+    // =========================================================================
+    // ParticleEmitterProps
+    // =========================================================================
+
+    /**
+     * @brief Emission and simulation parameters of a ParticleEmitter
+     *
+     * Variations are the half-range of a uniform random offset applied per
+     * particle at emission (e.g. Velocity = {0, 1}, VelocityVariation = {0.5, 0}
+     * gives x velocities in [-0.5, 0.5]).
+     */
+    struct ParticleEmitterProps
+    {
+        vec3 Position = vec3(0.0f);             // Spawn point (z is shared by all particles)
+        vec2 PositionVariation = vec2(0.0f);
+
+        vec2 Velocity = vec2(0.0f, 1.0f);
+        vec2 VelocityVariation = vec2(0.5f);
+        vec2 Acceleration = vec2(0.0f);         // Constant force, e.g. gravity
+
+        float32 AngularVelocity = 0.0f;         // Radians per second
+        float32 AngularVelocityVariation = 3.0f;
+
+        float32 LifeTime = 1.0f;                // Seconds
+        float32 LifeTimeVariation = 0.0f;
+
+        float32 Size = 0.1f;                    // World units, multiplied by SizeOverLife
+        float32 SizeVariation = 0.0f;
+
+        float32 EmitRate = 0.0f;                // Continuous emission in particles per second
+        uint32 MaxParticles = 10000;
+
+        ParticleCurve<vec4> ColorOverLife;
+        ParticleCurve<float32> SizeOverLife;
+
+        Texture2D* Texture = nullptr;           // nullptr = untextured quads
+        BlendMode Blend = BlendMode::Alpha;
+    };
+
+    // =========================================================================
+    // ParticleEmitter
+    // =========================================================================
+
+    /**
+     * @brief A pool of particles sharing one set of emission parameters
+     *
+     * Particles are stored as a structure of arrays so the integration step
+     * runs four particles at a time with SSE. Dead particles are removed by
+     * moving the last live particle into their slot, keeping the live range
+     * dense. Capacity is fixed at MaxParticles; emission beyond it is dropped.
+     */
+    class ParticleEmitter
+    {
+    public:
+        explicit ParticleEmitter(const ParticleEmitterProps& props);
+
+        // Non-copyable
+        ParticleEmitter(const ParticleEmitter&) = delete;
+        ParticleEmitter& operator=(const ParticleEmitter&) = delete;
+
+        /**
+         * @brief Spawn particles immediately (in addition to EmitRate)
+         */
+        void Emit(uint32 count);
+
+        /**
+         * @brief Advance the simulation and evaluate the over-life curves
+         * @param deltaTime Elapsed time in seconds
+         */
+        void Update(float32 deltaTime);
+
+        /**
+         * @brief Submit live particles to the Renderer2D batch
+         */
+        void Render() const;
+
+        /**
+         * @brief Emission parameters (MaxParticles can be lowered, but never above GetCapacity())
+         */
+        ParticleEmitterProps& GetProps() { return m_Props; }
+        const ParticleEmitterProps& GetProps() const { return m_Props; }
+
+        uint32 GetAliveCount() const { return m_AliveCount; }
+        uint32 GetCapacity() const { return m_Capacity; }
+
+        /**
+         * @brief Kill all particles
+         */
+        void Clear() { m_AliveCount = 0; }
+
+    private:
+        float32 RandomFloat();              // [0, 1)
+        float32 RandomRange(float32 halfRange) { return (RandomFloat() * 2.0f - 1.0f) * halfRange; }
+
+        void Integrate(float32 deltaTime);
+        void Kill(uint32 index);
+
+    private:
+        ParticleEmitterProps m_Props;
+        uint32 m_Capacity;                  // MaxParticles rounded up to the SIMD width
+        uint32 m_AliveCount = 0;
+        float32 m_EmitAccumulator = 0.0f;
+        uint32 m_RandomState;
+
+        // Simulation state (structure of arrays)
+        std::vector<float32> m_PositionX;
+        std::vector<float32> m_PositionY;
+        std::vector<float32> m_VelocityX;
+        std::vector<float32> m_VelocityY;
+        std::vector<float32> m_Rotation;
+        std::vector<float32> m_AngularVelocity;
+        std::vector<float32> m_Age;         // Normalized: 0.0 at birth, >= 1.0 when dead
+        std::vector<float32> m_AgeRate;     // 1 / lifetime
+        std::vector<float32> m_BaseSize;
+
+        // Render state, evaluated from the curves in Update()
+        std::vector<float32> m_Size;
+        std::vector<vec4> m_Color;
+    };
+
+    // =========================================================================
+    // ParticleSystem
+    // =========================================================================
+
+    /**
+     * @brief Owns emitters and updates them in parallel
+     *
+     * Emitters are independent, so OnUpdate() simulates them concurrently.
+     * OnRender() must run on the render thread between Renderer2D::BeginScene()
+     * and EndScene(); emitters are submitted in creation order.
+     *
+     * Example usage:
+     * @code
+     * ParticleSystem particles;
+     * ParticleEmitterProps props;
+     * props.EmitRate = 500.0f;
+     * ParticleEmitter* smoke = particles.CreateEmitter(props);
+     *
+     * // In game loop:
+     * particles.OnUpdate(deltaTime);
+     * Renderer2D::BeginScene(camera);
+     * particles.OnRender();
+     * Renderer2D::EndScene();
+     * @endcode
+     */
+    class ParticleSystem
+    {
+    public:
+        ParticleSystem() = default;
+        ~ParticleSystem();
+
+        // Non-copyable
+        ParticleSystem(const ParticleSystem&) = delete;
+        ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+        /**
+         * @brief Create an emitter owned by the system
+         */
+        ParticleEmitter* CreateEmitter(const ParticleEmitterProps& props);
+
+        /**
+         * @brief Destroy an emitter and its particles
+         */
+        void DestroyEmitter(ParticleEmitter* emitter);
+
+        /**
+         * @brief Simulate all emitters (in parallel when there are several)
+         * @param deltaTime Elapsed time in seconds
+         */
+        void OnUpdate(float32 deltaTime);
+
+        /**
+         * @brief Submit all emitters to the Renderer2D batch
+         */
+        void OnRender() const;
+
+        uint32 GetAliveCount() const;
+        usize GetEmitterCount() const { return m_Emitters.size(); }
+
+    private:
+        std::vector<std::unique_ptr<ParticleEmitter>> m_Emitters;
+    };
+
+} // namespace NanSu
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "Core/Types.h"
+
+namespace NanSu
+{
+    // =========================================================================
+    // Pipeline State Enums
+    // =========================================================================
+
+    /**
+     * @brief Color blending modes for the output merger
+     */
+    enum class BlendMode : uint8
+    {
+        None = 0,           // Opaque, no blending
+        Alpha,              // src * srcAlpha + dst * (1 - srcAlpha)
+        Additive,           // src * srcAlpha + dst (glow, fire, light sprites)
+        Multiply,           // lerp(dst, src * dst, srcAlpha); shader outputs premultiplied color (shadows, tinting)
+        Premultiplied       // src + dst * (1 - srcAlpha)
+    };
+
+    /**
+     * @brief Comparison functions for depth testing
+     */
+    enum class CompareFunc : uint8
+    {
+        Never = 0,
+        Less,
+        Equal,
+        LessEqual,
+        Greater,
+        NotEqual,
+        GreaterEqual,
+        Always
+    };
+
+    /**
+     * @brief Triangle faces culled by the rasterizer
+     */
+    enum class CullMode : uint8
+    {
+        None = 0,
+        Front,
+        Back
+    };
+
+    /**
+     * @brief Texture filtering modes
+     */
+    enum class SamplerFilter : uint8
+    {
+        Point = 0,          // Nearest texel (pixel art)
+        Linear,             // Trilinear
+        Anisotropic
+    };
+
+    /**
+     * @brief Texture addressing modes outside the [0, 1] range
+     */
+    enum class SamplerWrap : uint8
+    {
+        Repeat = 0,
+        Clamp,
+        Mirror
+    };
+
+    // =========================================================================
+    // PipelineState
+    // =========================================================================
+
+    /**
+     * @brief Backend-agnostic description of the fixed-function pipeline state
+     *
+     * Backends turn each part of the description into native state objects
+     * through a cache keyed by the packed description, so identical states
+     * are created once and shared. Binding a state equal to the one already
+     * bound is skipped by the backend.
+     *
+     * Example usage:
+     * @code
+     * PipelineState state;
+     * state.Blend = BlendMode::Additive;
+     * state.Filter = SamplerFilter::Point;
+     * RenderCommand::SetPipelineState(state);
+     * @endcode
+     */
+    struct PipelineState
+    {
+        // Output merger
+        BlendMode Blend = BlendMode::Alpha;
+
+        // Depth
+        bool DepthTest = false;
+        bool DepthWrite = false;
+        CompareFunc DepthCompare = CompareFunc::LessEqual;
+
+        // Rasterizer
+        CullMode Cull = CullMode::None;
+
+        // Sampler bound to slot s0
+        SamplerFilter Filter = SamplerFilter::Linear;
+        SamplerWrap Wrap = SamplerWrap::Repeat;
+
+        /**
+         * @brief Key of the blend part of the state
+         */
+        uint32 GetBlendKey() const { return static_cast<uint32>(Blend); }
+
+        /**
+         * @brief Key of the depth-stencil part of the state
+         */
+        uint32 GetDepthKey() const
+        {
+            return (DepthTest ? 1u : 0u) | (DepthWrite ? 2u : 0u) | (static_cast<uint32>(DepthCompare) << 2);
+        }
+
+        /**
+         * @brief Key of the rasterizer part of the state
+         */
+        uint32 GetRasterizerKey() const { return static_cast<uint32>(Cull); }
+
+        /**
+         * @brief Key of the sampler part of the state
+         */
+        uint32 GetSamplerKey() const
+        {
+            return static_cast<uint32>(Filter) | (static_cast<uint32>(Wrap) << 4);
+        }
+
+        /**
+         * @brief Collision-free hash of the whole state (every field is packed)
+         */
+        uint32 GetHash() const
+        {
+            return GetBlendKey() | (GetDepthKey() << 8) | (GetRasterizerKey() << 16) | (GetSamplerKey() << 24);
+        }
+
+        bool operator==(const PipelineState& other) const { return GetHash() == other.GetHash(); }
+        bool operator!=(const PipelineState& other) const { return !(*this == other); }
+    };
+
+}
@@ -80,6 +80,15 @@ namespace NanSu
             s_RendererAPI->BindRenderTarget();
         }
 
+        /**
+         * @brief Set the blend, depth, rasterizer and sampler state
+         * @param state The pipeline state description (redundant binds are skipped)
+         */
+        static void SetPipelineState(const PipelineState& state)
+        {
+            s_RendererAPI->SetPipelineState(state);
+        }
+
         /**
          * @brief Draw indexed geometry
          * @param indexBuffer The index buffer containing indices
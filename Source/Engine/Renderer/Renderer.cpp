@@ -2,15 +2,15 @@
 #include "Renderer/Renderer.h"
 #include "Renderer/Shader.h"
 #include "Renderer/Buffer.h"
-#include "Renderer/ConstantBuffer.h"
+#include "Renderer/MaterialParams.h"
 #include "Renderer/Texture.h"
 #include "Renderer/OrthographicCamera.h"
 
 namespace NanSu
 {
     // Static member definitions
-    Renderer::SceneData Renderer::s_SceneData;
-    ConstantBuffer* Renderer::s_SceneConstantBuffer = nullptr;
+    mat4 Renderer::s_ViewProjectionMatrix = mat4(1.0f);
+    MaterialParams* Renderer::s_SceneParams = nullptr;
     Texture2D* Renderer::s_WhiteTexture = nullptr;
 
     void Renderer::Init()
@@ -18,9 +18,6 @@ namespace NanSu
         NS_ENGINE_INFO("Initializing Renderer");
         RenderCommand::Init();
 
-        // Create scene constant buffer for camera data (slot b0)
-        s_SceneConstantBuffer = ConstantBuffer::Create(sizeof(SceneData));
-
         // Create 1x1 white fallback texture
         s_WhiteTexture = Texture2D::Create(1, 1);
         uint32 whitePixel = 0xFFFFFFFF;  // RGBA: white, fully opaque
@@ -36,8 +33,8 @@ namespace NanSu
         delete s_WhiteTexture;
         s_WhiteTexture = nullptr;
 
-        delete s_SceneConstantBuffer;
-        s_SceneConstantBuffer = nullptr;
+        delete s_SceneParams;
+        s_SceneParams = nullptr;
 
         RenderCommand::Shutdown();
         NS_ENGINE_INFO("Renderer shut down");
@@ -45,12 +42,8 @@ namespace NanSu
 
     void Renderer::BeginScene(const OrthographicCamera& camera)
     {
-        // Store scene data (transpose for HLSL row-major layout)
-        s_SceneData.ViewProjectionMatrix = glm::transpose(camera.GetViewProjectionMatrix());
-
-        // Upload to GPU
-        s_SceneConstantBuffer->SetData(&s_SceneData, sizeof(SceneData));
-        s_SceneConstantBuffer->Bind(0);  // Bind to slot b0
+        // Uploaded per shader layout in Submit()
+        s_ViewProjectionMatrix = camera.GetViewProjectionMatrix();
     }
 
     void Renderer::EndScene()
@@ -63,6 +56,7 @@ namespace NanSu
                           IndexBuffer* indexBuffer)
     {
         shader->Bind();
+        BindSceneParams(shader);
         s_WhiteTexture->Bind(0);  // Use white fallback texture
         vertexBuffer->Bind();
         indexBuffer->Bind();
@@ -75,6 +69,7 @@ namespace NanSu
                           Texture2D* texture)
     {
         shader->Bind();
+        BindSceneParams(shader);
         if (texture)
         {
             texture->Bind(0);  // Bind user texture to slot t0
@@ -88,6 +83,25 @@ namespace NanSu
         RenderCommand::DrawIndexed(indexBuffer);
     }
 
+    void Renderer::BindSceneParams(const Shader* shader)
+    {
+        const ShaderUniformBuffer* sceneLayout = shader->FindUniformBuffer("SceneData");
+        if (!sceneLayout)
+        {
+            return;  // Shader does not use scene data
+        }
+
+        if (!s_SceneParams || !s_SceneParams->GetLayout().IsLayoutCompatible(*sceneLayout))
+        {
+            delete s_SceneParams;
+            s_SceneParams = new MaterialParams(*sceneLayout);
+        }
+
+        // Unchanged values are not re-uploaded
+        s_SceneParams->Set("u_ViewProjection", s_ViewProjectionMatrix);
+        s_SceneParams->Bind();
+    }
+
     void Renderer::OnWindowResize(uint32 width, uint32 height)
     {
         RenderCommand::SetViewport(0, 0, width, height);
@@ -10,7 +10,7 @@ namespace NanSu
     class Shader;
     class VertexBuffer;
     class IndexBuffer;
-    class ConstantBuffer;
+    class MaterialParams;
     class OrthographicCamera;
     class Texture2D;
 
@@ -50,7 +50,8 @@ namespace NanSu
          * @brief Begin a new scene for rendering with the given camera
          * @param camera The camera providing view/projection matrices
          *
-         * Uploads camera data to GPU constant buffer at slot b0
+         * Camera data is written into the "SceneData" constant buffer of each
+         * submitted shader, using the layout reported by shader reflection
          */
         static void BeginScene(const OrthographicCamera& camera);
 
@@ -95,15 +96,13 @@ namespace NanSu
 
     private:
         /**
-         * @brief Scene data uploaded to GPU per-frame
+         * @brief Write the scene data into the shader's "SceneData" cbuffer and bind it
          */
-        struct SceneData
-        {
-            mat4 ViewProjectionMatrix;
-        };
+        static void BindSceneParams(const Shader* shader);
 
-        static SceneData s_SceneData;
-        static ConstantBuffer* s_SceneConstantBuffer;
+    private:
+        static mat4 s_ViewProjectionMatrix;
+        static MaterialParams* s_SceneParams;  // Recreated when a shader with a different layout is submitted
         static Texture2D* s_WhiteTexture;  // 1x1 white fallback texture
     };
 
@@ -2,8 +2,9 @@
 #include "Renderer/Renderer2D.h"
 #include "Renderer/Shader.h"
 #include "Renderer/Buffer.h"
-#include "Renderer/ConstantBuffer.h"
+#include "Renderer/MaterialParams.h"
 #include "Renderer/Texture.h"
+#include "Renderer/SubTexture2D.h"
 #include "Renderer/RenderCommand.h"
 #include "Renderer/OrthographicCamera.h"
 
@@ -15,11 +16,11 @@ namespace NanSu
 
     struct Renderer2DData
     {
-        // Scene data (uploaded to GPU per-frame)
-        struct SceneData
-        {
-            mat4 ViewProjectionMatrix;
-        };
+        // Batch limits
+        static constexpr uint32 MaxQuads = 10000;
+        static constexpr uint32 MaxVertices = MaxQuads * 4;
+        static constexpr uint32 MaxIndices = MaxQuads * 6;
+        static constexpr uint32 MaxTextureSlots = 16;      // Must match u_Textures in Renderer2D.hlsl
 
         // Quad vertex structure (44 bytes per vertex)
         struct QuadVertex
@@ -27,31 +28,151 @@ namespace NanSu
             vec3 Position;          // 12 bytes
             vec4 Color;             // 16 bytes
             vec2 TexCoord;          // 8 bytes
-            float32 TexIndex;       // 4 bytes (for future batching)
+            float32 TexIndex;       // 4 bytes (texture slot in the batch)
             float32 TilingFactor;   // 4 bytes
         };
 
+        // Glyph vertex structure (40 bytes per vertex), sampled as a distance field
+        struct TextVertex
+        {
+            vec3 Position;          // 12 bytes
+            vec4 Color;             // 16 bytes
+            vec2 TexCoord;          // 8 bytes
+            float32 TexIndex;       // 4 bytes (glyph atlas page slot in the batch)
+        };
+
+        // Circle vertex structure (48 bytes per vertex), shaped in the pixel shader
+        struct CircleVertex
+        {
+            vec3 WorldPosition;     // 12 bytes
+            vec3 LocalPosition;     // 12 bytes (-1..1 across the bounding quad)
+            vec4 Color;             // 16 bytes
+            float32 Thickness;      // 4 bytes (1 = filled, towards 0 = thin ring)
+            float32 Fade;           // 4 bytes (edge softness)
+        };
+
+        // Line vertex structure (28 bytes per vertex), lines are expanded to quads
+        struct LineVertex
+        {
+            vec3 Position;          // 12 bytes
+            vec4 Color;             // 16 bytes
+        };
+
         // GPU Resources
         Shader* QuadShader = nullptr;
-        VertexBuffer* QuadVertexBuffer = nullptr;   // Dynamic buffer
-        IndexBuffer* QuadIndexBuffer = nullptr;     // Static buffer
-        ConstantBuffer* SceneConstantBuffer = nullptr;
+        VertexBuffer* QuadVertexBuffer = nullptr;   // Dynamic buffer (MaxVertices)
+        IndexBuffer* QuadIndexBuffer = nullptr;     // Static buffer (MaxIndices)
+        MaterialParams* SceneParams = nullptr;       // Reflected "SceneData" cbuffer
         Texture2D* WhiteTexture = nullptr;
 
-        // CPU vertex data for immediate mode (single quad = 4 vertices)
-        QuadVertex QuadVertexData[4];
+        Shader* TextShader = nullptr;               // SDF glyph shader (same SceneData layout)
+        VertexBuffer* TextVertexBuffer = nullptr;   // Dynamic buffer (MaxVertices), shares QuadIndexBuffer
+
+        Shader* CircleShader = nullptr;
+        VertexBuffer* CircleVertexBuffer = nullptr; // Dynamic buffer (MaxVertices), shares QuadIndexBuffer
+
+        Shader* LineShader = nullptr;
+        VertexBuffer* LineVertexBuffer = nullptr;   // Dynamic buffer (MaxVertices), shares QuadIndexBuffer
+
+        // CPU vertex data for the current batch
+        QuadVertex* QuadVertexBufferBase = nullptr;
+        QuadVertex* QuadVertexBufferPtr = nullptr;
+        uint32 QuadIndexCount = 0;
+
+        // Textures referenced by the current batch (slot 0 = white texture)
+        Texture2D* TextureSlots[MaxTextureSlots] = {};
+        uint32 TextureSlotIndex = 1;
+
+        // CPU vertex data and atlas pages of the current text batch
+        TextVertex* TextVertexBufferBase = nullptr;
+        TextVertex* TextVertexBufferPtr = nullptr;
+        uint32 TextIndexCount = 0;
+        Texture2D* TextTextureSlots[MaxTextureSlots] = {};
+        uint32 TextTextureSlotIndex = 0;
+
+        // CPU vertex data of the current circle and line batches
+        CircleVertex* CircleVertexBufferBase = nullptr;
+        CircleVertex* CircleVertexBufferPtr = nullptr;
+        uint32 CircleIndexCount = 0;
+
+        LineVertex* LineVertexBufferBase = nullptr;
+        LineVertex* LineVertexBufferPtr = nullptr;
+        uint32 LineIndexCount = 0;
 
         // Base quad vertex positions (centered at origin, unit size)
         // Used for transform calculations
         vec4 QuadVertexPositions[4];
 
-        // Scene state
-        SceneData CurrentSceneData;
+        // Render state of the current batch
+        PipelineState BatchState;
+
+        Renderer2D::Statistics Stats;
     };
 
     // Static data instance
     static Renderer2DData s_Data;
 
+    namespace
+    {
+        void StartBatch()
+        {
+            s_Data.QuadIndexCount = 0;
+            s_Data.QuadVertexBufferPtr = s_Data.QuadVertexBufferBase;
+            s_Data.TextureSlotIndex = 1;
+
+            s_Data.TextIndexCount = 0;
+            s_Data.TextVertexBufferPtr = s_Data.TextVertexBufferBase;
+            s_Data.TextTextureSlotIndex = 0;
+
+            s_Data.CircleIndexCount = 0;
+            s_Data.CircleVertexBufferPtr = s_Data.CircleVertexBufferBase;
+
+            s_Data.LineIndexCount = 0;
+            s_Data.LineVertexBufferPtr = s_Data.LineVertexBufferBase;
+        }
+
+        /**
+         * @brief Upload one primitive stream and draw it with the shared quad index buffer
+         */
+        template<typename TVertex>
+        void SubmitStream(Shader* shader, VertexBuffer* vertexBuffer,
+                          const TVertex* base, const TVertex* end, uint32 indexCount)
+        {
+            uint32 dataSize = static_cast<uint32>(
+                reinterpret_cast<const byte*>(end) - reinterpret_cast<const byte*>(base));
+            vertexBuffer->SetData(base, dataSize);
+
+            shader->Bind();
+            vertexBuffer->Bind();
+
+            RenderCommand::DrawIndexed(s_Data.QuadIndexBuffer, indexCount);
+            s_Data.Stats.DrawCalls++;
+        }
+
+        /**
+         * @brief Find a texture among the batch slots, or assign it the next free one
+         * @return The slot index, or -1 if all slots are taken
+         */
+        int32 FindOrAddTextureSlot(Texture2D** slots, uint32& slotCount, uint32 firstSlot, Texture2D* texture)
+        {
+            for (uint32 i = firstSlot; i < slotCount; i++)
+            {
+                if (slots[i] == texture)
+                {
+                    return static_cast<int32>(i);
+                }
+            }
+
+            if (slotCount >= Renderer2DData::MaxTextureSlots)
+            {
+                return -1;
+            }
+
+            slots[slotCount] = texture;
+            return static_cast<int32>(slotCount++);
+        }
+    }
+
     // =========================================================================
     // Lifecycle
     // =========================================================================
@@ -70,9 +191,9 @@ namespace NanSu
         // Create shader (path relative to executable in Binaries/{Config}/Editor/)
         s_Data.QuadShader = Shader::Create("../../Assets/Shaders/Renderer2D.hlsl");
 
-        // Create dynamic vertex buffer (4 vertices per quad)
+        // Create dynamic vertex buffer (one full batch)
         s_Data.QuadVertexBuffer = VertexBuffer::CreateDynamic(
-            sizeof(Renderer2DData::QuadVertex) * 4);
+            sizeof(Renderer2DData::QuadVertex) * Renderer2DData::MaxVertices);
 
         // Set buffer layout
         BufferLayout layout = {
@@ -85,19 +206,80 @@ namespace NanSu
         s_Data.QuadVertexBuffer->SetLayout(layout);
         s_Data.QuadShader->SetInputLayout(layout);
 
-        // Create index buffer (static pattern for a single quad - 2 triangles)
-        uint32 indices[] = { 0, 2, 1, 0, 3, 2 };
-        s_Data.QuadIndexBuffer = IndexBuffer::Create(indices, 6);
+        s_Data.QuadVertexBufferBase = new Renderer2DData::QuadVertex[Renderer2DData::MaxVertices];
+
+        // Text batch: separate shader and vertex stream, same index pattern as quads
+        s_Data.TextShader = Shader::Create("../../Assets/Shaders/Renderer2DText.hlsl");
+        s_Data.TextVertexBuffer = VertexBuffer::CreateDynamic(
+            sizeof(Renderer2DData::TextVertex) * Renderer2DData::MaxVertices);
+
+        BufferLayout textLayout = {
+            { ShaderDataType::Float3, "Position" },
+            { ShaderDataType::Float4, "Color" },
+            { ShaderDataType::Float2, "TexCoord" },
+            { ShaderDataType::Float,  "TexIndex" }
+        };
+        s_Data.TextVertexBuffer->SetLayout(textLayout);
+        s_Data.TextShader->SetInputLayout(textLayout);
 
-        // Create scene constant buffer (slot b0)
-        s_Data.SceneConstantBuffer = ConstantBuffer::Create(
-            sizeof(Renderer2DData::SceneData));
+        s_Data.TextVertexBufferBase = new Renderer2DData::TextVertex[Renderer2DData::MaxVertices];
+
+        // Circle batch: quads whose shape is evaluated per pixel
+        s_Data.CircleShader = Shader::Create("../../Assets/Shaders/Renderer2DCircle.hlsl");
+        s_Data.CircleVertexBuffer = VertexBuffer::CreateDynamic(
+            sizeof(Renderer2DData::CircleVertex) * Renderer2DData::MaxVertices);
+
+        BufferLayout circleLayout = {
+            { ShaderDataType::Float3, "WorldPosition" },
+            { ShaderDataType::Float3, "LocalPosition" },
+            { ShaderDataType::Float4, "Color" },
+            { ShaderDataType::Float,  "Thickness" },
+            { ShaderDataType::Float,  "Fade" }
+        };
+        s_Data.CircleVertexBuffer->SetLayout(circleLayout);
+        s_Data.CircleShader->SetInputLayout(circleLayout);
+
+        s_Data.CircleVertexBufferBase = new Renderer2DData::CircleVertex[Renderer2DData::MaxVertices];
+
+        // Line batch: each segment becomes a thin quad
+        s_Data.LineShader = Shader::Create("../../Assets/Shaders/Renderer2DLine.hlsl");
+        s_Data.LineVertexBuffer = VertexBuffer::CreateDynamic(
+            sizeof(Renderer2DData::LineVertex) * Renderer2DData::MaxVertices);
+
+        BufferLayout lineLayout = {
+            { ShaderDataType::Float3, "Position" },
+            { ShaderDataType::Float4, "Color" }
+        };
+        s_Data.LineVertexBuffer->SetLayout(lineLayout);
+        s_Data.LineShader->SetInputLayout(lineLayout);
+
+        s_Data.LineVertexBufferBase = new Renderer2DData::LineVertex[Renderer2DData::MaxVertices];
+
+        // Create index buffer (static pattern: 2 triangles per quad, repeated for the whole batch)
+        uint32* quadIndices = new uint32[Renderer2DData::MaxIndices];
+        uint32 offset = 0;
+        for (uint32 i = 0; i < Renderer2DData::MaxIndices; i += 6)
+        {
+            quadIndices[i + 0] = offset + 0;
+            quadIndices[i + 1] = offset + 2;
+            quadIndices[i + 2] = offset + 1;
+
+            quadIndices[i + 3] = offset + 0;
+            quadIndices[i + 4] = offset + 3;
+            quadIndices[i + 5] = offset + 2;
+
+            offset += 4;
+        }
+        s_Data.QuadIndexBuffer = IndexBuffer::Create(quadIndices, Renderer2DData::MaxIndices);
+        delete[] quadIndices;
 
         // Create 1x1 white texture for color-only rendering
         s_Data.WhiteTexture = Texture2D::Create(1, 1);
         uint32 whitePixel = 0xFFFFFFFF;  // RGBA: white, fully opaque
         s_Data.WhiteTexture->SetData(&whitePixel, sizeof(uint32));
 
+        s_Data.TextureSlots[0] = s_Data.WhiteTexture;
+
         NS_ENGINE_INFO("Renderer2D initialized");
     }
 
@@ -105,11 +287,46 @@ namespace NanSu
     {
         NS_ENGINE_INFO("Shutting down Renderer2D");
 
+        delete[] s_Data.QuadVertexBufferBase;
+        s_Data.QuadVertexBufferBase = nullptr;
+        s_Data.QuadVertexBufferPtr = nullptr;
+
+        delete[] s_Data.TextVertexBufferBase;
+        s_Data.TextVertexBufferBase = nullptr;
+        s_Data.TextVertexBufferPtr = nullptr;
+
+        delete s_Data.TextVertexBuffer;
+        s_Data.TextVertexBuffer = nullptr;
+
+        delete s_Data.TextShader;
+        s_Data.TextShader = nullptr;
+
+        delete[] s_Data.CircleVertexBufferBase;
+        s_Data.CircleVertexBufferBase = nullptr;
+        s_Data.CircleVertexBufferPtr = nullptr;
+
+        delete s_Data.CircleVertexBuffer;
+        s_Data.CircleVertexBuffer = nullptr;
+
+        delete s_Data.CircleShader;
+        s_Data.CircleShader = nullptr;
+
+        delete[] s_Data.LineVertexBufferBase;
+        s_Data.LineVertexBufferBase = nullptr;
+        s_Data.LineVertexBufferPtr = nullptr;
+
+        delete s_Data.LineVertexBuffer;
+        s_Data.LineVertexBuffer = nullptr;
+
+        delete s_Data.LineShader;
+        s_Data.LineShader = nullptr;
+
         delete s_Data.WhiteTexture;
         s_Data.WhiteTexture = nullptr;
+        s_Data.TextureSlots[0] = nullptr;
 
-        delete s_Data.SceneConstantBuffer;
-        s_Data.SceneConstantBuffer = nullptr;
+        delete s_Data.SceneParams;
+        s_Data.SceneParams = nullptr;
 
         delete s_Data.QuadIndexBuffer;
         s_Data.QuadIndexBuffer = nullptr;
@@ -129,19 +346,103 @@ namespace NanSu
 
     void Renderer2D::BeginScene(const OrthographicCamera& camera)
     {
-        // Store scene data (transpose for HLSL row-major layout)
-        s_Data.CurrentSceneData.ViewProjectionMatrix =
-            glm::transpose(camera.GetViewProjectionMatrix());
+        // (Re)create the scene parameters when the shader layout changed (first use or hot reload)
+        const ShaderUniformBuffer* sceneLayout = s_Data.QuadShader->FindUniformBuffer("SceneData");
+        NS_ENGINE_ASSERT(sceneLayout, "Renderer2D shader has no SceneData constant buffer");
+        if (!s_Data.SceneParams || !s_Data.SceneParams->GetLayout().IsLayoutCompatible(*sceneLayout))
+        {
+            delete s_Data.SceneParams;
+            s_Data.SceneParams = new MaterialParams(*sceneLayout);
+        }
+
+        // Only uploaded when the camera moved
+        s_Data.SceneParams->Set("u_ViewProjection", camera.GetViewProjectionMatrix());
+        s_Data.SceneParams->Bind();
 
-        // Upload to GPU
-        s_Data.SceneConstantBuffer->SetData(&s_Data.CurrentSceneData,
-            sizeof(Renderer2DData::SceneData));
-        s_Data.SceneConstantBuffer->Bind(0);  // Bind to slot b0
+        s_Data.BatchState = PipelineState{};
+        StartBatch();
     }
 
     void Renderer2D::EndScene()
     {
-        // Future: Flush batched draw calls if implementing batching
+        Flush();
+    }
+
+    void Renderer2D::Flush()
+    {
+        if (s_Data.QuadIndexCount == 0 && s_Data.CircleIndexCount == 0 &&
+            s_Data.LineIndexCount == 0 && s_Data.TextIndexCount == 0)
+        {
+            return;  // Nothing to draw
+        }
+
+        // Bind resources (state binds that change nothing are filtered by the backend)
+        RenderCommand::SetPipelineState(s_Data.BatchState);
+
+        // Multiply blending expects premultiplied color from the 2D shaders
+        // (uploaded only when the value changes between batches)
+        s_Data.SceneParams->Set("u_PremultiplyAlpha", s_Data.BatchState.Blend == BlendMode::Multiply ? 1.0f : 0.0f);
+        s_Data.SceneParams->Bind();
+        s_Data.QuadIndexBuffer->Bind();
+
+        // One draw per primitive type: quads, circles, lines, then text on top
+        if (s_Data.QuadIndexCount > 0)
+        {
+            for (uint32 i = 0; i < s_Data.TextureSlotIndex; i++)
+            {
+                s_Data.TextureSlots[i]->Bind(i);
+            }
+
+            SubmitStream(s_Data.QuadShader, s_Data.QuadVertexBuffer,
+                         s_Data.QuadVertexBufferBase, s_Data.QuadVertexBufferPtr, s_Data.QuadIndexCount);
+        }
+
+        if (s_Data.CircleIndexCount > 0)
+        {
+            SubmitStream(s_Data.CircleShader, s_Data.CircleVertexBuffer,
+                         s_Data.CircleVertexBufferBase, s_Data.CircleVertexBufferPtr, s_Data.CircleIndexCount);
+        }
+
+        if (s_Data.LineIndexCount > 0)
+        {
+            SubmitStream(s_Data.LineShader, s_Data.LineVertexBuffer,
+                         s_Data.LineVertexBufferBase, s_Data.LineVertexBufferPtr, s_Data.LineIndexCount);
+        }
+
+        if (s_Data.TextIndexCount > 0)
+        {
+            for (uint32 i = 0; i < s_Data.TextTextureSlotIndex; i++)
+            {
+                s_Data.TextTextureSlots[i]->Bind(i);
+            }
+
+            SubmitStream(s_Data.TextShader, s_Data.TextVertexBuffer,
+                         s_Data.TextVertexBufferBase, s_Data.TextVertexBufferPtr, s_Data.TextIndexCount);
+        }
+
+        // The batch has been submitted; further quads start a new one
+        StartBatch();
+    }
+
+    // =========================================================================
+    // Render State
+    // =========================================================================
+
+    void Renderer2D::SetBlendMode(BlendMode mode)
+    {
+        if (s_Data.BatchState.Blend == mode)
+        {
+            return;
+        }
+
+        // Quads already in the batch keep the mode they were submitted with
+        Flush();
+        s_Data.BatchState.Blend = mode;
+    }
+
+    BlendMode Renderer2D::GetBlendMode()
+    {
+        return s_Data.BatchState.Blend;
     }
 
     // =========================================================================
@@ -158,89 +459,56 @@ namespace NanSu
             { 0.0f, 0.0f }   // Top-left
         };
 
-        void DrawQuadInternal(const vec3& position, const vec2& size,
-                              Texture2D* texture, const vec4& color,
-                              float32 tilingFactor)
+        mat4 MakeTransform(const vec3& position, const vec2& size)
         {
-            // Calculate transform matrix (translation + scale, no rotation)
-            mat4 transform = glm::translate(mat4(1.0f), position)
-                           * glm::scale(mat4(1.0f), { size.x, size.y, 1.0f });
-
-            // Set up vertex data
-            for (uint32 i = 0; i < 4; i++)
-            {
-                vec4 worldPos = transform * s_Data.QuadVertexPositions[i];
-                s_Data.QuadVertexData[i].Position = vec3(worldPos);
-                s_Data.QuadVertexData[i].Color = color;
-                s_Data.QuadVertexData[i].TexCoord = s_TexCoords[i];
-                s_Data.QuadVertexData[i].TexIndex = 0.0f;  // Single texture for now
-                s_Data.QuadVertexData[i].TilingFactor = tilingFactor;
-            }
-
-            // Upload vertex data to GPU
-            s_Data.QuadVertexBuffer->SetData(s_Data.QuadVertexData,
-                sizeof(Renderer2DData::QuadVertex) * 4);
-
-            // Bind resources
-            s_Data.QuadShader->Bind();
-
-            if (texture)
-            {
-                texture->Bind(0);
-            }
-            else
-            {
-                s_Data.WhiteTexture->Bind(0);
-            }
-
-            s_Data.QuadVertexBuffer->Bind();
-            s_Data.QuadIndexBuffer->Bind();
-
-            // Draw
-            RenderCommand::DrawIndexed(s_Data.QuadIndexBuffer, 6);
+            // Translation + scale, no rotation
+            return glm::translate(mat4(1.0f), position)
+                 * glm::scale(mat4(1.0f), { size.x, size.y, 1.0f });
         }
 
-        void DrawRotatedQuadInternal(const vec3& position, const vec2& size,
-                                     float32 rotation, Texture2D* texture,
-                                     const vec4& color, float32 tilingFactor)
+        mat4 MakeTransform(const vec3& position, const vec2& size, float32 rotation)
         {
-            // Calculate transform matrix with rotation (TRS order)
-            mat4 transform = glm::translate(mat4(1.0f), position)
-                           * glm::rotate(mat4(1.0f), rotation, { 0.0f, 0.0f, 1.0f })
-                           * glm::scale(mat4(1.0f), { size.x, size.y, 1.0f });
+            // TRS order
+            return glm::translate(mat4(1.0f), position)
+                 * glm::rotate(mat4(1.0f), rotation, { 0.0f, 0.0f, 1.0f })
+                 * glm::scale(mat4(1.0f), { size.x, size.y, 1.0f });
+        }
 
-            // Set up vertex data
-            for (uint32 i = 0; i < 4; i++)
+        void DrawQuadInternal(const mat4& transform, Texture2D* texture, const vec2* texCoords,
+                              const vec4& color, float32 tilingFactor)
+        {
+            if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
             {
-                vec4 worldPos = transform * s_Data.QuadVertexPositions[i];
-                s_Data.QuadVertexData[i].Position = vec3(worldPos);
-                s_Data.QuadVertexData[i].Color = color;
-                s_Data.QuadVertexData[i].TexCoord = s_TexCoords[i];
-                s_Data.QuadVertexData[i].TexIndex = 0.0f;
-                s_Data.QuadVertexData[i].TilingFactor = tilingFactor;
+                Renderer2D::Flush();
             }
 
-            // Upload vertex data to GPU
-            s_Data.QuadVertexBuffer->SetData(s_Data.QuadVertexData,
-                sizeof(Renderer2DData::QuadVertex) * 4);
-
-            // Bind resources
-            s_Data.QuadShader->Bind();
-
+            // Find the texture in the current batch, or assign it the next free slot
+            float32 textureIndex = 0.0f;  // White texture
             if (texture)
             {
-                texture->Bind(0);
+                int32 slot = FindOrAddTextureSlot(s_Data.TextureSlots, s_Data.TextureSlotIndex, 1, texture);
+                if (slot < 0)
+                {
+                    Renderer2D::Flush();
+                    slot = FindOrAddTextureSlot(s_Data.TextureSlots, s_Data.TextureSlotIndex, 1, texture);
+                }
+
+                textureIndex = static_cast<float32>(slot);
             }
-            else
+
+            // Set up vertex data
+            for (uint32 i = 0; i < 4; i++)
             {
-                s_Data.WhiteTexture->Bind(0);
+                s_Data.QuadVertexBufferPtr->Position = vec3(transform * s_Data.QuadVertexPositions[i]);
+                s_Data.QuadVertexBufferPtr->Color = color;
+                s_Data.QuadVertexBufferPtr->TexCoord = texCoords[i];
+                s_Data.QuadVertexBufferPtr->TexIndex = textureIndex;
+                s_Data.QuadVertexBufferPtr->TilingFactor = tilingFactor;
+                s_Data.QuadVertexBufferPtr++;
             }
 
-            s_Data.QuadVertexBuffer->Bind();
-            s_Data.QuadIndexBuffer->Bind();
-
-            // Draw
-            RenderCommand::DrawIndexed(s_Data.QuadIndexBuffer, 6);
+            s_Data.QuadIndexCount += 6;
+            s_Data.Stats.QuadCount++;
         }
     }
 
@@ -255,7 +523,7 @@ namespace NanSu
 
     void Renderer2D::DrawQuad(const vec3& position, const vec2& size, const vec4& color)
     {
-        DrawQuadInternal(position, size, nullptr, color, 1.0f);
+        DrawQuadInternal(MakeTransform(position, size), nullptr, s_TexCoords, color, 1.0f);
     }
 
     // =========================================================================
@@ -272,7 +540,7 @@ namespace NanSu
                               float32 tilingFactor)
     {
         constexpr vec4 white(1.0f, 1.0f, 1.0f, 1.0f);
-        DrawQuadInternal(position, size, texture, white, tilingFactor);
+        DrawQuadInternal(MakeTransform(position, size), texture, s_TexCoords, white, tilingFactor);
     }
 
     // =========================================================================
@@ -288,7 +556,38 @@ namespace NanSu
     void Renderer2D::DrawQuad(const vec3& position, const vec2& size, Texture2D* texture,
                               const vec4& tintColor, float32 tilingFactor)
     {
-        DrawQuadInternal(position, size, texture, tintColor, tilingFactor);
+        DrawQuadInternal(MakeTransform(position, size), texture, s_TexCoords, tintColor, tilingFactor);
+    }
+
+    // =========================================================================
+    // Draw Primitives - Sub-Texture
+    // =========================================================================
+
+    void Renderer2D::DrawQuad(const vec2& position, const vec2& size, const SubTexture2D& subTexture,
+                              float32 tilingFactor)
+    {
+        DrawQuad(vec3(position, 0.0f), size, subTexture, tilingFactor);
+    }
+
+    void Renderer2D::DrawQuad(const vec3& position, const vec2& size, const SubTexture2D& subTexture,
+                              float32 tilingFactor)
+    {
+        constexpr vec4 white(1.0f, 1.0f, 1.0f, 1.0f);
+        DrawQuadInternal(MakeTransform(position, size), subTexture.GetTexture(),
+                         subTexture.GetTexCoords(), white, tilingFactor);
+    }
+
+    void Renderer2D::DrawQuad(const vec2& position, const vec2& size, const SubTexture2D& subTexture,
+                              const vec4& tintColor, float32 tilingFactor)
+    {
+        DrawQuad(vec3(position, 0.0f), size, subTexture, tintColor, tilingFactor);
+    }
+
+    void Renderer2D::DrawQuad(const vec3& position, const vec2& size, const SubTexture2D& subTexture,
+                              const vec4& tintColor, float32 tilingFactor)
+    {
+        DrawQuadInternal(MakeTransform(position, size), subTexture.GetTexture(),
+                         subTexture.GetTexCoords(), tintColor, tilingFactor);
     }
 
     // =========================================================================
@@ -304,7 +603,7 @@ namespace NanSu
     void Renderer2D::DrawRotatedQuad(const vec3& position, const vec2& size,
                                      float32 rotation, const vec4& color)
     {
-        DrawRotatedQuadInternal(position, size, rotation, nullptr, color, 1.0f);
+        DrawQuadInternal(MakeTransform(position, size, rotation), nullptr, s_TexCoords, color, 1.0f);
     }
 
     // =========================================================================
@@ -322,7 +621,251 @@ namespace NanSu
                                      float32 rotation, Texture2D* texture,
                                      float32 tilingFactor, const vec4& tintColor)
     {
-        DrawRotatedQuadInternal(position, size, rotation, texture, tintColor, tilingFactor);
+        DrawQuadInternal(MakeTransform(position, size, rotation), texture, s_TexCoords, tintColor, tilingFactor);
+    }
+
+    // =========================================================================
+    // Draw Primitives - Rotated + Sub-Texture
+    // =========================================================================
+
+    void Renderer2D::DrawRotatedQuad(const vec2& position, const vec2& size,
+                                     float32 rotation, const SubTexture2D& subTexture,
+                                     float32 tilingFactor, const vec4& tintColor)
+    {
+        DrawRotatedQuad(vec3(position, 0.0f), size, rotation, subTexture, tilingFactor, tintColor);
+    }
+
+    void Renderer2D::DrawRotatedQuad(const vec3& position, const vec2& size,
+                                     float32 rotation, const SubTexture2D& subTexture,
+                                     float32 tilingFactor, const vec4& tintColor)
+    {
+        DrawQuadInternal(MakeTransform(position, size, rotation), subTexture.GetTexture(),
+                         subTexture.GetTexCoords(), tintColor, tilingFactor);
+    }
+
+    // =========================================================================
+    // Draw Primitives - Sprite Streams
+    // =========================================================================
+
+    void Renderer2D::DrawSprites(const SpriteStream& sprites)
+    {
+        if (sprites.Count == 0)
+        {
+            return;
+        }
+
+        // One slot lookup for the whole stream
+        auto acquireTextureIndex = [&sprites]()
+        {
+            if (!sprites.Texture)
+            {
+                return 0.0f;
+            }
+
+            int32 slot = FindOrAddTextureSlot(s_Data.TextureSlots, s_Data.TextureSlotIndex, 1, sprites.Texture);
+            if (slot < 0)
+            {
+                Flush();
+                slot = FindOrAddTextureSlot(s_Data.TextureSlots, s_Data.TextureSlotIndex, 1, sprites.Texture);
+            }
+            return static_cast<float32>(slot);
+        };
+
+        float32 textureIndex = acquireTextureIndex();
+
+        for (uint32 i = 0; i < sprites.Count; i++)
+        {
+            if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+            {
+                Flush();
+                textureIndex = acquireTextureIndex();
+            }
+
+            // Rotate the half extents directly instead of building a TRS matrix
+            float32 halfSize = sprites.Size[i] * 0.5f;
+            float32 c = std::cos(sprites.Rotation[i]) * halfSize;
+            float32 s = std::sin(sprites.Rotation[i]) * halfSize;
+            vec3 center(sprites.PositionX[i], sprites.PositionY[i], sprites.Z);
+
+            // Unit corners (BL, BR, TR, TL) rotated by (c, s)
+            const vec3 offsets[4] = {
+                { -c + s, -s - c, 0.0f },
+                {  c + s,  s - c, 0.0f },
+                {  c - s,  s + c, 0.0f },
+                { -c - s, -s + c, 0.0f }
+            };
+
+            const vec4& color = sprites.Color[i];
+            for (uint32 corner = 0; corner < 4; corner++)
+            {
+                s_Data.QuadVertexBufferPtr->Position = center + offsets[corner];
+                s_Data.QuadVertexBufferPtr->Color = color;
+                s_Data.QuadVertexBufferPtr->TexCoord = s_TexCoords[corner];
+                s_Data.QuadVertexBufferPtr->TexIndex = textureIndex;
+                s_Data.QuadVertexBufferPtr->TilingFactor = 1.0f;
+                s_Data.QuadVertexBufferPtr++;
+            }
+
+            s_Data.QuadIndexCount += 6;
+        }
+
+        s_Data.Stats.QuadCount += sprites.Count;
+    }
+
+    // =========================================================================
+    // Draw Primitives - Circles
+    // =========================================================================
+
+    void Renderer2D::DrawCircle(const mat4& transform, const vec4& color, float32 thickness, float32 fade)
+    {
+        if (s_Data.CircleIndexCount >= Renderer2DData::MaxIndices)
+        {
+            Flush();
+        }
+
+        for (uint32 i = 0; i < 4; i++)
+        {
+            s_Data.CircleVertexBufferPtr->WorldPosition = vec3(transform * s_Data.QuadVertexPositions[i]);
+            s_Data.CircleVertexBufferPtr->LocalPosition = vec3(s_Data.QuadVertexPositions[i]) * 2.0f;
+            s_Data.CircleVertexBufferPtr->Color = color;
+            s_Data.CircleVertexBufferPtr->Thickness = thickness;
+            s_Data.CircleVertexBufferPtr->Fade = fade;
+            s_Data.CircleVertexBufferPtr++;
+        }
+
+        s_Data.CircleIndexCount += 6;
+        s_Data.Stats.CircleCount++;
+    }
+
+    void Renderer2D::DrawCircle(const vec3& position, float32 radius, const vec4& color,
+                                float32 thickness, float32 fade)
+    {
+        DrawCircle(MakeTransform(position, vec2(radius * 2.0f)), color, thickness, fade);
+    }
+
+    // =========================================================================
+    // Draw Primitives - Lines
+    // =========================================================================
+
+    void Renderer2D::DrawLine(const vec3& p0, const vec3& p1, const vec4& color, float32 thickness)
+    {
+        vec2 direction = vec2(p1) - vec2(p0);
+        float32 length = glm::length(direction);
+        if (length <= 0.0f)
+        {
+            return;
+        }
+
+        if (s_Data.LineIndexCount >= Renderer2DData::MaxIndices)
+        {
+            Flush();
+        }
+
+        // Offset both ends along the normal by half the thickness
+        vec2 normal = vec2(-direction.y, direction.x) * (thickness * 0.5f / length);
+        const vec3 corners[4] = {
+            { p0.x - normal.x, p0.y - normal.y, p0.z },
+            { p1.x - normal.x, p1.y - normal.y, p1.z },
+            { p1.x + normal.x, p1.y + normal.y, p1.z },
+            { p0.x + normal.x, p0.y + normal.y, p0.z }
+        };
+
+        for (uint32 i = 0; i < 4; i++)
+        {
+            s_Data.LineVertexBufferPtr->Position = corners[i];
+            s_Data.LineVertexBufferPtr->Color = color;
+            s_Data.LineVertexBufferPtr++;
+        }
+
+        s_Data.LineIndexCount += 6;
+        s_Data.Stats.LineCount++;
+    }
+
+    void Renderer2D::DrawRect(const vec3& position, const vec2& size, const vec4& color, float32 thickness)
+    {
+        DrawRect(MakeTransform(position, size), color, thickness);
+    }
+
+    void Renderer2D::DrawRect(const mat4& transform, const vec4& color, float32 thickness)
+    {
+        vec3 corners[4];
+        for (uint32 i = 0; i < 4; i++)
+        {
+            corners[i] = vec3(transform * s_Data.QuadVertexPositions[i]);
+        }
+
+        // Extend each edge by half the thickness so the corners are closed
+        for (uint32 i = 0; i < 4; i++)
+        {
+            const vec3& start = corners[i];
+            const vec3& end = corners[(i + 1) % 4];
+
+            vec3 extension(0.0f);
+            float32 length = glm::length(vec2(end) - vec2(start));
+            if (length > 0.0f)
+            {
+                extension = vec3((vec2(end) - vec2(start)) * (thickness * 0.5f / length), 0.0f);
+            }
+
+            DrawLine(start - extension, end + extension, color, thickness);
+        }
+    }
+
+    // =========================================================================
+    // Draw Primitives - Text
+    // =========================================================================
+
+    void Renderer2D::DrawGlyphQuad(const mat4& transform, const vec2& min, const vec2& max,
+                                   const SubTexture2D& glyph, const vec4& color)
+    {
+        if (s_Data.TextIndexCount >= Renderer2DData::MaxIndices)
+        {
+            Flush();
+        }
+
+        int32 slot = FindOrAddTextureSlot(s_Data.TextTextureSlots, s_Data.TextTextureSlotIndex, 0,
+                                          glyph.GetTexture());
+        if (slot < 0)
+        {
+            Flush();
+            slot = FindOrAddTextureSlot(s_Data.TextTextureSlots, s_Data.TextTextureSlotIndex, 0,
+                                        glyph.GetTexture());
+        }
+
+        // Same corner order as QuadVertexPositions (BL, BR, TR, TL)
+        const vec4 corners[4] = {
+            { min.x, min.y, 0.0f, 1.0f },
+            { max.x, min.y, 0.0f, 1.0f },
+            { max.x, max.y, 0.0f, 1.0f },
+            { min.x, max.y, 0.0f, 1.0f }
+        };
+
+        const vec2* texCoords = glyph.GetTexCoords();
+        for (uint32 i = 0; i < 4; i++)
+        {
+            s_Data.TextVertexBufferPtr->Position = vec3(transform * corners[i]);
+            s_Data.TextVertexBufferPtr->Color = color;
+            s_Data.TextVertexBufferPtr->TexCoord = texCoords[i];
+            s_Data.TextVertexBufferPtr->TexIndex = static_cast<float32>(slot);
+            s_Data.TextVertexBufferPtr++;
+        }
+
+        s_Data.TextIndexCount += 6;
+        s_Data.Stats.GlyphCount++;
+    }
+
+    // =========================================================================
+    // Statistics
+    // =========================================================================
+
+    const Renderer2D::Statistics& Renderer2D::GetStats()
+    {
+        return s_Data.Stats;
+    }
+
+    void Renderer2D::ResetStats()
+    {
+        s_Data.Stats = {};
     }
 
 } // namespace NanSu
@@ -2,12 +2,14 @@
 
 #include "Core/Types.h"
 #include "Core/Math.h"
+#include "Renderer/PipelineState.h"
 
 namespace NanSu
 {
     // Forward declarations
     class OrthographicCamera;
     class Texture2D;
+    class SubTexture2D;
 
     /**
      * @brief High-level 2D rendering API
@@ -15,6 +17,12 @@ namespace NanSu
      * Provides simple methods for drawing 2D primitives (quads).
      * Uses a single-shader strategy with white texture fallback for color-only rendering.
      *
+     * Quads are accumulated into a CPU-side batch and drawn with one call per
+     * batch. A batch is flushed at EndScene(), when it runs out of quads or
+     * texture slots, or when the blend mode changes. Circles, lines and text
+     * have their own vertex streams in the same batch and are drawn after
+     * the quads, one call per primitive type.
+     *
      * Example usage:
      * @code
      * Renderer2D::Init();
@@ -23,6 +31,9 @@ namespace NanSu
      * Renderer2D::BeginScene(camera);
      * Renderer2D::DrawQuad({0.0f, 0.0f}, {1.0f, 1.0f}, {1.0f, 0.0f, 0.0f, 1.0f});  // Red quad
      * Renderer2D::DrawQuad({2.0f, 0.0f}, {1.0f, 1.0f}, texture);                    // Textured quad
+     * Renderer2D::DrawQuad({4.0f, 0.0f}, {1.0f, 1.0f}, *atlas.Find("coin"));        // Atlas sprite
+     * Renderer2D::SetBlendMode(BlendMode::Additive);                                // Starts a new batch
+     * Renderer2D::DrawQuad({0.0f, 1.0f}, {1.0f, 1.0f}, glowTexture);
      * Renderer2D::EndScene();
      *
      * Renderer2D::Shutdown();
@@ -62,10 +73,33 @@ namespace NanSu
 
         /**
          * @brief End the current scene
-         * Future: Flushes batched draw calls
+         * Flushes the pending batch
          */
         static void EndScene();
 
+        /**
+         * @brief Submit the pending batch to the GPU
+         */
+        static void Flush();
+
+        // =====================================================================
+        // Render State
+        // =====================================================================
+
+        /**
+         * @brief Set the blend mode for subsequent quads
+         * @param mode The blend mode (Alpha by default, reset every BeginScene)
+         *
+         * Changing the mode flushes the pending batch; setting the mode that is
+         * already active is free.
+         */
+        static void SetBlendMode(BlendMode mode);
+
+        /**
+         * @brief Get the blend mode used for subsequent quads
+         */
+        static BlendMode GetBlendMode();
+
         // =====================================================================
         // Draw Primitives - Position + Size + Color
         // =====================================================================
@@ -136,6 +170,52 @@ namespace NanSu
         static void DrawQuad(const vec3& position, const vec2& size, Texture2D* texture,
                              const vec4& tintColor, float32 tilingFactor = 1.0f);
 
+        // =====================================================================
+        // Draw Primitives - Position + Size + Sub-Texture
+        // =====================================================================
+
+        /**
+         * @brief Draw a region of a texture (sprite sheet cell or atlas image)
+         * @param position Center position (x, y)
+         * @param size Width and height
+         * @param subTexture The texture region to draw
+         * @param tilingFactor UV tiling factor (default 1.0)
+         */
+        static void DrawQuad(const vec2& position, const vec2& size, const SubTexture2D& subTexture,
+                             float32 tilingFactor = 1.0f);
+
+        /**
+         * @brief Draw a region of a texture with z-depth
+         * @param position Center position (x, y, z)
+         * @param size Width and height
+         * @param subTexture The texture region to draw
+         * @param tilingFactor UV tiling factor (default 1.0)
+         */
+        static void DrawQuad(const vec3& position, const vec2& size, const SubTexture2D& subTexture,
+                             float32 tilingFactor = 1.0f);
+
+        /**
+         * @brief Draw a region of a texture with tint color
+         * @param position Center position (x, y)
+         * @param size Width and height
+         * @param subTexture The texture region to draw
+         * @param tintColor Color to multiply with texture
+         * @param tilingFactor UV tiling factor (default 1.0)
+         */
+        static void DrawQuad(const vec2& position, const vec2& size, const SubTexture2D& subTexture,
+                             const vec4& tintColor, float32 tilingFactor = 1.0f);
+
+        /**
+         * @brief Draw a region of a texture with tint color and z-depth
+         * @param position Center position (x, y, z)
+         * @param size Width and height
+         * @param subTexture The texture region to draw
+         * @param tintColor Color to multiply with texture
+         * @param tilingFactor UV tiling factor (default 1.0)
+         */
+        static void DrawQuad(const vec3& position, const vec2& size, const SubTexture2D& subTexture,
+                             const vec4& tintColor, float32 tilingFactor = 1.0f);
+
         // =====================================================================
         // Draw Primitives - Rotated + Color
         // =====================================================================
@@ -191,6 +271,172 @@ namespace NanSu
                                     float32 rotation, Texture2D* texture,
                                     float32 tilingFactor = 1.0f,
                                     const vec4& tintColor = vec4(1.0f));
+
+        // =====================================================================
+        // Draw Primitives - Rotated + Sub-Texture
+        // =====================================================================
+
+        /**
+         * @brief Draw a rotated region of a texture
+         * @param position Center position (x, y)
+         * @param size Width and height
+         * @param rotation Rotation in radians (around Z axis)
+         * @param subTexture The texture region to draw
+         * @param tilingFactor UV tiling factor
+         * @param tintColor Color to multiply with texture
+         */
+        static void DrawRotatedQuad(const vec2& position, const vec2& size,
+                                    float32 rotation, const SubTexture2D& subTexture,
+                                    float32 tilingFactor = 1.0f,
+                                    const vec4& tintColor = vec4(1.0f));
+
+        /**
+         * @brief Draw a rotated region of a texture with z-depth
+         * @param position Center position (x, y, z)
+         * @param size Width and height
+         * @param rotation Rotation in radians (around Z axis)
+         * @param subTexture The texture region to draw
+         * @param tilingFactor UV tiling factor
+         * @param tintColor Color to multiply with texture
+         */
+        static void DrawRotatedQuad(const vec3& position, const vec2& size,
+                                    float32 rotation, const SubTexture2D& subTexture,
+                                    float32 tilingFactor = 1.0f,
+                                    const vec4& tintColor = vec4(1.0f));
+
+        // =====================================================================
+        // Draw Primitives - Circles
+        // =====================================================================
+
+        /**
+         * @brief Draw a circle or ring inscribed in a transformed unit quad
+         * @param transform Transform of the bounding quad (scale = diameter)
+         * @param color RGBA color
+         * @param thickness Ring thickness relative to the radius (1.0 = filled disc)
+         * @param fade Edge softness relative to the radius
+         *
+         * The shape is evaluated per pixel, so circles stay smooth at any size.
+         */
+        static void DrawCircle(const mat4& transform, const vec4& color,
+                               float32 thickness = 1.0f, float32 fade = 0.005f);
+
+        /**
+         * @brief Draw a circle or ring
+         * @param position Center position (x, y, z)
+         * @param radius Radius in world units
+         * @param color RGBA color
+         * @param thickness Ring thickness relative to the radius (1.0 = filled disc)
+         * @param fade Edge softness relative to the radius
+         */
+        static void DrawCircle(const vec3& position, float32 radius, const vec4& color,
+                               float32 thickness = 1.0f, float32 fade = 0.005f);
+
+        // =====================================================================
+        // Draw Primitives - Lines
+        // =====================================================================
+
+        /**
+         * @brief Draw a line segment
+         * @param p0 Start point
+         * @param p1 End point
+         * @param color RGBA color
+         * @param thickness Line width in world units
+         */
+        static void DrawLine(const vec3& p0, const vec3& p1, const vec4& color,
+                             float32 thickness = 0.01f);
+
+        /**
+         * @brief Draw a rectangle outline
+         * @param position Center position (x, y, z)
+         * @param size Width and height
+         * @param color RGBA color
+         * @param thickness Line width in world units
+         */
+        static void DrawRect(const vec3& position, const vec2& size, const vec4& color,
+                             float32 thickness = 0.01f);
+
+        /**
+         * @brief Draw the outline of a transformed unit quad
+         * @param transform Transform of the rectangle (same convention as quads)
+         * @param color RGBA color
+         * @param thickness Line width in world units
+         */
+        static void DrawRect(const mat4& transform, const vec4& color, float32 thickness = 0.01f);
+
+        // =====================================================================
+        // Draw Primitives - Sprite Streams
+        // =====================================================================
+
+        /**
+         * @brief Many rotated square quads in structure-of-arrays form
+         *
+         * Used by systems that already keep their data as arrays (particles),
+         * so quads go into the batch without a per-quad transform matrix.
+         */
+        struct SpriteStream
+        {
+            uint32 Count = 0;
+            const float32* PositionX = nullptr;     // Center x
+            const float32* PositionY = nullptr;     // Center y
+            float32 Z = 0.0f;                       // Shared depth
+            const float32* Size = nullptr;          // Edge length
+            const float32* Rotation = nullptr;      // Radians (around Z axis)
+            const vec4* Color = nullptr;
+            Texture2D* Texture = nullptr;           // nullptr = untextured
+        };
+
+        /**
+         * @brief Draw every quad of a sprite stream
+         * @param sprites The quads to draw (arrays must hold Count elements)
+         */
+        static void DrawSprites(const SpriteStream& sprites);
+
+        // =====================================================================
+        // Draw Primitives - Text
+        // =====================================================================
+
+        /**
+         * @brief Draw one signed-distance-field glyph into the text batch
+         * @param transform Transform applied to the glyph corners
+         * @param min Bottom-left corner of the glyph quad (before transform)
+         * @param max Top-right corner of the glyph quad (before transform)
+         * @param glyph Glyph region in a font atlas
+         * @param color Text color
+         *
+         * Normally called by TextRenderer. Text is drawn after the quads of
+         * the same batch, so it appears on top of them.
+         */
+        static void DrawGlyphQuad(const mat4& transform, const vec2& min, const vec2& max,
+                                  const SubTexture2D& glyph, const vec4& color);
+
+        // =====================================================================
+        // Statistics
+        // =====================================================================
+
+        /**
+         * @brief Per-frame batching statistics
+         */
+        struct Statistics
+        {
+            uint32 DrawCalls = 0;
+            uint32 QuadCount = 0;
+            uint32 GlyphCount = 0;
+            uint32 CircleCount = 0;
+            uint32 LineCount = 0;
+
+            uint32 GetTotalVertexCount() const { return (QuadCount + GlyphCount + CircleCount + LineCount) * 4; }
+            uint32 GetTotalIndexCount() const { return (QuadCount + GlyphCount + CircleCount + LineCount) * 6; }
+        };
+
+        /**
+         * @brief Get the statistics accumulated since the last ResetStats()
+         */
+        static const Statistics& GetStats();
+
+        /**
+         * @brief Reset the statistics (typically once per frame)
+         */
+        static void ResetStats();
     };
 
 } // namespace NanSu
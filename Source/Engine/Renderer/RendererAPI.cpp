@@ -6,7 +6,7 @@ namespace NanSu
 #ifdef NS_PLATFORM_WINDOWS
     RendererAPI::API RendererAPI::s_API = RendererAPI::API::DirectX11;
 #else
-    RendererAPI::API RendererAPI::s_API = RendererAPI::API::None;
+    RendererAPI::API RendererAPI::s_API = RendererAPI::API::Headless;
 #endif
 
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Types.h"
+#include "Renderer/PipelineState.h"
 
 namespace NanSu
 {
@@ -41,7 +42,8 @@ namespace NanSu
             None = 0,
             DirectX11,
             DirectX12,
-            Vulkan
+            Vulkan,
+            Headless        // No GPU: commands are accepted and discarded (automation, CI)
         };
 
     public:
@@ -95,6 +97,15 @@ namespace NanSu
          */
         virtual void BindRenderTarget() = 0;
 
+        /**
+         * @brief Set the blend, depth, rasterizer and sampler (s0) state
+         * @param state The pipeline state description
+         *
+         * Implementations share native state objects between identical
+         * descriptions and skip binds that would not change anything.
+         */
+        virtual void SetPipelineState(const PipelineState& state) = 0;
+
         /**
          * @brief Draw indexed geometry
          * @param indexBuffer The index buffer to use
@@ -4,9 +4,79 @@
 #include "Renderer/Buffer.h"
 
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace NanSu
 {
+    // =========================================================================
+    // Shader Reflection
+    // =========================================================================
+
+    /**
+     * @brief A single member of a shader constant buffer, as reported by the compiler
+     */
+    struct ShaderUniform
+    {
+        std::string Name;
+        ShaderDataType Type = ShaderDataType::None;   // None for types without a mapping (arrays, structs)
+        uint32 Offset = 0;                             // Byte offset inside the buffer
+        uint32 Size = 0;                               // Size in bytes, including register padding
+    };
+
+    /**
+     * @brief Layout of a shader constant buffer (cbuffer), as reported by the compiler
+     */
+    struct ShaderUniformBuffer
+    {
+        std::string Name;
+        uint32 Slot = 0;                               // Register index (b0 = 0)
+        uint32 Size = 0;                               // Total size in bytes (multiple of 16)
+        std::vector<ShaderUniform> Uniforms;
+
+        /**
+         * @brief Find a member by name
+         * @return The member, or nullptr if the buffer has no such member
+         */
+        const ShaderUniform* FindUniform(std::string_view name) const
+        {
+            for (const auto& uniform : Uniforms)
+            {
+                if (uniform.Name == name)
+                {
+                    return &uniform;
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Check whether two layouts are binary compatible (slot, size and member placement)
+         */
+        bool IsLayoutCompatible(const ShaderUniformBuffer& other) const
+        {
+            if (Slot != other.Slot || Size != other.Size || Uniforms.size() != other.Uniforms.size())
+            {
+                return false;
+            }
+
+            for (usize i = 0; i < Uniforms.size(); ++i)
+            {
+                if (Uniforms[i].Offset != other.Uniforms[i].Offset ||
+                    Uniforms[i].Size != other.Uniforms[i].Size ||
+                    Uniforms[i].Name != other.Uniforms[i].Name)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    // =========================================================================
+    // Shader
+    // =========================================================================
+
     /**
      * @brief Abstract shader interface for platform-independent shader management
      *
@@ -55,6 +125,40 @@ namespace NanSu
          */
         virtual const std::string& GetName() const = 0;
 
+        /**
+         * @brief Recompile the shader from its source file
+         * @return true if the shader was replaced
+         *
+         * On failure the previous version stays bound and usable. Shaders
+         * created from source strings cannot be reloaded.
+         */
+        virtual bool Reload() = 0;
+
+        /**
+         * @brief Get the constant buffers used by any stage of this shader
+         * @return Reflected buffer layouts, sorted by slot
+         *
+         * Layouts are refreshed when the shader is reloaded.
+         */
+        virtual const std::vector<ShaderUniformBuffer>& GetUniformBuffers() const = 0;
+
+        /**
+         * @brief Find a constant buffer by its HLSL name
+         * @param name The cbuffer name (e.g., "SceneData")
+         * @return The buffer layout, or nullptr if the shader does not use it
+         */
+        const ShaderUniformBuffer* FindUniformBuffer(std::string_view name) const
+        {
+            for (const auto& buffer : GetUniformBuffers())
+            {
+                if (buffer.Name == name)
+                {
+                    return &buffer;
+                }
+            }
+            return nullptr;
+        }
+
         /**
          * @brief Create a shader from a single HLSL file containing VS and PS
          * @param filePath Path to the HLSL file (e.g., "Assets/Shaders/Basic.hlsl")
@@ -0,0 +1,340 @@
+#include "EnginePCH.h"
+#include "Renderer/ShaderCache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <thread>
+
+namespace NanSu
+{
+    std::string ShaderCache::s_Directory;
+    ShaderCache::Statistics ShaderCache::s_Statistics;
+
+    namespace
+    {
+        constexpr uint32 SHADER_CACHE_MAGIC = 0x4253534E;    // "NSSB" (little-endian)
+        constexpr const char* SHADER_CACHE_EXTENSION = ".nsb";
+
+        /**
+         * @brief On-disk entry header, followed by BytecodeSize bytes
+         */
+        struct ShaderCacheEntryHeader
+        {
+            uint32 Magic = SHADER_CACHE_MAGIC;
+            uint32 Version = SHADER_CACHE_VERSION;
+            uint64 Key = 0;             // Also encoded in the file name
+            uint64 KeyCheck = 0;        // Independent hash of the same inputs (guards against key collisions)
+            uint64 BytecodeHash = 0;    // Detects torn or corrupted payloads
+            uint64 BytecodeSize = 0;
+        };
+
+        static_assert(sizeof(ShaderCacheEntryHeader) == 40, "ShaderCacheEntryHeader layout changed");
+
+        /**
+         * @brief Incremental 64-bit FNV-1a with length-prefixed fields
+         *
+         * Length prefixes keep ("ab", "c") and ("a", "bc") from hashing equal.
+         */
+        class KeyHasher
+        {
+        public:
+            explicit KeyHasher(uint64 seed)
+                : m_Hash(seed)
+            {
+            }
+
+            void Add(const void* data, usize size)
+            {
+                const auto* bytes = static_cast<const byte*>(data);
+                for (usize i = 0; i < size; ++i)
+                {
+                    m_Hash ^= bytes[i];
+                    m_Hash *= 0x100000001B3ull;
+                }
+            }
+
+            void AddField(std::string_view field)
+            {
+                uint64 length = field.size();
+                Add(&length, sizeof(length));
+                Add(field.data(), field.size());
+            }
+
+            uint64 Get() const { return m_Hash; }
+
+        private:
+            uint64 m_Hash;
+        };
+
+        uint64 HashRequest(const ShaderCompileRequest& request, uint64 seed)
+        {
+            KeyHasher hasher(seed);
+
+            uint32 version = SHADER_CACHE_VERSION;
+            hasher.Add(&version, sizeof(version));
+            hasher.AddField(request.CompilerId);
+            hasher.AddField(request.EntryPoint);
+            hasher.AddField(request.Target);
+            hasher.Add(&request.Flags, sizeof(request.Flags));
+
+            uint64 defineCount = request.Defines.size();
+            hasher.Add(&defineCount, sizeof(defineCount));
+            for (const auto& [name, value] : request.Defines)
+            {
+                hasher.AddField(name);
+                hasher.AddField(value);
+            }
+
+            hasher.AddField(request.Source);
+            return hasher.Get();
+        }
+
+        uint64 HashBytecode(const std::vector<byte>& bytecode)
+        {
+            KeyHasher hasher(0xCBF29CE484222325ull);
+            hasher.Add(bytecode.data(), bytecode.size());
+            return hasher.Get();
+        }
+
+        std::string KeyToFileName(uint64 key)
+        {
+            char buffer[17];
+            std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(key));
+            return std::string(buffer) + SHADER_CACHE_EXTENSION;
+        }
+
+        /**
+         * @brief Whether a directory name is a cache version directory ("v<digits>")
+         */
+        bool IsVersionDirectoryName(const std::string& name)
+        {
+            return name.size() > 1 && name[0] == 'v' &&
+                std::all_of(name.begin() + 1, name.end(), [](char c) { return c >= '0' && c <= '9'; });
+        }
+
+        /**
+         * @brief Delete a stale version directory, touching only cache entries
+         *
+         * The directory itself is removed only once it is empty, so anything
+         * else a user put there survives.
+         */
+        void RemoveVersionDirectory(const std::filesystem::path& directory)
+        {
+            namespace fs = std::filesystem;
+
+            std::error_code ec;
+            std::vector<fs::path> entries;
+            for (const auto& entry : fs::directory_iterator(directory, ec))
+            {
+                if (entry.is_regular_file(ec) && entry.path().extension() == SHADER_CACHE_EXTENSION)
+                {
+                    entries.push_back(entry.path());
+                }
+            }
+
+            for (const fs::path& entry : entries)
+            {
+                fs::remove(entry, ec);
+            }
+            fs::remove(directory, ec);
+        }
+    }
+
+    // =========================================================================
+    // Lifecycle
+    // =========================================================================
+
+    void ShaderCache::Initialize(const std::string& rootDirectory)
+    {
+        namespace fs = std::filesystem;
+
+        std::string versionDirectory = "v" + std::to_string(SHADER_CACHE_VERSION);
+        fs::path directory = fs::path(rootDirectory) / versionDirectory;
+
+        std::error_code ec;
+        fs::create_directories(directory, ec);
+        if (ec)
+        {
+            NS_ENGINE_WARN("Shader cache disabled, cannot create '{}': {}", directory.string(), ec.message());
+            return;
+        }
+
+        // Entries from older cache versions can never hit again. The root may
+        // be shared with other data, so only other "v<N>" directories are pruned.
+        std::vector<fs::path> staleDirectories;
+        for (const auto& entry : fs::directory_iterator(rootDirectory, ec))
+        {
+            std::string name = entry.path().filename().string();
+            if (!entry.is_symlink(ec) && entry.is_directory(ec) &&
+                name != versionDirectory && IsVersionDirectoryName(name))
+            {
+                staleDirectories.push_back(entry.path());
+            }
+        }
+
+        for (const fs::path& staleDirectory : staleDirectories)
+        {
+            RemoveVersionDirectory(staleDirectory);
+        }
+
+        s_Directory = directory.string();
+        s_Statistics = {};
+        NS_ENGINE_INFO("Shader cache initialized: {}", s_Directory);
+    }
+
+    void ShaderCache::Shutdown()
+    {
+        if (IsEnabled())
+        {
+            NS_ENGINE_INFO("Shader cache: {} hits, {} misses, {} write failures",
+                           s_Statistics.Hits, s_Statistics.Misses, s_Statistics.WriteFailures);
+        }
+        s_Directory.clear();
+    }
+
+    // =========================================================================
+    // Compilation
+    // =========================================================================
+
+    uint64 ShaderCache::ComputeKey(const ShaderCompileRequest& request)
+    {
+        return HashRequest(request, 0xCBF29CE484222325ull);
+    }
+
+    bool ShaderCache::Compile(const ShaderCompileRequest& request,
+                              const ShaderCompileFunc& compiler,
+                              std::vector<byte>& outBytecode)
+    {
+        if (!IsEnabled())
+        {
+            return compiler(request, outBytecode);
+        }
+
+        uint64 key = ComputeKey(request);
+        uint64 check = HashRequest(request, 0x84222325CBF29CE4ull);
+        std::string path = (std::filesystem::path(s_Directory) / KeyToFileName(key)).string();
+
+        if (ReadEntry(path, key, check, outBytecode))
+        {
+            ++s_Statistics.Hits;
+            NS_ENGINE_TRACE("Shader cache hit: {} ({})", request.SourceName, request.EntryPoint);
+            return true;
+        }
+
+        ++s_Statistics.Misses;
+        if (!compiler(request, outBytecode))
+        {
+            return false;
+        }
+
+        if (!WriteEntry(path, key, check, outBytecode))
+        {
+            ++s_Statistics.WriteFailures;
+            NS_ENGINE_WARN("Failed to write shader cache entry: {}", path);
+        }
+
+        return true;
+    }
+
+    // =========================================================================
+    // Entry I/O
+    // =========================================================================
+
+    bool ShaderCache::ReadEntry(const std::string& path, uint64 key, uint64 check, std::vector<byte>& outBytecode)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+        {
+            return false;
+        }
+
+        std::streamoff fileSize = file.tellg();
+        file.seekg(0, std::ios::beg);
+        if (fileSize < static_cast<std::streamoff>(sizeof(ShaderCacheEntryHeader)))
+        {
+            return false;
+        }
+
+        ShaderCacheEntryHeader header;
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        {
+            return false;
+        }
+
+        if (header.Magic != SHADER_CACHE_MAGIC || header.Version != SHADER_CACHE_VERSION ||
+            header.Key != key || header.KeyCheck != check)
+        {
+            return false;
+        }
+
+        // The size field is untrusted: it must account for exactly the rest of the file
+        uint64 payloadSize = static_cast<uint64>(fileSize) - sizeof(header);
+        if (header.BytecodeSize != payloadSize)
+        {
+            NS_ENGINE_WARN("Corrupt shader cache entry ignored: {}", path);
+            return false;
+        }
+
+        outBytecode.resize(static_cast<usize>(header.BytecodeSize));
+        if (!file.read(reinterpret_cast<char*>(outBytecode.data()), static_cast<std::streamsize>(outBytecode.size())))
+        {
+            outBytecode.clear();
+            return false;
+        }
+
+        if (HashBytecode(outBytecode) != header.BytecodeHash)
+        {
+            NS_ENGINE_WARN("Corrupt shader cache entry ignored: {}", path);
+            outBytecode.clear();
+            return false;
+        }
+
+        return true;
+    }
+
+    bool ShaderCache::WriteEntry(const std::string& path, uint64 key, uint64 check, const std::vector<byte>& bytecode)
+    {
+        namespace fs = std::filesystem;
+
+        ShaderCacheEntryHeader header;
+        header.Key = key;
+        header.KeyCheck = check;
+        header.BytecodeHash = HashBytecode(bytecode);
+        header.BytecodeSize = bytecode.size();
+
+        // Unique temporary name per writer, then an atomic rename into place
+        usize writerId = std::hash<std::thread::id>{}(std::this_thread::get_id()) ^
+                         static_cast<usize>(std::chrono::steady_clock::now().time_since_epoch().count());
+        std::string tempPath = path + ".tmp" + std::to_string(writerId);
+
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file)
+            {
+                return false;
+            }
+
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(bytecode.data()), static_cast<std::streamsize>(bytecode.size()));
+            if (!file.flush())
+            {
+                file.close();
+                std::error_code ec;
+                fs::remove(tempPath, ec);
+                return false;
+            }
+        }
+
+        std::error_code ec;
+        fs::rename(tempPath, path, ec);
+        if (ec)
+        {
+            fs::remove(tempPath, ec);
+            return false;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "Core/Types.h"
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace NanSu
+{
+    /**
+     * @brief Everything that influences the output of a single shader compile
+     *
+     * Source must already be preprocessed so that edits to included files
+     * change the key as well.
+     */
+    struct ShaderCompileRequest
+    {
+        std::string_view Source;                // Preprocessed source
+        std::string_view SourceName;            // For diagnostics only (not part of the key)
+        std::string_view EntryPoint;            // e.g. "VSMain"
+        std::string_view Target;                // e.g. "vs_5_0"
+        std::vector<std::pair<std::string, std::string>> Defines;
+        uint32 Flags = 0;                       // Backend compile flags
+        std::string_view CompilerId;            // Identifies the compiler build/backend
+    };
+
+    /**
+     * @brief Backend compiler callback
+     * @return true on success with the bytecode written to outBytecode
+     */
+    using ShaderCompileFunc = std::function<bool(const ShaderCompileRequest& request, std::vector<byte>& outBytecode)>;
+
+    /**
+     * @brief Backend-independent on-disk cache of compiled shader bytecode
+     *
+     * Sits between the shader backends and their compiler: on a hit the stored
+     * bytecode is returned and the compiler is never invoked. Entries live in
+     * a versioned directory (<root>/v<SHADER_CACHE_VERSION>/<key>.nsb) and are
+     * written to a temporary file first and renamed into place, so a crash or
+     * a concurrent writer never leaves a truncated entry behind.
+     *
+     * Usage:
+     *   ShaderCache::Initialize("../../Build/ShaderCache");
+     *   std::vector<byte> bytecode;
+     *   ShaderCache::Compile(request, compiler, bytecode);
+     *
+     * When the cache is not initialized, Compile() forwards to the compiler.
+     */
+    class ShaderCache
+    {
+    public:
+        struct Statistics
+        {
+            uint32 Hits = 0;
+            uint32 Misses = 0;
+            uint32 WriteFailures = 0;
+        };
+
+        /**
+         * @brief Enable the cache and prune directories of older cache versions
+         * @param rootDirectory Root directory of the cache
+         */
+        static void Initialize(const std::string& rootDirectory);
+        static void Shutdown();
+
+        static bool IsEnabled() { return !s_Directory.empty(); }
+
+        /**
+         * @brief Compile through the cache
+         * @param request Compile inputs (used to build the cache key)
+         * @param compiler Invoked only on a cache miss
+         * @param outBytecode Receives the compiled bytecode
+         * @return false if the compiler failed (failures are never cached)
+         */
+        static bool Compile(const ShaderCompileRequest& request,
+                            const ShaderCompileFunc& compiler,
+                            std::vector<byte>& outBytecode);
+
+        /**
+         * @brief Compute the 64-bit cache key of a request
+         */
+        static uint64 ComputeKey(const ShaderCompileRequest& request);
+
+        static const Statistics& GetStatistics() { return s_Statistics; }
+
+    private:
+        static bool ReadEntry(const std::string& path, uint64 key, uint64 check, std::vector<byte>& outBytecode);
+        static bool WriteEntry(const std::string& path, uint64 key, uint64 check, const std::vector<byte>& bytecode);
+
+    private:
+        static std::string s_Directory;
+        static Statistics s_Statistics;
+    };
+
+    // Bump when the entry format or key composition changes
+    constexpr uint32 SHADER_CACHE_VERSION = 1;
+
+    // Default cache location, relative to the executable working directory
+    constexpr const char* SHADER_CACHE_DEFAULT_DIRECTORY = "../../Build/ShaderCache";
+}
@@ -0,0 +1,142 @@
+#include "EnginePCH.h"
+#include "Renderer/SkylinePacker.h"
+
+namespace NanSu
+{
+    SkylinePacker::SkylinePacker(uint32 width, uint32 height)
+    {
+        Reset(width, height);
+    }
+
+    void SkylinePacker::Reset(uint32 width, uint32 height)
+    {
+        m_Width = width;
+        m_Height = height;
+        m_UsedArea = 0;
+
+        m_Skyline.clear();
+        m_Skyline.push_back({ 0, 0, width });
+    }
+
+    bool SkylinePacker::Pack(uint32 width, uint32 height, uint32& outX, uint32& outY)
+    {
+        if (width == 0 || height == 0 || width > m_Width || height > m_Height)
+        {
+            return false;
+        }
+
+        usize bestIndex = m_Skyline.size();
+        uint32 bestY = Limits::UInt32Max;
+        uint64 bestWaste = Limits::UInt64Max;
+
+        for (usize i = 0; i < m_Skyline.size(); ++i)
+        {
+            uint32 y;
+            uint64 waste;
+            if (!Fit(i, width, height, y, waste))
+            {
+                continue;
+            }
+
+            // Bottom-left: lowest top edge first, then least area lost under the rectangle
+            if (y < bestY || (y == bestY && waste < bestWaste))
+            {
+                bestIndex = i;
+                bestY = y;
+                bestWaste = waste;
+            }
+        }
+
+        if (bestIndex == m_Skyline.size())
+        {
+            return false;
+        }
+
+        outX = m_Skyline[bestIndex].X;
+        outY = bestY;
+        AddSegment(bestIndex, outX, outY, width, height);
+        m_UsedArea += static_cast<uint64>(width) * height;
+        return true;
+    }
+
+    float32 SkylinePacker::GetOccupancy() const
+    {
+        uint64 totalArea = static_cast<uint64>(m_Width) * m_Height;
+        return totalArea ? static_cast<float32>(static_cast<float64>(m_UsedArea) / totalArea) : 0.0f;
+    }
+
+    bool SkylinePacker::Fit(usize index, uint32 width, uint32 height, uint32& outY, uint64& outWaste) const
+    {
+        uint32 x = m_Skyline[index].X;
+        if (x + width > m_Width)
+        {
+            return false;
+        }
+
+        // The rectangle rests on the highest segment it spans
+        uint32 y = 0;
+        uint32 remaining = width;
+        for (usize i = index; remaining > 0; ++i)
+        {
+            NS_ENGINE_ASSERT(i < m_Skyline.size(), "Skyline does not cover the packing width");
+            y = std::max(y, m_Skyline[i].Y);
+            remaining -= std::min(remaining, m_Skyline[i].Width);
+        }
+
+        if (y + height > m_Height)
+        {
+            return false;
+        }
+
+        // Area between the skyline and the bottom of the rectangle becomes unusable
+        uint64 waste = 0;
+        remaining = width;
+        for (usize i = index; remaining > 0; ++i)
+        {
+            uint32 span = std::min(remaining, m_Skyline[i].Width);
+            waste += static_cast<uint64>(y - m_Skyline[i].Y) * span;
+            remaining -= span;
+        }
+
+        outY = y;
+        outWaste = waste;
+        return true;
+    }
+
+    void SkylinePacker::AddSegment(usize index, uint32 x, uint32 y, uint32 width, uint32 height)
+    {
+        m_Skyline.insert(m_Skyline.begin() + index, { x, y + height, width });
+
+        // Shrink or remove the segments now covered by the new one
+        uint32 right = x + width;
+        usize i = index + 1;
+        while (i < m_Skyline.size() && m_Skyline[i].X < right)
+        {
+            uint32 segmentRight = m_Skyline[i].X + m_Skyline[i].Width;
+            if (segmentRight <= right)
+            {
+                m_Skyline.erase(m_Skyline.begin() + i);
+                continue;
+            }
+
+            m_Skyline[i].Width = segmentRight - right;
+            m_Skyline[i].X = right;
+            break;
+        }
+
+        // Merge neighbours at the same height
+        for (usize j = 0; j + 1 < m_Skyline.size();)
+        {
+            if (m_Skyline[j].Y == m_Skyline[j + 1].Y)
+            {
+                m_Skyline[j].Width += m_Skyline[j + 1].Width;
+                m_Skyline.erase(m_Skyline.begin() + j + 1);
+            }
+            else
+            {
+                ++j;
+            }
+        }
+    }
+
+}
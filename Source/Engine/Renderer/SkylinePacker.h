@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Core/Types.h"
+
+#include <vector>
+
+namespace NanSu
+{
+    /**
+     * @brief Online rectangle packer using the skyline bottom-left heuristic
+     *
+     * Tracks the upper outline ("skyline") of everything placed so far as a
+     * list of horizontal segments. A new rectangle goes where its top edge
+     * ends up lowest, ties broken by the least wasted area below it. Packing
+     * is O(segments) per rectangle and works well for sprite and glyph sized
+     * rectangles added one at a time.
+     *
+     * Example usage:
+     * @code
+     * SkylinePacker packer(1024, 1024);
+     * uint32 x, y;
+     * if (packer.Pack(32, 48, x, y)) { ... }
+     * @endcode
+     */
+    class SkylinePacker
+    {
+    public:
+        SkylinePacker() = default;
+        SkylinePacker(uint32 width, uint32 height);
+
+        /**
+         * @brief Clear all placements and resize the packing area
+         */
+        void Reset(uint32 width, uint32 height);
+
+        /**
+         * @brief Find room for a rectangle and mark it as used
+         * @param width Rectangle width in pixels
+         * @param height Rectangle height in pixels
+         * @param outX Receives the left edge of the placement
+         * @param outY Receives the top edge of the placement
+         * @return false if the rectangle does not fit anywhere
+         */
+        bool Pack(uint32 width, uint32 height, uint32& outX, uint32& outY);
+
+        uint32 GetWidth() const { return m_Width; }
+        uint32 GetHeight() const { return m_Height; }
+
+        /**
+         * @brief Fraction of the area covered by packed rectangles (0.0 - 1.0)
+         */
+        float32 GetOccupancy() const;
+
+    private:
+        struct Segment
+        {
+            uint32 X;
+            uint32 Y;       // Height of the skyline over [X, X + Width)
+            uint32 Width;
+        };
+
+        /**
+         * @brief Lowest Y at which a rectangle can start at segment index
+         * @return false if the rectangle does not fit there
+         */
+        bool Fit(usize index, uint32 width, uint32 height, uint32& outY, uint64& outWaste) const;
+
+        /**
+         * @brief Raise the skyline under a newly placed rectangle
+         */
+        void AddSegment(usize index, uint32 x, uint32 y, uint32 width, uint32 height);
+
+    private:
+        uint32 m_Width = 0;
+        uint32 m_Height = 0;
+        uint64 m_UsedArea = 0;
+        std::vector<Segment> m_Skyline;
+    };
+
+}
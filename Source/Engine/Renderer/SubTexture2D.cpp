@@ -0,0 +1,31 @@
+#include "EnginePCH.h"
+#include "Renderer/SubTexture2D.h"
+#include "Renderer/Texture.h"
+
+namespace NanSu
+{
+    SubTexture2D::SubTexture2D(Texture2D* texture, const vec2& min, const vec2& max)
+        : m_Texture(texture)
+    {
+        // Same corner order as the full-texture coordinates in Renderer2D
+        m_TexCoords[0] = { min.x, max.y };  // Bottom-left
+        m_TexCoords[1] = { max.x, max.y };  // Bottom-right
+        m_TexCoords[2] = { max.x, min.y };  // Top-right
+        m_TexCoords[3] = { min.x, min.y };  // Top-left
+    }
+
+    SubTexture2D SubTexture2D::CreateFromCoords(Texture2D* texture, const vec2& coords,
+                                                const vec2& cellSize, const vec2& spriteSize)
+    {
+        NS_ENGINE_ASSERT(texture, "Sprite sheet texture is null");
+
+        vec2 textureSize(static_cast<float32>(texture->GetWidth()),
+                         static_cast<float32>(texture->GetHeight()));
+
+        // Images are stored bottom row first, so cell rows count up from the bottom
+        vec2 min = (coords * cellSize) / textureSize;
+        vec2 max = ((coords + spriteSize) * cellSize) / textureSize;
+        return SubTexture2D(texture, min, max);
+    }
+
+} // namespace NanSu
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Core/Math.h"
+
+namespace NanSu
+{
+    // Forward declarations
+    class Texture2D;
+
+    /**
+     * @brief A rectangular region of a Texture2D
+     *
+     * Lets many sprites share one texture (sprite sheets, texture atlases) so
+     * Renderer2D can draw them in a single batch with a single texture slot.
+     * The SubTexture2D does not own the texture.
+     *
+     * UV rectangles use the same space as full textures in Renderer2D:
+     * min is the (0, 0) corner, max the (1, 1) corner.
+     *
+     * Example usage:
+     * @code
+     * auto* sheet = Texture2D::Create("Assets/Textures/tiles.png");
+     * SubTexture2D grass = SubTexture2D::CreateFromCoords(sheet, {2, 3}, {16, 16});
+     * Renderer2D::DrawQuad({0.0f, 0.0f}, {1.0f, 1.0f}, grass);
+     * @endcode
+     */
+    class SubTexture2D
+    {
+    public:
+        /**
+         * @brief Create a sub-texture from a UV rectangle
+         * @param texture The texture containing the region
+         * @param min UV of the (0, 0) corner of the region
+         * @param max UV of the (1, 1) corner of the region
+         */
+        SubTexture2D(Texture2D* texture, const vec2& min, const vec2& max);
+
+        Texture2D* GetTexture() const { return m_Texture; }
+
+        /**
+         * @brief Texture coordinates in Renderer2D quad order (BL, BR, TR, TL)
+         */
+        const vec2* GetTexCoords() const { return m_TexCoords; }
+
+        /**
+         * @brief Create a sub-texture from a cell of a uniform sprite sheet grid
+         * @param texture The sprite sheet
+         * @param coords Cell index (x, y), counted from the bottom-left cell
+         * @param cellSize Size of one grid cell in pixels
+         * @param spriteSize Size of the sprite in cells (for sprites spanning several cells)
+         */
+        static SubTexture2D CreateFromCoords(Texture2D* texture, const vec2& coords,
+                                             const vec2& cellSize, const vec2& spriteSize = vec2(1.0f));
+
+    private:
+        Texture2D* m_Texture = nullptr;
+        vec2 m_TexCoords[4];
+    };
+
+} // namespace NanSu
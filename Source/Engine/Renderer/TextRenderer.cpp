@@ -0,0 +1,48 @@
+#include "EnginePCH.h"
+#include "Renderer/TextRenderer.h"
+#include "Renderer/Font.h"
+#include "Renderer/Renderer2D.h"
+#include "Renderer/SubTexture2D.h"
+
+namespace NanSu
+{
+    void TextRenderer::DrawString(std::string_view text, Font* font, const vec3& position,
+                                  float32 size, const vec4& color)
+    {
+        mat4 transform = glm::translate(mat4(1.0f), position)
+                       * glm::scale(mat4(1.0f), { size, size, 1.0f });
+        DrawString(text, font, transform, color);
+    }
+
+    void TextRenderer::DrawString(std::string_view text, Font* font, const mat4& transform,
+                                  const vec4& color)
+    {
+        NS_ENGINE_ASSERT(font, "Font is null");
+        if (!font->IsLoaded() || text.empty())
+        {
+            return;
+        }
+
+        const TextLayout& layout = font->GetLayout(text);
+
+        // New glyphs may have been baked while laying out
+        font->UploadAtlas();
+
+        for (const TextLayout::GlyphQuad& quad : layout.Quads)
+        {
+            Renderer2D::DrawGlyphQuad(transform, quad.Min, quad.Max, *quad.Region, color);
+        }
+    }
+
+    vec2 TextRenderer::MeasureString(std::string_view text, Font* font, float32 size)
+    {
+        NS_ENGINE_ASSERT(font, "Font is null");
+        if (!font->IsLoaded())
+        {
+            return vec2(0.0f);
+        }
+
+        return font->GetLayout(text).Size * size;
+    }
+
+} // namespace NanSu
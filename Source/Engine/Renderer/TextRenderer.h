@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Core/Math.h"
+
+#include <string_view>
+
+namespace NanSu
+{
+    // Forward declarations
+    class Font;
+
+    /**
+     * @brief World-space text drawn through the Renderer2D batch
+     *
+     * Strings are laid out once per font (see Font::GetLayout) and emitted as
+     * signed-distance-field glyph quads into the Renderer2D text batch, so
+     * many labels share a handful of draw calls and stay crisp under camera
+     * zoom. Must be called between Renderer2D::BeginScene() and EndScene().
+     *
+     * Example usage:
+     * @code
+     * Renderer2D::BeginScene(camera);
+     * TextRenderer::DrawString("Score: 42", font, {-1.5f, 0.8f, 0.0f}, 0.1f);
+     * Renderer2D::EndScene();
+     * @endcode
+     */
+    class TextRenderer
+    {
+    public:
+        // Non-instantiable static class
+        TextRenderer() = delete;
+
+        /**
+         * @brief Draw a UTF-8 string
+         * @param text The string ('\n' starts a new line)
+         * @param font The font to draw with
+         * @param position Left end of the first baseline (x, y, z)
+         * @param size Font height in world units
+         * @param color Text color
+         */
+        static void DrawString(std::string_view text, Font* font, const vec3& position,
+                               float32 size, const vec4& color = vec4(1.0f));
+
+        /**
+         * @brief Draw a UTF-8 string with an arbitrary transform
+         * @param text The string ('\n' starts a new line)
+         * @param font The font to draw with
+         * @param transform Maps font units (1.0 = font height, origin at the first baseline) to world space
+         * @param color Text color
+         */
+        static void DrawString(std::string_view text, Font* font, const mat4& transform,
+                               const vec4& color = vec4(1.0f));
+
+        /**
+         * @brief Measure a string without drawing it
+         * @return Width and height in world units for the given font height
+         */
+        static vec2 MeasureString(std::string_view text, Font* font, float32 size);
+    };
+
+} // namespace NanSu
@@ -87,6 +87,15 @@ namespace NanSu
          */
         virtual void SetData(const void* data, uint32 size) = 0;
 
+        /**
+         * @brief Reload the texture from its file
+         * @return true if the texture was replaced
+         *
+         * On failure the previous contents are kept. Textures created with
+         * Create(width, height) cannot be reloaded.
+         */
+        virtual bool Reload() = 0;
+
         /**
          * @brief Create a 2D texture from a file
          * @param filePath Path to the image file (PNG, JPG, BMP, TGA, etc.)
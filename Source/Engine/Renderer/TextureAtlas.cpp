@@ -0,0 +1,197 @@
+#include "EnginePCH.h"
+#include "Renderer/TextureAtlas.h"
+#include "Renderer/Texture.h"
+#include "Asset/AssetSystem.h"
+
+#include <stb_image.h>
+
+#include <cstring>
+
+namespace NanSu
+{
+    namespace
+    {
+        constexpr uint32 BYTES_PER_PIXEL = 4;
+    }
+
+    TextureAtlas::TextureAtlas(uint32 pageSize, uint32 padding)
+        : m_PageSize(pageSize)
+        , m_Padding(padding)
+    {
+        NS_ENGINE_ASSERT(pageSize > 2 * padding, "Atlas page size {} is too small for padding {}", pageSize, padding);
+    }
+
+    TextureAtlas::~TextureAtlas()
+    {
+        for (auto& page : m_Pages)
+        {
+            delete page->Texture;
+            page->Texture = nullptr;
+        }
+    }
+
+    // =========================================================================
+    // Images
+    // =========================================================================
+
+    const SubTexture2D* TextureAtlas::Add(const std::string& name, const void* rgba, uint32 width, uint32 height)
+    {
+        if (const SubTexture2D* existing = Find(name))
+        {
+            NS_ENGINE_WARN("Texture atlas already contains '{}'", name);
+            return existing;
+        }
+
+        uint32 paddedWidth = width + 2 * m_Padding;
+        uint32 paddedHeight = height + 2 * m_Padding;
+        if (width == 0 || height == 0 || paddedWidth > m_PageSize || paddedHeight > m_PageSize)
+        {
+            NS_ENGINE_ERROR("Image '{}' ({}x{}) does not fit a {}x{} atlas page",
+                            name, width, height, m_PageSize, m_PageSize);
+            return nullptr;
+        }
+
+        // First fit over the open pages; only the last pages usually have room left
+        Page* target = nullptr;
+        uint32 x = 0;
+        uint32 y = 0;
+        for (auto& page : m_Pages)
+        {
+            if (page->Packer.Pack(paddedWidth, paddedHeight, x, y))
+            {
+                target = page.get();
+                break;
+            }
+        }
+
+        if (!target)
+        {
+            target = &CreatePage();
+            bool packed = target->Packer.Pack(paddedWidth, paddedHeight, x, y);
+            NS_ENGINE_ASSERT(packed, "Image must fit an empty atlas page");
+        }
+
+        Blit(*target, x, y, static_cast<const byte*>(rgba), width, height);
+
+        float32 pageSize = static_cast<float32>(m_PageSize);
+        vec2 min(static_cast<float32>(x + m_Padding) / pageSize,
+                 static_cast<float32>(y + m_Padding) / pageSize);
+        vec2 max(static_cast<float32>(x + m_Padding + width) / pageSize,
+                 static_cast<float32>(y + m_Padding + height) / pageSize);
+
+        auto [it, inserted] = m_Images.emplace(name, std::make_unique<SubTexture2D>(target->Texture, min, max));
+        return it->second.get();
+    }
+
+    const SubTexture2D* TextureAtlas::AddFromFile(const std::string& name, const std::string& filePath)
+    {
+        if (const SubTexture2D* existing = Find(name))
+        {
+            return existing;
+        }
+
+        AssetData fileData = AssetSystem::Load(filePath);
+        if (!fileData.IsValid())
+        {
+            NS_ENGINE_ERROR("Failed to load atlas image: {}", filePath);
+            return nullptr;
+        }
+
+        // Same row order as Texture2D::Create(filePath)
+        stbi_set_flip_vertically_on_load(true);
+
+        int width, height, channels;
+        stbi_uc* data = stbi_load_from_memory(
+            fileData.GetData(),
+            static_cast<int>(fileData.GetSize()),
+            &width,
+            &height,
+            &channels,
+            STBI_rgb_alpha  // Force 4 channels (RGBA)
+        );
+
+        if (!data)
+        {
+            NS_ENGINE_ERROR("Failed to load atlas image: {}", filePath);
+            NS_ENGINE_ERROR("stbi_failure_reason: {}", stbi_failure_reason());
+            return nullptr;
+        }
+
+        const SubTexture2D* image = Add(name, data, static_cast<uint32>(width), static_cast<uint32>(height));
+        stbi_image_free(data);
+        return image;
+    }
+
+    const SubTexture2D* TextureAtlas::Find(const std::string& name) const
+    {
+        auto it = m_Images.find(name);
+        return it != m_Images.end() ? it->second.get() : nullptr;
+    }
+
+    // =========================================================================
+    // GPU
+    // =========================================================================
+
+    void TextureAtlas::Upload()
+    {
+        for (auto& page : m_Pages)
+        {
+            if (!page->Dirty)
+            {
+                continue;
+            }
+
+            page->Texture->SetData(page->Pixels.data(), static_cast<uint32>(page->Pixels.size()));
+            page->Dirty = false;
+        }
+    }
+
+    // =========================================================================
+    // Pages
+    // =========================================================================
+
+    TextureAtlas::Page& TextureAtlas::CreatePage()
+    {
+        auto page = std::make_unique<Page>();
+        page->Pixels.resize(static_cast<usize>(m_PageSize) * m_PageSize * BYTES_PER_PIXEL, 0);
+        page->Texture = Texture2D::Create(m_PageSize, m_PageSize);
+        page->Packer.Reset(m_PageSize, m_PageSize);
+
+        NS_ENGINE_INFO("Texture atlas page {} created ({}x{})", m_Pages.size(), m_PageSize, m_PageSize);
+
+        m_Pages.push_back(std::move(page));
+        return *m_Pages.back();
+    }
+
+    void TextureAtlas::Blit(Page& page, uint32 x, uint32 y, const byte* rgba, uint32 width, uint32 height)
+    {
+        const usize pageStride = static_cast<usize>(m_PageSize) * BYTES_PER_PIXEL;
+        const usize rowBytes = static_cast<usize>(width) * BYTES_PER_PIXEL;
+        const uint32 paddedHeight = height + 2 * m_Padding;
+
+        for (uint32 row = 0; row < paddedHeight; ++row)
+        {
+            // Padding rows repeat the nearest edge row of the image
+            uint32 sourceRow = row < m_Padding ? 0 : std::min(row - m_Padding, height - 1);
+            const byte* source = rgba + sourceRow * rowBytes;
+            byte* destination = page.Pixels.data() + (y + row) * pageStride + static_cast<usize>(x) * BYTES_PER_PIXEL;
+
+            // Left padding, image row, right padding
+            for (uint32 i = 0; i < m_Padding; ++i)
+            {
+                std::memcpy(destination + i * BYTES_PER_PIXEL, source, BYTES_PER_PIXEL);
+            }
+
+            std::memcpy(destination + m_Padding * BYTES_PER_PIXEL, source, rowBytes);
+
+            const byte* lastPixel = source + rowBytes - BYTES_PER_PIXEL;
+            for (uint32 i = 0; i < m_Padding; ++i)
+            {
+                std::memcpy(destination + (m_Padding + width + i) * BYTES_PER_PIXEL, lastPixel, BYTES_PER_PIXEL);
+            }
+        }
+
+        page.Dirty = true;
+    }
+
+} // namespace NanSu
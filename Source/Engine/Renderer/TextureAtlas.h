@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Renderer/SkylinePacker.h"
+#include "Renderer/SubTexture2D.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NanSu
+{
+    // Forward declarations
+    class Texture2D;
+
+    /**
+     * @brief Runtime texture atlas that packs many small images into large pages
+     *
+     * Images are placed with a skyline packer into RGBA pages (2048x2048 by
+     * default); a new page is opened when the current ones are full. Each image
+     * is surrounded by padding filled with its own edge pixels (extrusion), so
+     * bilinear filtering and mipmapping never bleed a neighbour's colors into a
+     * sprite. Pixels are kept on the CPU and pages are uploaded on Upload(),
+     * only when something was added since the last upload.
+     *
+     * Sprites from one page share a texture, so Renderer2D draws them in the
+     * same batch using one texture slot.
+     *
+     * Example usage:
+     * @code
+     * TextureAtlas atlas;
+     * const SubTexture2D* coin = atlas.AddFromFile("coin", "../../Assets/Textures/coin.png");
+     * const SubTexture2D* gem = atlas.Add("gem", pixels, 16, 16);
+     * atlas.Upload();
+     *
+     * Renderer2D::DrawQuad({0.0f, 0.0f}, {1.0f, 1.0f}, *coin);
+     * @endcode
+     */
+    class TextureAtlas
+    {
+    public:
+        static constexpr uint32 DEFAULT_PAGE_SIZE = 2048;
+        static constexpr uint32 DEFAULT_PADDING = 2;
+
+        /**
+         * @brief Create an empty atlas (pages are allocated on first use)
+         * @param pageSize Width and height of each page in pixels
+         * @param padding Extruded border around each image in pixels
+         */
+        explicit TextureAtlas(uint32 pageSize = DEFAULT_PAGE_SIZE, uint32 padding = DEFAULT_PADDING);
+        ~TextureAtlas();
+
+        // Non-copyable (sub-textures point at the page textures)
+        TextureAtlas(const TextureAtlas&) = delete;
+        TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+        /**
+         * @brief Pack an image into the atlas
+         * @param name Unique name used by Find()
+         * @param rgba Pixel data, 4 bytes per pixel, rows in Texture2D::SetData order
+         * @param width Image width in pixels
+         * @param height Image height in pixels
+         * @return The packed region (valid for the atlas lifetime), or nullptr if it does not fit a page
+         *
+         * Adding a name that already exists returns the existing region.
+         */
+        const SubTexture2D* Add(const std::string& name, const void* rgba, uint32 width, uint32 height);
+
+        /**
+         * @brief Load an image file and pack it into the atlas
+         * @param name Unique name used by Find()
+         * @param filePath Path to the image (resolved through AssetSystem)
+         * @return The packed region, or nullptr if loading or packing failed
+         */
+        const SubTexture2D* AddFromFile(const std::string& name, const std::string& filePath);
+
+        /**
+         * @brief Look up a previously added image
+         * @return The packed region, or nullptr if no image has this name
+         */
+        const SubTexture2D* Find(const std::string& name) const;
+
+        /**
+         * @brief Upload pages that changed since the last upload
+         *
+         * Call after adding images and before drawing them.
+         */
+        void Upload();
+
+        uint32 GetPageCount() const { return static_cast<uint32>(m_Pages.size()); }
+        Texture2D* GetPageTexture(uint32 index) const { return m_Pages[index]->Texture; }
+        uint32 GetPageSize() const { return m_PageSize; }
+        usize GetImageCount() const { return m_Images.size(); }
+
+    private:
+        struct Page
+        {
+            std::vector<byte> Pixels;       // RGBA8, m_PageSize * m_PageSize
+            Texture2D* Texture = nullptr;
+            SkylinePacker Packer;
+            bool Dirty = false;
+        };
+
+        /**
+         * @brief Open a new, empty page
+         */
+        Page& CreatePage();
+
+        /**
+         * @brief Copy an image into a page and extrude its edges into the padding
+         * @param x Left edge of the padded rectangle
+         * @param y Top edge of the padded rectangle
+         */
+        void Blit(Page& page, uint32 x, uint32 y, const byte* rgba, uint32 width, uint32 height);
+
+    private:
+        uint32 m_PageSize;
+        uint32 m_Padding;
+
+        std::vector<std::unique_ptr<Page>> m_Pages;
+        std::unordered_map<std::string, std::unique_ptr<SubTexture2D>> m_Images;
+    };
+
+} // namespace NanSu
@@ -0,0 +1,337 @@
+#include "EnginePCH.h"
+#include "Renderer/TileMap.h"
+#include "Renderer/Shader.h"
+#include "Renderer/Buffer.h"
+#include "Renderer/Texture.h"
+#include "Renderer/RenderCommand.h"
+#include "Renderer/Renderer2D.h"
+#include "Renderer/OrthographicCamera.h"
+
+#include <algorithm>
+
+namespace NanSu
+{
+    namespace
+    {
+        // Tile vertex structure (20 bytes per vertex)
+        struct TileVertex
+        {
+            vec3 Position;          // 12 bytes
+            vec2 TexCoord;          // 8 bytes
+        };
+
+        constexpr uint32 TILES_PER_CHUNK = TileMap::CHUNK_SIZE * TileMap::CHUNK_SIZE;
+
+        const BufferLayout& GetTileVertexLayout()
+        {
+            static const BufferLayout s_Layout = {
+                { ShaderDataType::Float3, "Position" },
+                { ShaderDataType::Float2, "TexCoord" }
+            };
+            return s_Layout;
+        }
+    }
+
+    TileMap::TileMap(uint32 width, uint32 height, float32 tileSize)
+        : m_Width(width)
+        , m_Height(height)
+        , m_ChunksX((width + CHUNK_SIZE - 1) / CHUNK_SIZE)
+        , m_ChunksY((height + CHUNK_SIZE - 1) / CHUNK_SIZE)
+        , m_TileSize(tileSize)
+    {
+        NS_ENGINE_ASSERT(width > 0 && height > 0, "Tile map must not be empty");
+
+        m_Chunks.resize(static_cast<usize>(m_ChunksX) * m_ChunksY);
+
+        // Same SceneData layout as Renderer2D.hlsl; relies on the constant buffer bound by BeginScene
+        m_Shader = Shader::Create("../../Assets/Shaders/TileMap.hlsl");
+        m_Shader->SetInputLayout(GetTileVertexLayout());
+
+        // Index pattern for a completely filled chunk; partial chunks draw a prefix of it
+        std::vector<uint32> indices(TILES_PER_CHUNK * 6);
+        for (uint32 quad = 0; quad < TILES_PER_CHUNK; ++quad)
+        {
+            uint32 offset = quad * 4;
+            uint32* index = &indices[quad * 6];
+            index[0] = offset + 0;
+            index[1] = offset + 2;
+            index[2] = offset + 1;
+            index[3] = offset + 0;
+            index[4] = offset + 3;
+            index[5] = offset + 2;
+        }
+        m_IndexBuffer = IndexBuffer::Create(indices.data(), static_cast<uint32>(indices.size()));
+
+        // Pixel art tiles: no filtering across tile borders
+        m_State.Filter = SamplerFilter::Point;
+        m_State.Wrap = SamplerWrap::Clamp;
+
+        NS_ENGINE_INFO("TileMap created: {}x{} tiles, {}x{} chunks", m_Width, m_Height, m_ChunksX, m_ChunksY);
+    }
+
+    TileMap::~TileMap()
+    {
+        for (Chunk& chunk : m_Chunks)
+        {
+            delete chunk.Buffer;
+            chunk.Buffer = nullptr;
+        }
+
+        delete m_IndexBuffer;
+        m_IndexBuffer = nullptr;
+
+        delete m_Shader;
+        m_Shader = nullptr;
+    }
+
+    // =========================================================================
+    // Tiles
+    // =========================================================================
+
+    uint16 TileMap::AddTile(const SubTexture2D& region)
+    {
+        NS_ENGINE_ASSERT(region.GetTexture(), "Tile region has no texture");
+        NS_ENGINE_ASSERT(!m_Texture || m_Texture == region.GetTexture(),
+                         "All tiles of a TileMap must come from the same texture");
+        NS_ENGINE_ASSERT(m_TileSet.size() < Limits::UInt16Max, "Too many tile types");
+
+        m_Texture = region.GetTexture();
+        m_TileSet.push_back(region);
+        return static_cast<uint16>(m_TileSet.size());
+    }
+
+    void TileMap::SetTile(uint32 x, uint32 y, uint16 tile)
+    {
+        NS_ENGINE_ASSERT(x < m_Width && y < m_Height, "Tile ({}, {}) is outside the map", x, y);
+        NS_ENGINE_ASSERT(tile <= m_TileSet.size(), "Unknown tile id {}", tile);
+
+        Chunk& chunk = GetChunk(x / CHUNK_SIZE, y / CHUNK_SIZE);
+        if (chunk.Tiles.empty())
+        {
+            if (tile == EMPTY_TILE)
+            {
+                return;
+            }
+
+            chunk.Tiles.assign(TILES_PER_CHUNK, EMPTY_TILE);
+        }
+
+        uint16& slot = chunk.Tiles[(y % CHUNK_SIZE) * CHUNK_SIZE + (x % CHUNK_SIZE)];
+        if (slot == tile)
+        {
+            return;
+        }
+
+        slot = tile;
+        chunk.Dirty = true;
+    }
+
+    uint16 TileMap::GetTile(uint32 x, uint32 y) const
+    {
+        NS_ENGINE_ASSERT(x < m_Width && y < m_Height, "Tile ({}, {}) is outside the map", x, y);
+
+        const Chunk& chunk = m_Chunks[(y / CHUNK_SIZE) * m_ChunksX + (x / CHUNK_SIZE)];
+        if (chunk.Tiles.empty())
+        {
+            return EMPTY_TILE;
+        }
+
+        return chunk.Tiles[(y % CHUNK_SIZE) * CHUNK_SIZE + (x % CHUNK_SIZE)];
+    }
+
+    void TileMap::SetOrigin(const vec3& origin)
+    {
+        if (origin == m_Origin)
+        {
+            return;
+        }
+
+        // Vertex positions are baked in world space
+        m_Origin = origin;
+        for (Chunk& chunk : m_Chunks)
+        {
+            chunk.Dirty = true;
+        }
+    }
+
+    // =========================================================================
+    // Rendering
+    // =========================================================================
+
+    void TileMap::Render(const OrthographicCamera& camera)
+    {
+        m_Stats = {};
+        ++m_FrameIndex;
+
+        if (!m_Texture)
+        {
+            return;
+        }
+
+        // World-space bounds of the view (handles camera rotation)
+        mat4 inverseViewProjection = glm::inverse(camera.GetViewProjectionMatrix());
+        vec2 viewMin(std::numeric_limits<float32>::max());
+        vec2 viewMax(std::numeric_limits<float32>::lowest());
+        const vec2 ndcCorners[4] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };
+        for (const vec2& corner : ndcCorners)
+        {
+            vec4 world = inverseViewProjection * vec4(corner, 0.0f, 1.0f);
+            vec2 point = vec2(world) / world.w;
+            viewMin = glm::min(viewMin, point);
+            viewMax = glm::max(viewMax, point);
+        }
+
+        // Visible chunk range
+        float32 chunkWorldSize = m_TileSize * CHUNK_SIZE;
+        vec2 chunkMin = glm::floor((viewMin - vec2(m_Origin)) / chunkWorldSize);
+        vec2 chunkMax = glm::floor((viewMax - vec2(m_Origin)) / chunkWorldSize);
+        if (chunkMax.x < 0.0f || chunkMax.y < 0.0f ||
+            chunkMin.x >= static_cast<float32>(m_ChunksX) || chunkMin.y >= static_cast<float32>(m_ChunksY))
+        {
+            EvictToBudget();
+            return;
+        }
+
+        uint32 firstX = static_cast<uint32>(std::max(chunkMin.x, 0.0f));
+        uint32 firstY = static_cast<uint32>(std::max(chunkMin.y, 0.0f));
+        uint32 lastX = static_cast<uint32>(std::min(chunkMax.x, static_cast<float32>(m_ChunksX - 1)));
+        uint32 lastY = static_cast<uint32>(std::min(chunkMax.y, static_cast<float32>(m_ChunksY - 1)));
+
+        // Keep draw order with quads submitted before the map
+        Renderer2D::Flush();
+
+        RenderCommand::SetPipelineState(m_State);
+        m_Shader->Bind();
+        m_Texture->Bind(0);
+        m_IndexBuffer->Bind();
+
+        for (uint32 chunkY = firstY; chunkY <= lastY; ++chunkY)
+        {
+            for (uint32 chunkX = firstX; chunkX <= lastX; ++chunkX)
+            {
+                Chunk& chunk = GetChunk(chunkX, chunkY);
+                chunk.LastVisibleFrame = m_FrameIndex;
+                m_Stats.VisibleChunks++;
+
+                if (chunk.Tiles.empty())
+                {
+                    continue;
+                }
+
+                if (chunk.Dirty)
+                {
+                    RebuildChunk(chunk, chunkX, chunkY);
+                }
+
+                if (chunk.IndexCount == 0)
+                {
+                    continue;
+                }
+
+                chunk.Buffer->Bind();
+                RenderCommand::DrawIndexed(m_IndexBuffer, chunk.IndexCount);
+                m_Stats.DrawCalls++;
+            }
+        }
+
+        EvictToBudget();
+    }
+
+    void TileMap::RebuildChunk(Chunk& chunk, uint32 chunkX, uint32 chunkY)
+    {
+        ReleaseChunk(chunk);
+
+        std::vector<TileVertex> vertices;
+        vertices.reserve(TILES_PER_CHUNK * 4);
+
+        for (uint32 localY = 0; localY < CHUNK_SIZE; ++localY)
+        {
+            for (uint32 localX = 0; localX < CHUNK_SIZE; ++localX)
+            {
+                uint16 tile = chunk.Tiles[localY * CHUNK_SIZE + localX];
+                if (tile == EMPTY_TILE)
+                {
+                    continue;
+                }
+
+                vec3 min = m_Origin + vec3(static_cast<float32>(chunkX * CHUNK_SIZE + localX) * m_TileSize,
+                                           static_cast<float32>(chunkY * CHUNK_SIZE + localY) * m_TileSize,
+                                           0.0f);
+                vec3 max = min + vec3(m_TileSize, m_TileSize, 0.0f);
+                const vec2* texCoords = m_TileSet[tile - 1].GetTexCoords();
+
+                // BL, BR, TR, TL (same order and winding as Renderer2D quads)
+                vertices.push_back({ { min.x, min.y, min.z }, texCoords[0] });
+                vertices.push_back({ { max.x, min.y, min.z }, texCoords[1] });
+                vertices.push_back({ { max.x, max.y, min.z }, texCoords[2] });
+                vertices.push_back({ { min.x, max.y, min.z }, texCoords[3] });
+            }
+        }
+
+        chunk.Dirty = false;
+        if (vertices.empty())
+        {
+            return;
+        }
+
+        chunk.BufferBytes = static_cast<uint32>(vertices.size() * sizeof(TileVertex));
+        chunk.Buffer = VertexBuffer::Create(vertices.data(), chunk.BufferBytes);
+        chunk.Buffer->SetLayout(GetTileVertexLayout());
+        chunk.IndexCount = static_cast<uint32>(vertices.size() / 4 * 6);
+
+        m_ResidentBytes += chunk.BufferBytes;
+        m_ResidentChunks.push_back(static_cast<uint32>(&chunk - m_Chunks.data()));
+        m_Stats.RebuiltChunks++;
+    }
+
+    void TileMap::ReleaseChunk(Chunk& chunk)
+    {
+        if (!chunk.Buffer)
+        {
+            return;
+        }
+
+        delete chunk.Buffer;
+        chunk.Buffer = nullptr;
+        chunk.IndexCount = 0;
+
+        m_ResidentBytes -= chunk.BufferBytes;
+        chunk.BufferBytes = 0;
+
+        uint32 chunkIndex = static_cast<uint32>(&chunk - m_Chunks.data());
+        auto it = std::find(m_ResidentChunks.begin(), m_ResidentChunks.end(), chunkIndex);
+        NS_ENGINE_ASSERT(it != m_ResidentChunks.end(), "Resident chunk list is out of sync");
+        *it = m_ResidentChunks.back();
+        m_ResidentChunks.pop_back();
+    }
+
+    void TileMap::EvictToBudget()
+    {
+        if (m_ResidentBytes > m_MemoryBudget)
+        {
+            // Least recently visible first; chunks visible this frame are never evicted
+            std::vector<uint32> candidates = m_ResidentChunks;
+            std::sort(candidates.begin(), candidates.end(), [this](uint32 a, uint32 b)
+            {
+                return m_Chunks[a].LastVisibleFrame < m_Chunks[b].LastVisibleFrame;
+            });
+
+            for (uint32 chunkIndex : candidates)
+            {
+                Chunk& chunk = m_Chunks[chunkIndex];
+                if (m_ResidentBytes <= m_MemoryBudget || chunk.LastVisibleFrame == m_FrameIndex)
+                {
+                    break;
+                }
+
+                ReleaseChunk(chunk);
+                chunk.Dirty = true;  // Rebuilt from its tiles when it comes back into view
+                m_Stats.EvictedChunks++;
+            }
+        }
+
+        m_Stats.ResidentChunks = static_cast<uint32>(m_ResidentChunks.size());
+        m_Stats.ResidentBytes = m_ResidentBytes;
+    }
+
+} // namespace NanSu
@@ -0,0 +1,189 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Core/Math.h"
+#include "Renderer/PipelineState.h"
+#include "Renderer/SubTexture2D.h"
+
+#include <vector>
+
+namespace NanSu
+{
+    // Forward declarations
+    class OrthographicCamera;
+    class Shader;
+    class VertexBuffer;
+    class IndexBuffer;
+    class Texture2D;
+
+    /**
+     * @brief Large tile grid rendered as cached, per-chunk static vertex buffers
+     *
+     * Tiles are stored in CHUNK_SIZE x CHUNK_SIZE chunks. A chunk's geometry
+     * is built once into a static vertex buffer and reused every frame until
+     * one of its tiles changes. Render() only visits the chunks overlapping
+     * the camera view, rebuilding those that are dirty, and draws each with a
+     * single call. Buffers of chunks that have not been visible recently are
+     * released when the resident geometry exceeds the memory budget, so cost
+     * and memory follow what is on screen rather than the map size.
+     *
+     * All tiles come from one texture (a sprite sheet or one TextureAtlas
+     * page). Tile ids index the regions registered with AddTile(); id 0 is
+     * the empty tile.
+     *
+     * Example usage:
+     * @code
+     * TileMap map(4096, 4096, 0.5f);
+     * uint16 grass = map.AddTile(SubTexture2D::CreateFromCoords(sheet, {0, 0}, {16, 16}));
+     * map.SetTile(10, 20, grass);
+     *
+     * Renderer2D::BeginScene(camera);
+     * map.Render(camera);
+     * Renderer2D::EndScene();
+     * @endcode
+     */
+    class TileMap
+    {
+    public:
+        static constexpr uint32 CHUNK_SIZE = 32;
+        static constexpr uint16 EMPTY_TILE = 0;
+        static constexpr usize DEFAULT_MEMORY_BUDGET = 64 * 1024 * 1024;  // Resident vertex data in bytes
+
+        /**
+         * @brief Create an empty map
+         * @param width Map width in tiles
+         * @param height Map height in tiles
+         * @param tileSize Edge length of one tile in world units
+         */
+        TileMap(uint32 width, uint32 height, float32 tileSize = 1.0f);
+        ~TileMap();
+
+        // Non-copyable
+        TileMap(const TileMap&) = delete;
+        TileMap& operator=(const TileMap&) = delete;
+
+        // =====================================================================
+        // Tiles
+        // =====================================================================
+
+        /**
+         * @brief Register a tile image
+         * @param region Region of the shared tile texture
+         * @return The tile id to use with SetTile()
+         */
+        uint16 AddTile(const SubTexture2D& region);
+
+        /**
+         * @brief Set a tile (marks its chunk for rebuild if the id changes)
+         * @param x Column, 0 = left
+         * @param y Row, 0 = bottom
+         * @param tile Tile id, or EMPTY_TILE
+         */
+        void SetTile(uint32 x, uint32 y, uint16 tile);
+        uint16 GetTile(uint32 x, uint32 y) const;
+
+        uint32 GetWidth() const { return m_Width; }
+        uint32 GetHeight() const { return m_Height; }
+        float32 GetTileSize() const { return m_TileSize; }
+
+        // =====================================================================
+        // Rendering
+        // =====================================================================
+
+        /**
+         * @brief Draw the chunks visible to the camera
+         *
+         * Call between Renderer2D::BeginScene() and EndScene(); the pending
+         * Renderer2D batch is flushed first so the map keeps its draw order.
+         */
+        void Render(const OrthographicCamera& camera);
+
+        /**
+         * @brief World position of the bottom-left corner of tile (0, 0)
+         */
+        void SetOrigin(const vec3& origin);
+        const vec3& GetOrigin() const { return m_Origin; }
+
+        /**
+         * @brief Set the maximum size of resident chunk geometry in bytes
+         */
+        void SetMemoryBudget(usize bytes) { m_MemoryBudget = bytes; }
+        usize GetMemoryBudget() const { return m_MemoryBudget; }
+
+        /**
+         * @brief Render state of the map (point filtering and clamping by default)
+         */
+        PipelineState& GetPipelineState() { return m_State; }
+
+        // =====================================================================
+        // Statistics
+        // =====================================================================
+
+        /**
+         * @brief Statistics of the last Render() call
+         */
+        struct Statistics
+        {
+            uint32 VisibleChunks = 0;
+            uint32 DrawCalls = 0;
+            uint32 RebuiltChunks = 0;
+            uint32 EvictedChunks = 0;
+            uint32 ResidentChunks = 0;
+            usize ResidentBytes = 0;
+        };
+
+        const Statistics& GetStats() const { return m_Stats; }
+
+    private:
+        struct Chunk
+        {
+            std::vector<uint16> Tiles;          // Empty until the first non-empty tile is set
+            VertexBuffer* Buffer = nullptr;     // Resident geometry, nullptr when evicted
+            uint32 IndexCount = 0;
+            uint32 BufferBytes = 0;
+            uint64 LastVisibleFrame = 0;
+            bool Dirty = true;
+        };
+
+        Chunk& GetChunk(uint32 chunkX, uint32 chunkY) { return m_Chunks[chunkY * m_ChunksX + chunkX]; }
+
+        /**
+         * @brief Regenerate a chunk's vertex buffer from its tiles
+         */
+        void RebuildChunk(Chunk& chunk, uint32 chunkX, uint32 chunkY);
+
+        /**
+         * @brief Release the geometry of a chunk (its tiles are kept)
+         */
+        void ReleaseChunk(Chunk& chunk);
+
+        /**
+         * @brief Release least recently visible chunks until within budget
+         */
+        void EvictToBudget();
+
+    private:
+        uint32 m_Width;
+        uint32 m_Height;
+        uint32 m_ChunksX;
+        uint32 m_ChunksY;
+        float32 m_TileSize;
+        vec3 m_Origin = vec3(0.0f);
+
+        std::vector<Chunk> m_Chunks;
+        std::vector<SubTexture2D> m_TileSet;    // Tile id N is m_TileSet[N - 1]
+        Texture2D* m_Texture = nullptr;
+
+        Shader* m_Shader = nullptr;
+        IndexBuffer* m_IndexBuffer = nullptr;   // Quad pattern for one full chunk
+        PipelineState m_State;
+
+        usize m_MemoryBudget = DEFAULT_MEMORY_BUDGET;
+        usize m_ResidentBytes = 0;
+        std::vector<uint32> m_ResidentChunks;   // Indices of chunks that hold a buffer
+        uint64 m_FrameIndex = 0;
+
+        Statistics m_Stats;
+    };
+
+} // namespace NanSu
@@ -0,0 +1,8 @@
+// =============================================================================
+// stb_truetype Implementation
+// =============================================================================
+// This file compiles the stb_truetype library implementation.
+// Only one .cpp file in the project should define STB_TRUETYPE_IMPLEMENTATION.
+
+#define STB_TRUETYPE_IMPLEMENTATION
+#include "stb_truetype.h"
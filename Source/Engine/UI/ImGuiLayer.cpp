@@ -3,16 +3,21 @@
 #include "Core/Application.h"
 
 #include <imgui.h>
+
+#ifdef NS_PLATFORM_WINDOWS
 #include <imgui_impl_win32.h>
 #include <imgui_impl_dx11.h>
 
 #include <d3d11.h>
+#endif
 
 namespace NanSu
 {
     ImGuiLayer::ImGuiLayer()
         : Layer("ImGuiLayer")
     {
+        // Only input can be captured by ImGui
+        SetEventInterest(EventTypesInCategory(EventCategoryMouse | EventCategoryKeyboard));
     }
 
     void ImGuiLayer::OnAttach()
@@ -24,7 +29,10 @@ namespace NanSu
         ImGuiIO& io = ImGui::GetIO();
         io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
         io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+#ifdef NS_PLATFORM_WINDOWS
+        // Extra platform windows need the Win32 backend
         io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+#endif
 
         // Setup Dear ImGui style
         ImGui::StyleColorsDark();
@@ -37,6 +45,7 @@ namespace NanSu
             style.Colors[ImGuiCol_WindowBg].w = 1.0f;
         }
 
+#ifdef NS_PLATFORM_WINDOWS
         // Get window and graphics context
         Application& app = Application::Get();
         HWND hwnd = static_cast<HWND>(app.GetWindow().GetNativeWindow());
@@ -50,14 +59,24 @@ namespace NanSu
         // Setup Platform/Renderer backends
         ImGui_ImplWin32_Init(hwnd);
         ImGui_ImplDX11_Init(device, deviceContext);
+#else
+        // No backend: frames are built and discarded, so the font atlas is
+        // built here instead of by a renderer backend
+        unsigned char* fontPixels = nullptr;
+        int fontWidth = 0;
+        int fontHeight = 0;
+        io.Fonts->GetTexDataAsRGBA32(&fontPixels, &fontWidth, &fontHeight);
+#endif
 
         NS_ENGINE_INFO("ImGuiLayer attached");
     }
 
     void ImGuiLayer::OnDetach()
     {
+#ifdef NS_PLATFORM_WINDOWS
         ImGui_ImplDX11_Shutdown();
         ImGui_ImplWin32_Shutdown();
+#endif
         ImGui::DestroyContext();
 
         NS_ENGINE_INFO("ImGuiLayer detached");
@@ -65,8 +84,17 @@ namespace NanSu
 
     void ImGuiLayer::Begin()
     {
+#ifdef NS_PLATFORM_WINDOWS
         ImGui_ImplDX11_NewFrame();
         ImGui_ImplWin32_NewFrame();
+#else
+        // Normally set by the platform backend; DeltaTime keeps ImGui's fixed default
+        Application& app = Application::Get();
+        ImGui::GetIO().DisplaySize = ImVec2(
+            static_cast<float>(app.GetWindow().GetWidth()),
+            static_cast<float>(app.GetWindow().GetHeight())
+        );
+#endif
         ImGui::NewFrame();
     }
 
@@ -82,9 +110,11 @@ namespace NanSu
         // Rendering
         ImGui::Render();
 
+#ifdef NS_PLATFORM_WINDOWS
         // Bind the main render target before rendering ImGui
         app.GetGraphicsContext().BindRenderTarget();
         ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+#endif
 
         // Update and Render additional Platform Windows
         if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
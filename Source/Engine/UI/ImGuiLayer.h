@@ -10,6 +10,9 @@ namespace NanSu
      * Manages ImGui initialization, frame lifecycle, and input handling.
      * Should be pushed as an overlay to ensure it renders on top and
      * receives events first.
+     *
+     * Uses the Win32/DX11 backends on Windows. Elsewhere the renderer runs
+     * headless, so ImGui frames are built and their draw data discarded.
      */
     class ImGuiLayer : public Layer
     {
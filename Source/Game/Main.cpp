@@ -20,7 +20,7 @@ public:
 
     void OnUpdate() override
     {
-        if (NanSu::Input::IsKeyPressed(NanSu::KeyCode::Space))
+        if (NanSu::Input::GetState().WasKeyPressedThisFrame(NanSu::KeyCode::Space))
         {
             NS_INFO("Space key pressed!");
         }
@@ -0,0 +1,87 @@
+// =============================================================================
+// Application tests
+// =============================================================================
+//
+// Runs the real main loop against the headless window and renderer, with
+// events injected through HeadlessWindow. Builds whose Window::Create()
+// returns a native window (Windows) skip these tests.
+// =============================================================================
+
+#include "EnginePCH.h"
+#include "Core/Application.h"
+#include "Events/WindowEvent.h"
+#include "Platform/Headless/HeadlessWindow.h"
+#include "TestFramework.h"
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+using namespace NanSu;
+
+namespace
+{
+    /**
+     * @brief Find the directory the Game runs from, so "../../Assets" paths resolve
+     */
+    bool FindGameDirectory(fs::path& outDirectory)
+    {
+        std::error_code ec;
+        for (fs::path directory = fs::current_path(ec); !directory.empty(); directory = directory.parent_path())
+        {
+            if (fs::exists(directory / "Assets" / "Shaders" / "Renderer2D.hlsl", ec))
+            {
+                outDirectory = directory / "Source" / "Game";
+                return true;
+            }
+
+            if (directory == directory.parent_path())
+            {
+                break;
+            }
+        }
+        return false;
+    }
+
+    void TestMinimizedPowerSavingBlocks()
+    {
+        Application app;
+        app.SetPowerSaving(true);
+        app.SetIdleFrameRate(30.0f);
+
+        // Minimized from the first frame; only the close event can wake the loop again
+        constexpr uint64 CLOSE_FRAME = 1000000;
+        auto& window = static_cast<HeadlessWindow&>(app.GetWindow());
+        window.QueueEvent(WindowResizeEvent(0, 0), 0);
+        window.QueueEvent(WindowCloseEvent(), CLOSE_FRAME);
+
+        app.Run();
+
+        // A blocking wait skips straight to the close frame instead of
+        // pumping the window once per idle frame
+        NS_TEST_CHECK(window.GetFrameIndex() >= CLOSE_FRAME);
+        NS_TEST_CHECK(window.GetUpdateCount() < 10);
+        NS_TEST_CHECK(app.GetFrameCount() <= 1);
+    }
+}
+
+void NanSu::Tests::RunApplicationTests()
+{
+#ifdef NS_PLATFORM_WINDOWS
+    std::printf("[SKIP] Application tests need the headless window\n");
+#else
+    fs::path gameDirectory;
+    if (!FindGameDirectory(gameDirectory))
+    {
+        std::printf("[SKIP] Application tests: Assets directory not found above the working directory\n");
+        return;
+    }
+
+    std::error_code ec;
+    fs::path workingDirectory = fs::current_path(ec);
+    fs::current_path(gameDirectory, ec);
+
+    TestMinimizedPowerSavingBlocks();
+
+    fs::current_path(workingDirectory, ec);
+#endif
+}
@@ -0,0 +1,253 @@
+// =============================================================================
+// AssetPack tests
+// =============================================================================
+//
+// Writes small packs with the same layout as Tools/AssetPacker (header,
+// TOC sorted by path hash, string table, aligned payloads), then checks
+// lookups and decompression, and that truncated packs, out-of-range offsets,
+// inconsistent sizes and unsorted tables are rejected by AssetPack::Open.
+// =============================================================================
+
+#include "EnginePCH.h"
+#include "Asset/AssetPack.h"
+#include "Asset/Compression.h"
+#include "TestFramework.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+using namespace NanSu;
+
+namespace
+{
+    struct PackSource
+    {
+        std::string Path;
+        std::vector<byte> Data;
+        bool Compress = false;
+    };
+
+    /**
+     * @brief Serialize a pack in memory, TOC sorted by hash like the packer
+     */
+    std::vector<byte> BuildPack(std::vector<PackSource> sources)
+    {
+        std::sort(sources.begin(), sources.end(), [](const PackSource& a, const PackSource& b)
+        {
+            return HashAssetPath(a.Path) < HashAssetPath(b.Path);
+        });
+
+        AssetPackHeader header;
+        header.EntryCount = static_cast<uint32>(sources.size());
+
+        std::vector<AssetPackEntry> entries(sources.size());
+        std::string stringTable;
+        std::vector<std::vector<byte>> payloads(sources.size());
+        for (usize i = 0; i < sources.size(); ++i)
+        {
+            AssetPackEntry& entry = entries[i];
+            entry.PathHash = HashAssetPath(sources[i].Path);
+            entry.NameOffset = static_cast<uint32>(stringTable.size());
+            entry.NameLength = static_cast<uint32>(sources[i].Path.size());
+            entry.OriginalSize = sources[i].Data.size();
+            stringTable += sources[i].Path;
+
+            if (sources[i].Compress)
+            {
+                Compression::CompressBlock(sources[i].Data.data(), sources[i].Data.size(), payloads[i]);
+                entry.Flags = AssetPackEntryFlags_Compressed;
+            }
+            else
+            {
+                payloads[i] = sources[i].Data;
+            }
+            entry.StoredSize = payloads[i].size();
+        }
+
+        header.StringTableOffset = sizeof(AssetPackHeader) + sizeof(AssetPackEntry) * entries.size();
+        header.StringTableSize = static_cast<uint32>(stringTable.size());
+
+        std::vector<byte> pack(header.StringTableOffset + stringTable.size());
+        for (usize i = 0; i < entries.size(); ++i)
+        {
+            usize aligned = (pack.size() + ASSET_PACK_PAYLOAD_ALIGNMENT - 1) & ~usize(ASSET_PACK_PAYLOAD_ALIGNMENT - 1);
+            entries[i].Offset = aligned;
+            pack.resize(aligned);
+            pack.insert(pack.end(), payloads[i].begin(), payloads[i].end());
+        }
+
+        std::memcpy(pack.data(), &header, sizeof(header));
+        std::memcpy(pack.data() + sizeof(header), entries.data(), sizeof(AssetPackEntry) * entries.size());
+        std::memcpy(pack.data() + header.StringTableOffset, stringTable.data(), stringTable.size());
+        return pack;
+    }
+
+    AssetPackEntry* GetEntry(std::vector<byte>& pack, usize index)
+    {
+        return reinterpret_cast<AssetPackEntry*>(pack.data() + sizeof(AssetPackHeader)) + index;
+    }
+
+    bool OpenBytes(AssetPack& pack, const fs::path& path, const std::vector<byte>& bytes)
+    {
+        pack.Close();
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        }
+        return pack.Open(path.string());
+    }
+
+    std::vector<PackSource> MakeSources()
+    {
+        std::vector<byte> text(5000);
+        for (usize i = 0; i < text.size(); ++i)
+        {
+            text[i] = static_cast<byte>("abcabcabd"[i % 9]);
+        }
+
+        return {
+            { "textures/a.nstex", { 1, 2, 3, 4, 5 }, false },
+            { "shaders/b.hlsl", text, true },
+            { "scenes/c.nsscene", {}, false },
+            { "scenes/d.nsscene", std::vector<byte>(1000, 7), true },
+        };
+    }
+
+    void TestValidPack(const fs::path& path)
+    {
+        std::vector<PackSource> sources = MakeSources();
+        std::vector<byte> bytes = BuildPack(sources);
+
+        AssetPack pack;
+        NS_TEST_CHECK(OpenBytes(pack, path, bytes));
+        NS_TEST_CHECK(pack.GetEntryCount() == sources.size());
+
+        for (const PackSource& source : sources)
+        {
+            const AssetPackEntry* entry = pack.Find(source.Path);
+            NS_TEST_CHECK(entry != nullptr);
+            if (!entry)
+            {
+                continue;
+            }
+
+            NS_TEST_CHECK(pack.GetEntryName(*entry) == source.Path);
+            if (entry->Flags & AssetPackEntryFlags_Compressed)
+            {
+                std::vector<byte> data;
+                NS_TEST_CHECK(pack.Decompress(*entry, data));
+                NS_TEST_CHECK(data == source.Data);
+            }
+            else
+            {
+                std::span<const byte> stored = pack.GetStoredData(*entry);
+                NS_TEST_CHECK(std::vector<byte>(stored.begin(), stored.end()) == source.Data);
+            }
+        }
+
+        NS_TEST_CHECK(pack.Find("textures/missing.nstex") == nullptr);
+    }
+
+    void TestTruncatedPack(const fs::path& path)
+    {
+        std::vector<byte> bytes = BuildPack(MakeSources());
+        AssetPack pack;
+
+        // Every prefix cuts into the header, the TOC, the string table or the last payload
+        for (usize size = 0; size < bytes.size(); size += 1 + size / 4)
+        {
+            std::vector<byte> truncated(bytes.begin(), bytes.begin() + size);
+            NS_TEST_CHECK(!OpenBytes(pack, path, truncated));
+        }
+    }
+
+    void TestCorruptPack(const fs::path& path)
+    {
+        const std::vector<byte> valid = BuildPack(MakeSources());
+        AssetPack pack;
+
+        {
+            std::vector<byte> bytes = valid;
+            bytes[0] ^= 0xFF;
+            NS_TEST_CHECK(!OpenBytes(pack, path, bytes));
+        }
+        {
+            // Offset + StoredSize wraps around to a small value
+            std::vector<byte> bytes = valid;
+            GetEntry(bytes, 0)->Offset = ~uint64(0) - 3;
+            NS_TEST_CHECK(!OpenBytes(pack, path, bytes));
+        }
+        {
+            std::vector<byte> bytes = valid;
+            GetEntry(bytes, 0)->StoredSize = ~uint64(0);
+            NS_TEST_CHECK(!OpenBytes(pack, path, bytes));
+        }
+        {
+            // String table offset wraps around
+            std::vector<byte> bytes = valid;
+            reinterpret_cast<AssetPackHeader*>(bytes.data())->StringTableOffset = ~uint64(0) - 1;
+            NS_TEST_CHECK(!OpenBytes(pack, path, bytes));
+        }
+        {
+            std::vector<byte> bytes = valid;
+            reinterpret_cast<AssetPackHeader*>(bytes.data())->EntryCount = 0x7FFFFFFF;
+            NS_TEST_CHECK(!OpenBytes(pack, path, bytes));
+        }
+        {
+            std::vector<byte> bytes = valid;
+            GetEntry(bytes, 1)->NameLength = 0xFFFFFFFF;
+            NS_TEST_CHECK(!OpenBytes(pack, path, bytes));
+        }
+    }
+
+    void TestInconsistentSizes(const fs::path& path)
+    {
+        const std::vector<byte> valid = BuildPack(MakeSources());
+        AssetPack pack;
+
+        for (usize i = 0; i < 4; ++i)
+        {
+            std::vector<byte> bytes = valid;
+            AssetPackEntry* entry = GetEntry(bytes, i);
+            if (entry->Flags & AssetPackEntryFlags_Compressed)
+            {
+                // More than the codec could ever expand StoredSize to
+                entry->OriginalSize = Compression::GetDecompressBound(static_cast<usize>(entry->StoredSize)) + 1;
+            }
+            else
+            {
+                entry->OriginalSize = entry->StoredSize + 1;
+            }
+            NS_TEST_CHECK(!OpenBytes(pack, path, bytes));
+        }
+    }
+
+    void TestUnsortedPack(const fs::path& path)
+    {
+        std::vector<byte> bytes = BuildPack(MakeSources());
+        std::swap(*GetEntry(bytes, 0), *GetEntry(bytes, 3));
+
+        AssetPack pack;
+        NS_TEST_CHECK(!OpenBytes(pack, path, bytes));
+    }
+}
+
+void NanSu::Tests::RunAssetPackTests()
+{
+    fs::path root = fs::temp_directory_path() / "NanSuAssetPackTests";
+    std::error_code ec;
+    fs::remove_all(root, ec);
+    fs::create_directories(root, ec);
+    fs::path path = root / "Test.nspak";
+
+    TestValidPack(path);
+    TestTruncatedPack(path);
+    TestCorruptPack(path);
+    TestInconsistentSizes(path);
+    TestUnsortedPack(path);
+
+    fs::remove_all(root, ec);
+}
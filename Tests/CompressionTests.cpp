@@ -0,0 +1,141 @@
+// =============================================================================
+// Compression tests
+// =============================================================================
+//
+// Round-trips random, incompressible, repetitive and empty inputs through the
+// block codec, and feeds DecompressBlock truncated and corrupt blocks, which
+// must be rejected without reading or writing out of bounds.
+// =============================================================================
+
+#include "EnginePCH.h"
+#include "Asset/Compression.h"
+#include "TestFramework.h"
+
+#include <random>
+
+using namespace NanSu;
+
+namespace
+{
+    bool RoundTrip(const std::vector<byte>& input)
+    {
+        std::vector<byte> compressed;
+        Compression::CompressBlock(input.data(), input.size(), compressed);
+        NS_TEST_CHECK(compressed.size() <= Compression::GetCompressBound(input.size()));
+        NS_TEST_CHECK(input.size() <= Compression::GetDecompressBound(compressed.size()));
+
+        std::vector<byte> output(input.size());
+        if (!Compression::DecompressBlock(compressed.data(), compressed.size(), output.data(), output.size()))
+        {
+            return false;
+        }
+        return output == input;
+    }
+
+    std::vector<byte> MakeRandom(usize size, uint32 seed)
+    {
+        std::mt19937 rng(seed);
+        std::vector<byte> data(size);
+        for (byte& value : data)
+        {
+            value = static_cast<byte>(rng());
+        }
+        return data;
+    }
+
+    std::vector<byte> MakeRepetitive(usize size)
+    {
+        // Short runs and repeated phrases exercise literals, matches and long lengths
+        static constexpr char PHRASE[] = "NanSu asset payload ";
+        std::vector<byte> data(size);
+        for (usize i = 0; i < size; ++i)
+        {
+            data[i] = (i / 4096) % 2 == 0 ? static_cast<byte>(PHRASE[i % (sizeof(PHRASE) - 1)]) : byte(0);
+        }
+        return data;
+    }
+
+    void TestRoundTrip()
+    {
+        NS_TEST_CHECK(RoundTrip({}));
+        NS_TEST_CHECK(RoundTrip({ 42 }));
+
+        // Random data is incompressible: output must stay within the bound
+        for (usize size : { usize(5), usize(13), usize(255), usize(256), usize(70000), usize(1 << 20) })
+        {
+            NS_TEST_CHECK(RoundTrip(MakeRandom(size, static_cast<uint32>(size))));
+        }
+
+        for (usize size : { usize(12), usize(64), usize(100000), usize(1 << 20) })
+        {
+            NS_TEST_CHECK(RoundTrip(MakeRepetitive(size)));
+        }
+
+        std::vector<byte> zeros(300000, 0);
+        std::vector<byte> compressed;
+        Compression::CompressBlock(zeros.data(), zeros.size(), compressed);
+        NS_TEST_CHECK(compressed.size() < zeros.size() / 100);
+        NS_TEST_CHECK(RoundTrip(zeros));
+    }
+
+    void TestTruncatedInput()
+    {
+        std::vector<byte> input = MakeRepetitive(20000);
+        std::vector<byte> compressed;
+        Compression::CompressBlock(input.data(), input.size(), compressed);
+
+        std::vector<byte> output(input.size());
+        for (usize size = 0; size < compressed.size(); size += 1 + size / 8)
+        {
+            NS_TEST_CHECK(!Compression::DecompressBlock(compressed.data(), size, output.data(), output.size()));
+        }
+    }
+
+    void TestCorruptInput()
+    {
+        std::vector<byte> input = MakeRepetitive(20000);
+        std::vector<byte> compressed;
+        Compression::CompressBlock(input.data(), input.size(), compressed);
+
+        std::vector<byte> output(input.size());
+
+        // Wrong expected size, either way
+        NS_TEST_CHECK(!Compression::DecompressBlock(compressed.data(), compressed.size(), output.data(), output.size() - 1));
+        output.resize(input.size() + 1);
+        NS_TEST_CHECK(!Compression::DecompressBlock(compressed.data(), compressed.size(), output.data(), output.size()));
+        output.resize(input.size());
+
+        // A match offset of zero, and one reaching before the start of the output
+        const byte zeroOffset[] = { 0x10, 'a', 0x00, 0x00, 0x50, 'b', 'c', 'd', 'e', 'f' };
+        NS_TEST_CHECK(!Compression::DecompressBlock(zeroOffset, sizeof(zeroOffset), output.data(), 10));
+        const byte farOffset[] = { 0x10, 'a', 0x08, 0x00, 0x50, 'b', 'c', 'd', 'e', 'f' };
+        NS_TEST_CHECK(!Compression::DecompressBlock(farOffset, sizeof(farOffset), output.data(), 10));
+
+        // A literal run claiming more bytes than the block holds
+        const byte longLiterals[] = { 0xF0, 0xFF, 0xFF, 0x10, 'a' };
+        NS_TEST_CHECK(!Compression::DecompressBlock(longLiterals, sizeof(longLiterals), output.data(), output.size()));
+
+        // Random noise must never decode (or crash) as a valid block of the expected size
+        std::vector<byte> noise = MakeRandom(4096, 7);
+        for (usize i = 0; i < 64; ++i)
+        {
+            noise[i] ^= static_cast<byte>(i);
+            NS_TEST_CHECK(!Compression::DecompressBlock(noise.data(), noise.size(), output.data(), output.size()));
+        }
+
+        // Flipped bytes inside a valid block must not crash the decoder
+        for (usize i = 0; i < compressed.size(); i += 7)
+        {
+            std::vector<byte> flipped = compressed;
+            flipped[i] ^= 0xA5;
+            Compression::DecompressBlock(flipped.data(), flipped.size(), output.data(), output.size());
+        }
+    }
+}
+
+void NanSu::Tests::RunCompressionTests()
+{
+    TestRoundTrip();
+    TestTruncatedInput();
+    TestCorruptInput();
+}
@@ -0,0 +1,104 @@
+// =============================================================================
+// EventCoalescer tests
+// =============================================================================
+//
+// Pushes mixed event sequences and checks that only directly adjacent moves,
+// scrolls and resizes are merged, that the order of everything else is kept,
+// and that events pushed while flushing are dispatched in the same flush.
+// =============================================================================
+
+#include "EnginePCH.h"
+#include "Events/ApplicationEvent.h"
+#include "Events/EventCoalescer.h"
+#include "Events/KeyEvent.h"
+#include "Events/MouseEvent.h"
+#include "Events/WindowEvent.h"
+#include "TestFramework.h"
+
+using namespace NanSu;
+
+namespace
+{
+    std::vector<std::string> FlushToStrings(EventCoalescer& coalescer)
+    {
+        std::vector<std::string> lines;
+        coalescer.Flush([&](Event& event) { lines.push_back(event.ToString()); });
+        return lines;
+    }
+
+    void TestMergesAdjacentRuns()
+    {
+        EventCoalescer coalescer;
+        NS_TEST_CHECK(coalescer.Push(MouseMovedEvent(1.0f, 1.0f)));
+        NS_TEST_CHECK(coalescer.Push(MouseMovedEvent(2.0f, 3.0f)));
+        NS_TEST_CHECK(coalescer.Push(MouseMovedEvent(4.0f, 5.0f)));
+        NS_TEST_CHECK(coalescer.Push(KeyPressedEvent('A', false)));
+        NS_TEST_CHECK(coalescer.Push(MouseMovedEvent(6.0f, 7.0f)));
+        NS_TEST_CHECK(coalescer.Push(MouseScrolledEvent(1.0f, 0.0f)));
+        NS_TEST_CHECK(coalescer.Push(MouseScrolledEvent(0.5f, 2.0f)));
+        NS_TEST_CHECK(coalescer.Push(MouseScrolledEvent(0.0f, -1.0f)));
+        NS_TEST_CHECK(coalescer.Push(WindowResizeEvent(800, 600)));
+        NS_TEST_CHECK(coalescer.Push(WindowResizeEvent(1024, 768)));
+        NS_TEST_CHECK(coalescer.Push(WindowCloseEvent()));
+        NS_TEST_CHECK(coalescer.Push(WindowCloseEvent()));
+
+        NS_TEST_CHECK(coalescer.GetPendingCount() == 7);
+        NS_TEST_CHECK(coalescer.GetMergedCount() == 5);
+
+        NS_TEST_CHECK(FlushToStrings(coalescer) == std::vector<std::string>({
+            MouseMovedEvent(4.0f, 5.0f).ToString(),
+            KeyPressedEvent('A', false).ToString(),
+            MouseMovedEvent(6.0f, 7.0f).ToString(),
+            MouseScrolledEvent(1.5f, 1.0f).ToString(),
+            WindowResizeEvent(1024, 768).ToString(),
+            WindowCloseEvent().ToString(),
+            WindowCloseEvent().ToString(),
+        }));
+        NS_TEST_CHECK(coalescer.GetPendingCount() == 0);
+
+        // Runs do not continue across flushes
+        NS_TEST_CHECK(coalescer.Push(WindowResizeEvent(640, 480)));
+        NS_TEST_CHECK(coalescer.GetPendingCount() == 1);
+        NS_TEST_CHECK(coalescer.GetMergedCount() == 5);
+        NS_TEST_CHECK(FlushToStrings(coalescer) == std::vector<std::string>({
+            WindowResizeEvent(640, 480).ToString(),
+        }));
+    }
+
+    void TestRejectsEngineEvents()
+    {
+        EventCoalescer coalescer;
+        NS_TEST_CHECK(!coalescer.Push(AppUpdateEvent(0.016f)));
+        NS_TEST_CHECK(coalescer.GetPendingCount() == 0);
+    }
+
+    void TestPushDuringFlush()
+    {
+        EventCoalescer coalescer;
+        coalescer.Push(KeyPressedEvent(256, false));
+
+        // e.g. a layer closing the window from a key handler
+        std::vector<std::string> lines;
+        coalescer.Flush([&](Event& event)
+        {
+            lines.push_back(event.ToString());
+            if (event.GetEventType() == EventType::KeyPressed)
+            {
+                coalescer.Push(WindowCloseEvent());
+            }
+        });
+
+        NS_TEST_CHECK(lines == std::vector<std::string>({
+            KeyPressedEvent(256, false).ToString(),
+            WindowCloseEvent().ToString(),
+        }));
+        NS_TEST_CHECK(coalescer.GetPendingCount() == 0);
+    }
+}
+
+void NanSu::Tests::RunEventCoalescerTests()
+{
+    TestMergesAdjacentRuns();
+    TestRejectsEngineEvents();
+    TestPushDuringFlush();
+}
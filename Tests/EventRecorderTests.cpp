@@ -0,0 +1,153 @@
+// =============================================================================
+// EventRecorder tests
+// =============================================================================
+//
+// Records a few frames, replays them and checks that every frame returns the
+// same events in the same order with its timestep and input hash, including
+// empty frames, truncated logs and logs that fail validation.
+// =============================================================================
+
+#include "EnginePCH.h"
+#include "Events/ApplicationEvent.h"
+#include "Events/EventRecorder.h"
+#include "Events/KeyEvent.h"
+#include "Events/MouseEvent.h"
+#include "Events/WindowEvent.h"
+#include "TestFramework.h"
+
+#include <cstddef>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+using namespace NanSu;
+
+namespace
+{
+    std::vector<std::string> ReplayFrame(EventReplayer& replayer, bool& outHasFrame)
+    {
+        std::vector<std::string> lines;
+        outHasFrame = replayer.NextFrame([&](Event& event) { lines.push_back(event.ToString()); });
+        return lines;
+    }
+
+    void RecordSession(const fs::path& path)
+    {
+        EventRecorder recorder;
+        NS_TEST_CHECK(!recorder.IsRecording());
+        NS_TEST_CHECK(recorder.Start(path.string()));
+        NS_TEST_CHECK(recorder.IsRecording());
+
+        recorder.Record(WindowResizeEvent(1280, 720));
+        recorder.Record(KeyPressedEvent('W', false));
+        recorder.EndFrame(1.0 / 60.0, 0x1111);
+
+        recorder.EndFrame(1.0 / 30.0, 0x2222);
+
+        recorder.Record(MouseMovedEvent(12.5f, -3.0f));
+        recorder.Record(AppUpdateEvent(0.016f));    // Engine-generated: not recorded
+        recorder.Record(MouseScrolledEvent(0.0f, 1.0f));
+        recorder.Record(KeyTypedEvent(119));
+        recorder.EndFrame(0.25, 0x3333);
+
+        NS_TEST_CHECK(recorder.GetFrameCount() == 3);
+        recorder.Stop();
+        NS_TEST_CHECK(!recorder.IsRecording());
+
+        // Events after Stop() are dropped
+        recorder.Record(WindowCloseEvent());
+        recorder.EndFrame(1.0, 0x4444);
+        NS_TEST_CHECK(recorder.GetFrameCount() == 3);
+    }
+
+    void TestRoundTrip(const fs::path& path)
+    {
+        RecordSession(path);
+
+        EventReplayer replayer;
+        NS_TEST_CHECK(replayer.Open(path.string()));
+        NS_TEST_CHECK(replayer.IsReplaying());
+        NS_TEST_CHECK(replayer.GetFrameCount() == 3);
+
+        // Nothing replayed yet
+        NS_TEST_CHECK(!replayer.HasCurrentFrame());
+        NS_TEST_CHECK(replayer.GetTimestep() == 0.0);
+        NS_TEST_CHECK(replayer.GetInputHash() == 0);
+
+        bool hasFrame = false;
+        NS_TEST_CHECK(ReplayFrame(replayer, hasFrame) == std::vector<std::string>({
+            WindowResizeEvent(1280, 720).ToString(),
+            KeyPressedEvent('W', false).ToString(),
+        }));
+        NS_TEST_CHECK(hasFrame && replayer.HasCurrentFrame());
+        NS_TEST_CHECK(replayer.GetTimestep() == 1.0 / 60.0);
+        NS_TEST_CHECK(replayer.GetInputHash() == 0x1111);
+
+        NS_TEST_CHECK(ReplayFrame(replayer, hasFrame).empty());
+        NS_TEST_CHECK(hasFrame);
+        NS_TEST_CHECK(replayer.GetTimestep() == 1.0 / 30.0);
+        NS_TEST_CHECK(replayer.GetInputHash() == 0x2222);
+
+        NS_TEST_CHECK(ReplayFrame(replayer, hasFrame) == std::vector<std::string>({
+            MouseMovedEvent(12.5f, -3.0f).ToString(),
+            MouseScrolledEvent(0.0f, 1.0f).ToString(),
+            KeyTypedEvent(119).ToString(),
+        }));
+        NS_TEST_CHECK(hasFrame);
+        NS_TEST_CHECK(replayer.GetTimestep() == 0.25);
+        NS_TEST_CHECK(replayer.GetInputHash() == 0x3333);
+        NS_TEST_CHECK(replayer.GetFrameIndex() == 3);
+
+        // The replay closes itself after the last frame
+        NS_TEST_CHECK(ReplayFrame(replayer, hasFrame).empty());
+        NS_TEST_CHECK(!hasFrame);
+        NS_TEST_CHECK(!replayer.IsReplaying());
+    }
+
+    void TestTruncatedLog(const fs::path& path)
+    {
+        RecordSession(path);
+
+        // Cut into the last frame's events: the complete frames still replay
+        fs::resize_file(path, fs::file_size(path) - sizeof(EventLogRecord) / 2);
+
+        EventReplayer replayer;
+        NS_TEST_CHECK(replayer.Open(path.string()));
+        NS_TEST_CHECK(replayer.GetFrameCount() == 2);
+
+        // Shorter than the header
+        fs::resize_file(path, sizeof(EventLogHeader) - 1);
+        NS_TEST_CHECK(!replayer.Open(path.string()));
+        NS_TEST_CHECK(!replayer.IsReplaying());
+    }
+
+    void TestInvalidLog(const fs::path& path)
+    {
+        RecordSession(path);
+
+        {
+            std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+            uint32 version = EVENT_LOG_VERSION + 1;
+            file.seekp(offsetof(EventLogHeader, Version));
+            file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        }
+
+        EventReplayer replayer;
+        NS_TEST_CHECK(!replayer.Open(path.string()));
+        NS_TEST_CHECK(!replayer.Open((path.parent_path() / "missing.nsevents").string()));
+        NS_TEST_CHECK(!replayer.IsReplaying());
+    }
+}
+
+void NanSu::Tests::RunEventRecorderTests()
+{
+    fs::path root = fs::temp_directory_path() / "NanSuEventRecorderTests";
+    std::error_code ec;
+    fs::create_directories(root, ec);
+    fs::path path = root / "Session.nsevents";
+
+    TestRoundTrip(path);
+    TestTruncatedLog(path);
+    TestInvalidLog(path);
+
+    fs::remove_all(root, ec);
+}
@@ -0,0 +1,169 @@
+// =============================================================================
+// HeadlessWindow tests
+// =============================================================================
+//
+// Drives a short event script plus injected events through the headless
+// window and checks which events each frame delivers, in which order, and
+// how WaitEvents() skips ahead or closes the window.
+// =============================================================================
+
+#include "EnginePCH.h"
+#include "Events/KeyEvent.h"
+#include "Events/MouseEvent.h"
+#include "Events/WindowEvent.h"
+#include "Platform/Headless/HeadlessWindow.h"
+#include "TestFramework.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+using namespace NanSu;
+
+namespace
+{
+    /**
+     * @brief Records "<frame> <event>" for every delivered event
+     */
+    struct EventLog
+    {
+        HeadlessWindow* Window = nullptr;
+        std::vector<std::string> Lines;
+
+        void Attach(HeadlessWindow& window)
+        {
+            Window = &window;
+            window.SetEventCallback([this](Event& event)
+            {
+                Lines.push_back(Format(Window->GetFrameIndex(), event));
+            });
+        }
+
+        static std::string Format(uint64 frame, const Event& event)
+        {
+            return std::to_string(frame) + " " + event.ToString();
+        }
+
+        std::vector<std::string> Take()
+        {
+            return std::exchange(Lines, {});
+        }
+    };
+
+    void TestScript(const fs::path& scriptPath)
+    {
+        {
+            std::ofstream script(scriptPath);
+            script << "# Headless test script\n"
+                   << "0 resize 800 600\n"
+                   << "2 key_down W\n"
+                   << "2 char 119\n"
+                   << "\n"
+                   << "5 mouse_move 10.5 20   # trailing comment\n"
+                   << "5 key_up w\n"
+                   << "not a line\n"
+                   << "6 unknown_command\n";
+        }
+
+        HeadlessWindow window({ "Headless", 1280, 720 });
+        EventLog log;
+        log.Attach(window);
+
+        NS_TEST_CHECK(!window.LoadScript((scriptPath.parent_path() / "missing.txt").string()));
+        NS_TEST_CHECK(window.LoadScript(scriptPath.string()));
+        NS_TEST_CHECK(window.GetPendingEventCount() == 5);
+
+        // Injected after the script: delivered after the script's frame 2 events
+        window.QueueEvent(WindowFocusEvent(), 2);
+        window.QueueEvent(WindowLostFocusEvent(), 1);
+        NS_TEST_CHECK(window.GetPendingEventCount() == 7);
+
+        // Frame 0
+        window.OnUpdate();
+        NS_TEST_CHECK(window.GetFrameIndex() == 1);
+        NS_TEST_CHECK(window.GetWidth() == 800 && window.GetHeight() == 600);
+        NS_TEST_CHECK(log.Take() == std::vector<std::string>({
+            EventLog::Format(0, WindowResizeEvent(800, 600)),
+        }));
+
+        // Frames 1 and 2
+        window.OnUpdate();
+        window.OnUpdate();
+        NS_TEST_CHECK(window.GetFrameIndex() == 3);
+        NS_TEST_CHECK(log.Take() == std::vector<std::string>({
+            EventLog::Format(1, WindowLostFocusEvent()),
+            EventLog::Format(2, KeyPressedEvent('W', false)),
+            EventLog::Format(2, KeyTypedEvent(119)),
+            EventLog::Format(2, WindowFocusEvent()),
+        }));
+
+        // Finite waits never skip frames
+        NS_TEST_CHECK(!window.WaitEvents(0.0));
+        NS_TEST_CHECK(window.GetFrameIndex() == 3);
+        NS_TEST_CHECK(log.Take().empty());
+
+        // An infinite wait skips ahead to the frame of the next event
+        NS_TEST_CHECK(window.WaitEvents(-1.0));
+        NS_TEST_CHECK(window.GetFrameIndex() == 5);
+        NS_TEST_CHECK(window.GetUpdateCount() == 3);
+        NS_TEST_CHECK(log.Take() == std::vector<std::string>({
+            EventLog::Format(5, MouseMovedEvent(10.5f, 20.0f)),
+            EventLog::Format(5, KeyReleasedEvent('W')),
+        }));
+        NS_TEST_CHECK(window.GetPendingEventCount() == 0);
+
+        window.OnUpdate();
+        NS_TEST_CHECK(window.GetFrameIndex() == 6);
+        NS_TEST_CHECK(log.Take().empty());
+
+        // Events queued for a frame that already started wake a finite wait
+        window.QueueEvent(MouseScrolledEvent(0.0f, 1.0f), 2);
+        NS_TEST_CHECK(window.WaitEvents(0.0));
+        NS_TEST_CHECK(log.Take() == std::vector<std::string>({
+            EventLog::Format(6, MouseScrolledEvent(0.0f, 1.0f)),
+        }));
+
+        // Nothing scheduled: an infinite wait closes the window instead of hanging
+        NS_TEST_CHECK(window.WaitEvents(-1.0));
+        NS_TEST_CHECK(window.GetFrameIndex() == 6);
+        NS_TEST_CHECK(log.Take() == std::vector<std::string>({
+            EventLog::Format(6, WindowCloseEvent()),
+        }));
+    }
+
+    void TestEventsQueuedFromCallback()
+    {
+        HeadlessWindow window({ "Headless", 1280, 720 });
+        std::vector<std::string> lines;
+
+        // A callback scheduling an event for the current frame gets it in the same pump
+        window.SetEventCallback([&](Event& event)
+        {
+            lines.push_back(EventLog::Format(window.GetFrameIndex(), event));
+            if (event.GetEventType() == EventType::KeyPressed)
+            {
+                window.QueueEvent(KeyReleasedEvent('A'), window.GetFrameIndex());
+            }
+        });
+
+        window.QueueEvent(KeyPressedEvent('A', false), 0);
+        window.OnUpdate();
+        NS_TEST_CHECK(lines == std::vector<std::string>({
+            EventLog::Format(0, KeyPressedEvent('A', false)),
+            EventLog::Format(0, KeyReleasedEvent('A')),
+        }));
+        NS_TEST_CHECK(window.GetPendingEventCount() == 0);
+    }
+}
+
+void NanSu::Tests::RunHeadlessWindowTests()
+{
+    fs::path root = fs::temp_directory_path() / "NanSuHeadlessWindowTests";
+    std::error_code ec;
+    fs::create_directories(root, ec);
+
+    TestScript(root / "Script.txt");
+    TestEventsQueuedFromCallback();
+
+    fs::remove_all(root, ec);
+}
@@ -0,0 +1,205 @@
+// =============================================================================
+// ShaderCache tests
+// =============================================================================
+//
+// Drives ShaderCache::Compile with a fake compiler that counts its calls, so
+// hits, misses and key invalidation are observable without a GPU backend.
+// =============================================================================
+
+#include "EnginePCH.h"
+#include "Renderer/ShaderCache.h"
+#include "TestFramework.h"
+
+#include <cstdio>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+using namespace NanSu;
+
+namespace
+{
+    /**
+     * @brief Fake backend compiler: bytecode is derived from the request
+     */
+    struct FakeCompiler
+    {
+        uint32 Calls = 0;
+        bool Fail = false;
+
+        ShaderCompileFunc AsFunc()
+        {
+            return [this](const ShaderCompileRequest& request, std::vector<byte>& outBytecode)
+            {
+                ++Calls;
+                if (Fail)
+                {
+                    return false;
+                }
+                outBytecode.assign(request.Source.begin(), request.Source.end());
+                outBytecode.insert(outBytecode.end(), request.EntryPoint.begin(), request.EntryPoint.end());
+                return true;
+            };
+        }
+    };
+
+    ShaderCompileRequest MakeRequest(std::string_view source)
+    {
+        ShaderCompileRequest request;
+        request.Source = source;
+        request.SourceName = "Test.hlsl";
+        request.EntryPoint = "VSMain";
+        request.Target = "vs_5_0";
+        request.Defines = { { "NS_TEST", "1" } };
+        request.Flags = 0;
+        request.CompilerId = "fake-1";
+        return request;
+    }
+
+    fs::path GetEntryPath(const fs::path& root, const ShaderCompileRequest& request)
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.nsb", static_cast<unsigned long long>(ShaderCache::ComputeKey(request)));
+        return root / ("v" + std::to_string(SHADER_CACHE_VERSION)) / name;
+    }
+
+    void TestMissThenHit(FakeCompiler& compiler)
+    {
+        ShaderCompileRequest request = MakeRequest("float4 main() : SV_Position { return 0; }");
+        std::vector<byte> first, second;
+
+        NS_TEST_CHECK(ShaderCache::Compile(request, compiler.AsFunc(), first));
+        NS_TEST_CHECK(compiler.Calls == 1);
+        NS_TEST_CHECK(ShaderCache::GetStatistics().Misses == 1);
+
+        NS_TEST_CHECK(ShaderCache::Compile(request, compiler.AsFunc(), second));
+        NS_TEST_CHECK(compiler.Calls == 1);
+        NS_TEST_CHECK(ShaderCache::GetStatistics().Hits == 1);
+        NS_TEST_CHECK(first == second);
+    }
+
+    void TestKeyInvalidation(FakeCompiler& compiler)
+    {
+        const ShaderCompileRequest base = MakeRequest("float4 main() : SV_Position { return 1; }");
+        std::vector<byte> bytecode;
+        NS_TEST_CHECK(ShaderCache::Compile(base, compiler.AsFunc(), bytecode));
+
+        ShaderCompileRequest variants[6] = { base, base, base, base, base, base };
+        variants[0].Source = "float4 main() : SV_Position { return 2; }";
+        variants[1].EntryPoint = "PSMain";
+        variants[2].Target = "vs_4_0";
+        variants[3].Defines = { { "NS_TEST", "2" } };
+        variants[4].Flags = 1;
+        variants[5].CompilerId = "fake-2";
+
+        for (const ShaderCompileRequest& variant : variants)
+        {
+            uint32 callsBefore = compiler.Calls;
+            NS_TEST_CHECK(ShaderCache::ComputeKey(variant) != ShaderCache::ComputeKey(base));
+            NS_TEST_CHECK(ShaderCache::Compile(variant, compiler.AsFunc(), bytecode));
+            NS_TEST_CHECK(compiler.Calls == callsBefore + 1);
+        }
+
+        // The diagnostic name is not part of the key
+        ShaderCompileRequest renamed = base;
+        renamed.SourceName = "Other.hlsl";
+        uint32 callsBefore = compiler.Calls;
+        NS_TEST_CHECK(ShaderCache::Compile(renamed, compiler.AsFunc(), bytecode));
+        NS_TEST_CHECK(compiler.Calls == callsBefore);
+    }
+
+    void TestCorruptEntryIsMiss(FakeCompiler& compiler, const fs::path& root)
+    {
+        ShaderCompileRequest request = MakeRequest("float4 main() : SV_Position { return 3; }");
+        std::vector<byte> bytecode;
+        NS_TEST_CHECK(ShaderCache::Compile(request, compiler.AsFunc(), bytecode));
+
+        // Claim an enormous payload in the BytecodeSize field (last header field, offset 32)
+        {
+            std::fstream file(GetEntryPath(root, request), std::ios::binary | std::ios::in | std::ios::out);
+            NS_TEST_CHECK(static_cast<bool>(file));
+            uint64 hugeSize = 0xFFFFFFFFFFull;
+            file.seekp(32);
+            file.write(reinterpret_cast<const char*>(&hugeSize), sizeof(hugeSize));
+        }
+
+        uint32 callsBefore = compiler.Calls;
+        NS_TEST_CHECK(ShaderCache::Compile(request, compiler.AsFunc(), bytecode));
+        NS_TEST_CHECK(compiler.Calls == callsBefore + 1);
+
+        // The recompiled entry replaced the corrupt one
+        NS_TEST_CHECK(ShaderCache::Compile(request, compiler.AsFunc(), bytecode));
+        NS_TEST_CHECK(compiler.Calls == callsBefore + 1);
+    }
+
+    void TestFailureIsNotCached(FakeCompiler& compiler)
+    {
+        ShaderCompileRequest request = MakeRequest("this does not compile");
+        std::vector<byte> bytecode;
+
+        compiler.Fail = true;
+        NS_TEST_CHECK(!ShaderCache::Compile(request, compiler.AsFunc(), bytecode));
+        compiler.Fail = false;
+
+        uint32 callsBefore = compiler.Calls;
+        NS_TEST_CHECK(ShaderCache::Compile(request, compiler.AsFunc(), bytecode));
+        NS_TEST_CHECK(compiler.Calls == callsBefore + 1);
+    }
+
+    void TestPruneOldVersions(const fs::path& root)
+    {
+        // Stale cache versions next to unrelated data sharing the root
+        fs::create_directories(root / "v0");
+        std::ofstream(root / "v0" / "0123456789abcdef.nsb") << "stale";
+        fs::create_directories(root / "v9000" / "notes");
+        std::ofstream(root / "v9000" / "readme.txt") << "keep";
+        fs::create_directories(root / "vendor");
+        std::ofstream(root / "vendor" / "data.nsb") << "keep";
+        fs::create_directories(root / "v1a");
+
+        ShaderCache::Initialize(root.string());
+        NS_TEST_CHECK(ShaderCache::IsEnabled());
+        ShaderCache::Shutdown();
+
+        NS_TEST_CHECK(!fs::exists(root / "v0"));
+        NS_TEST_CHECK(fs::exists(root / "v9000" / "readme.txt"));
+        NS_TEST_CHECK(fs::exists(root / "v9000" / "notes"));
+        NS_TEST_CHECK(fs::exists(root / "vendor" / "data.nsb"));
+        NS_TEST_CHECK(fs::exists(root / "v1a"));
+    }
+
+    void TestDisabledForwards(FakeCompiler& compiler)
+    {
+        ShaderCompileRequest request = MakeRequest("float4 main() : SV_Position { return 4; }");
+        std::vector<byte> bytecode;
+
+        for (int i = 0; i < 2; ++i)
+        {
+            uint32 callsBefore = compiler.Calls;
+            NS_TEST_CHECK(ShaderCache::Compile(request, compiler.AsFunc(), bytecode));
+            NS_TEST_CHECK(compiler.Calls == callsBefore + 1);
+        }
+    }
+}
+
+void NanSu::Tests::RunShaderCacheTests()
+{
+    fs::path root = fs::temp_directory_path() / "NanSuShaderCacheTests";
+    std::error_code ec;
+    fs::remove_all(root, ec);
+
+    TestPruneOldVersions(root);
+
+    FakeCompiler compiler;
+    ShaderCache::Initialize(root.string());
+    NS_TEST_CHECK(ShaderCache::IsEnabled());
+
+    TestMissThenHit(compiler);
+    TestKeyInvalidation(compiler);
+    TestCorruptEntryIsMiss(compiler, root);
+    TestFailureIsNotCached(compiler);
+
+    ShaderCache::Shutdown();
+    TestDisabledForwards(compiler);
+
+    fs::remove_all(root, ec);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+// =============================================================================
+// Minimal test framework shared by every Tests/*Tests.cpp file
+// =============================================================================
+//
+// Each file defines one Run<Module>Tests() entry point declared below;
+// TestMain.cpp calls them in order. Failed checks are printed and counted,
+// and the process exits non-zero if any check failed.
+// =============================================================================
+
+#include <cstdio>
+
+namespace NanSu::Tests
+{
+    inline int s_Failures = 0;
+
+    void RunShaderCacheTests();
+    void RunCompressionTests();
+    void RunAssetPackTests();
+    void RunEventCoalescerTests();
+    void RunEventRecorderTests();
+    void RunHeadlessWindowTests();
+    void RunApplicationTests();
+}
+
+#define NS_TEST_CHECK(condition)                                                    \
+    do                                                                              \
+    {                                                                               \
+        if (!(condition))                                                           \
+        {                                                                           \
+            std::printf("[FAIL] %s:%d: %s\n", __FILE__, __LINE__, #condition);      \
+            ++::NanSu::Tests::s_Failures;                                           \
+        }                                                                           \
+    } while (false)
@@ -0,0 +1,48 @@
+// =============================================================================
+// Test runner
+// =============================================================================
+//
+// Runs every test module against a synchronous console-only logger.
+// Returns a non-zero exit code if any check fails.
+// =============================================================================
+
+#include "EnginePCH.h"
+#include "TestFramework.h"
+
+using namespace NanSu;
+
+int main()
+{
+    LoggerSpecification logSpec;
+    logSpec.Async = false;
+    logSpec.FilePath.clear();
+    Logger::Initialize(logSpec);
+
+    struct TestModule
+    {
+        const char* Name;
+        void (*Run)();
+    };
+
+    const TestModule modules[] = {
+        { "ShaderCache", &Tests::RunShaderCacheTests },
+        { "Compression", &Tests::RunCompressionTests },
+        { "AssetPack", &Tests::RunAssetPackTests },
+        { "EventCoalescer", &Tests::RunEventCoalescerTests },
+        { "EventRecorder", &Tests::RunEventRecorderTests },
+        { "HeadlessWindow", &Tests::RunHeadlessWindowTests },
+        { "Application", &Tests::RunApplicationTests },
+    };
+
+    for (const TestModule& module : modules)
+    {
+        int failuresBefore = Tests::s_Failures;
+        module.Run();
+        int failures = Tests::s_Failures - failuresBefore;
+        std::printf(failures == 0 ? "[OK] %s tests passed\n" : "[FAIL] %s: %d checks failed\n", module.Name, failures);
+    }
+
+    Logger::Shutdown();
+
+    return Tests::s_Failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,230 @@
+// =============================================================================
+// NanSu AssetPacker
+// =============================================================================
+//
+// Packs the Assets/ tree into a single memory-mappable archive (.nspak):
+// a hash-sorted table of contents, a string table and 64-byte aligned
+// payloads, each optionally LZ4-compressed.
+//
+// Usage:
+//   AssetPacker <assets directory> <output file> [--no-compress]
+//
+// Example:
+//   AssetPacker ../../Assets ../../Build/Assets.nspak
+//
+// Entries whose data is already compressed (.png, ...) or that the runtime
+// uploads in place (.nstx) are always stored raw so they stay zero-copy.
+// =============================================================================
+
+#include "Core/Types.h"
+#include "Asset/AssetPackFormat.h"
+#include "Asset/Compression.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+using namespace NanSu;
+
+namespace
+{
+    // Compressed payloads must save at least 1/8 of the size to be kept
+    constexpr uint64 MIN_COMPRESSION_SAVING_DIVISOR = 8;
+
+    struct PackInput
+    {
+        std::string Name;
+        fs::path SourcePath;
+        std::vector<byte> Payload;
+        AssetPackEntry Entry;
+    };
+
+    bool ShouldStoreRaw(const fs::path& path)
+    {
+        static const char* s_RawExtensions[] = { ".png", ".jpg", ".jpeg", ".nstx", ".nspak" };
+
+        std::string ext = NormalizeAssetPath(path.extension().string());
+        for (const char* raw : s_RawExtensions)
+        {
+            if (ext == raw)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool ReadFileBytes(const fs::path& path, std::vector<byte>& outData)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            return false;
+        }
+        outData.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    uint64 AlignUp(uint64 value, uint64 alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+// =============================================================================
+// Entry Point
+// =============================================================================
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        std::printf("Usage: AssetPacker <assets directory> <output file> [--no-compress]\n");
+        return 1;
+    }
+
+    fs::path assetsDir = argv[1];
+    fs::path outputPath = argv[2];
+    bool allowCompression = !(argc > 3 && std::strcmp(argv[3], "--no-compress") == 0);
+
+    if (!fs::is_directory(assetsDir))
+    {
+        std::printf("[ERROR] Not a directory: %s\n", assetsDir.string().c_str());
+        return 1;
+    }
+
+    // -------------------------------------------------------------------------
+    // Gather and compress entries
+    // -------------------------------------------------------------------------
+    std::vector<PackInput> inputs;
+    uint64 totalOriginal = 0;
+    uint64 totalStored = 0;
+
+    for (const auto& item : fs::recursive_directory_iterator(assetsDir))
+    {
+        if (!item.is_regular_file())
+        {
+            continue;
+        }
+
+        PackInput input;
+        input.SourcePath = item.path();
+        input.Name = NormalizeAssetPath(fs::relative(item.path(), assetsDir).generic_string());
+
+        std::vector<byte> data;
+        if (!ReadFileBytes(item.path(), data))
+        {
+            std::printf("[ERROR] Failed to read %s\n", item.path().string().c_str());
+            return 1;
+        }
+
+        input.Entry.PathHash = HashAssetPath(input.Name);
+        input.Entry.OriginalSize = data.size();
+
+        if (allowCompression && !ShouldStoreRaw(item.path()) && !data.empty())
+        {
+            std::vector<byte> compressed;
+            Compression::CompressBlock(data.data(), data.size(), compressed);
+
+            uint64 saving = data.size() - std::min<uint64>(compressed.size(), data.size());
+            if (saving >= data.size() / MIN_COMPRESSION_SAVING_DIVISOR && saving > 0)
+            {
+                input.Entry.Flags |= AssetPackEntryFlags_Compressed;
+                data = std::move(compressed);
+            }
+        }
+
+        input.Entry.StoredSize = data.size();
+        input.Payload = std::move(data);
+
+        totalOriginal += input.Entry.OriginalSize;
+        totalStored += input.Entry.StoredSize;
+        inputs.push_back(std::move(input));
+    }
+
+    // Sort by hash so the runtime can binary-search the table of contents
+    std::sort(inputs.begin(), inputs.end(), [](const PackInput& a, const PackInput& b)
+    {
+        return a.Entry.PathHash != b.Entry.PathHash ? a.Entry.PathHash < b.Entry.PathHash : a.Name < b.Name;
+    });
+
+    for (usize i = 1; i < inputs.size(); ++i)
+    {
+        if (inputs[i].Name == inputs[i - 1].Name)
+        {
+            std::printf("[ERROR] Duplicate asset path (paths are case-insensitive): %s\n", inputs[i].Name.c_str());
+            return 1;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Layout: header, table of contents, string table, aligned payloads
+    // -------------------------------------------------------------------------
+    AssetPackHeader header;
+    header.EntryCount = static_cast<uint32>(inputs.size());
+
+    std::string stringTable;
+    for (PackInput& input : inputs)
+    {
+        input.Entry.NameOffset = static_cast<uint32>(stringTable.size());
+        input.Entry.NameLength = static_cast<uint32>(input.Name.size());
+        stringTable += input.Name;
+    }
+
+    header.StringTableOffset = sizeof(AssetPackHeader) + sizeof(AssetPackEntry) * inputs.size();
+    header.StringTableSize = static_cast<uint32>(stringTable.size());
+
+    uint64 offset = header.StringTableOffset + header.StringTableSize;
+    for (PackInput& input : inputs)
+    {
+        offset = AlignUp(offset, ASSET_PACK_PAYLOAD_ALIGNMENT);
+        input.Entry.Offset = offset;
+        offset += input.Entry.StoredSize;
+    }
+
+    std::vector<byte> file(offset, 0);
+    std::memcpy(file.data(), &header, sizeof(header));
+    for (usize i = 0; i < inputs.size(); ++i)
+    {
+        std::memcpy(file.data() + sizeof(header) + i * sizeof(AssetPackEntry), &inputs[i].Entry, sizeof(AssetPackEntry));
+        if (!inputs[i].Payload.empty())
+        {
+            std::memcpy(file.data() + inputs[i].Entry.Offset, inputs[i].Payload.data(), inputs[i].Payload.size());
+        }
+    }
+    std::memcpy(file.data() + header.StringTableOffset, stringTable.data(), stringTable.size());
+
+    std::error_code ec;
+    if (outputPath.has_parent_path())
+    {
+        fs::create_directories(outputPath.parent_path(), ec);
+    }
+
+    std::ofstream stream(outputPath, std::ios::binary);
+    if (!stream)
+    {
+        std::printf("[ERROR] Failed to open %s for writing\n", outputPath.string().c_str());
+        return 1;
+    }
+    stream.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+
+    for (const PackInput& input : inputs)
+    {
+        std::printf("  %-40s %8llu -> %8llu%s\n", input.Name.c_str(),
+                    static_cast<unsigned long long>(input.Entry.OriginalSize),
+                    static_cast<unsigned long long>(input.Entry.StoredSize),
+                    (input.Entry.Flags & AssetPackEntryFlags_Compressed) ? " (lz4)" : "");
+    }
+    std::printf("Packed %zu asset(s) into %s (%llu KB -> %llu KB)\n", inputs.size(),
+                outputPath.string().c_str(),
+                static_cast<unsigned long long>(totalOriginal / 1024),
+                static_cast<unsigned long long>(file.size() / 1024));
+    return 0;
+}
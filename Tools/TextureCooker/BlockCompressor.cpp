@@ -0,0 +1,507 @@
+#include "BlockCompressor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace NanSu::Cooker
+{
+    namespace
+    {
+        // =====================================================================
+        // Shared Helpers
+        // =====================================================================
+
+        uint16 PackRGB565(int32 r, int32 g, int32 b)
+        {
+            int32 r5 = (std::clamp(r, 0, 255) * 31 + 127) / 255;
+            int32 g6 = (std::clamp(g, 0, 255) * 63 + 127) / 255;
+            int32 b5 = (std::clamp(b, 0, 255) * 31 + 127) / 255;
+            return static_cast<uint16>((r5 << 11) | (g6 << 5) | b5);
+        }
+
+        void UnpackRGB565(uint16 c, int32 out[3])
+        {
+            int32 r5 = (c >> 11) & 31;
+            int32 g6 = (c >> 5) & 63;
+            int32 b5 = c & 31;
+            out[0] = (r5 << 3) | (r5 >> 2);
+            out[1] = (g6 << 2) | (g6 >> 4);
+            out[2] = (b5 << 3) | (b5 >> 2);
+        }
+
+        int32 ColorDistance(const int32* a, const byte* b, uint32 channels)
+        {
+            int32 dist = 0;
+            for (uint32 c = 0; c < channels; ++c)
+            {
+                int32 d = a[c] - static_cast<int32>(b[c]);
+                dist += d * d;
+            }
+            return dist;
+        }
+
+        /**
+         * @brief Find endpoints along the principal axis of the block colors
+         *
+         * Power iteration on the covariance matrix gives the dominant axis;
+         * the extreme projections onto it become the two endpoints.
+         */
+        void FindPrincipalEndpoints(const byte pixels[64], uint32 channels, bool skipTransparent,
+                                    float32 outMin[4], float32 outMax[4])
+        {
+            float32 mean[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            uint32 count = 0;
+            for (uint32 i = 0; i < 16; ++i)
+            {
+                if (skipTransparent && pixels[i * 4 + 3] < 128)
+                {
+                    continue;
+                }
+                for (uint32 c = 0; c < channels; ++c)
+                {
+                    mean[c] += pixels[i * 4 + c];
+                }
+                ++count;
+            }
+
+            if (count == 0)
+            {
+                for (uint32 c = 0; c < 4; ++c)
+                {
+                    outMin[c] = outMax[c] = 0.0f;
+                }
+                return;
+            }
+
+            for (uint32 c = 0; c < channels; ++c)
+            {
+                mean[c] /= static_cast<float32>(count);
+            }
+
+            float32 cov[4][4] = {};
+            for (uint32 i = 0; i < 16; ++i)
+            {
+                if (skipTransparent && pixels[i * 4 + 3] < 128)
+                {
+                    continue;
+                }
+                for (uint32 a = 0; a < channels; ++a)
+                {
+                    float32 da = pixels[i * 4 + a] - mean[a];
+                    for (uint32 b = 0; b < channels; ++b)
+                    {
+                        cov[a][b] += da * (pixels[i * 4 + b] - mean[b]);
+                    }
+                }
+            }
+
+            float32 axis[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+            for (uint32 iteration = 0; iteration < 8; ++iteration)
+            {
+                float32 next[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+                for (uint32 a = 0; a < channels; ++a)
+                {
+                    for (uint32 b = 0; b < channels; ++b)
+                    {
+                        next[a] += cov[a][b] * axis[b];
+                    }
+                }
+
+                float32 length = 0.0f;
+                for (uint32 c = 0; c < channels; ++c)
+                {
+                    length = std::max(length, std::abs(next[c]));
+                }
+                if (length < 1e-6f)
+                {
+                    break;
+                }
+                for (uint32 c = 0; c < channels; ++c)
+                {
+                    axis[c] = next[c] / length;
+                }
+            }
+
+            float32 minProj = 1e30f;
+            float32 maxProj = -1e30f;
+            for (uint32 i = 0; i < 16; ++i)
+            {
+                if (skipTransparent && pixels[i * 4 + 3] < 128)
+                {
+                    continue;
+                }
+                float32 proj = 0.0f;
+                for (uint32 c = 0; c < channels; ++c)
+                {
+                    proj += (pixels[i * 4 + c] - mean[c]) * axis[c];
+                }
+                minProj = std::min(minProj, proj);
+                maxProj = std::max(maxProj, proj);
+            }
+
+            float32 axisLengthSq = 0.0f;
+            for (uint32 c = 0; c < channels; ++c)
+            {
+                axisLengthSq += axis[c] * axis[c];
+            }
+            if (axisLengthSq < 1e-12f)
+            {
+                axisLengthSq = 1.0f;
+            }
+
+            for (uint32 c = 0; c < 4; ++c)
+            {
+                if (c < channels)
+                {
+                    outMin[c] = std::clamp(mean[c] + axis[c] * minProj / axisLengthSq, 0.0f, 255.0f);
+                    outMax[c] = std::clamp(mean[c] + axis[c] * maxProj / axisLengthSq, 0.0f, 255.0f);
+                }
+                else
+                {
+                    outMin[c] = outMax[c] = 255.0f;
+                }
+            }
+        }
+
+        /**
+         * @brief Encode the 8-byte color part shared by BC1 and BC3
+         * @param forceFourColor BC3 always decodes the color block in 4-color mode
+         */
+        void EncodeColorBlock(const byte pixels[64], byte out[8], bool forceFourColor)
+        {
+            bool hasTransparent = false;
+            if (!forceFourColor)
+            {
+                for (uint32 i = 0; i < 16; ++i)
+                {
+                    hasTransparent |= pixels[i * 4 + 3] < 128;
+                }
+            }
+
+            float32 lo[4], hi[4];
+            FindPrincipalEndpoints(pixels, 3, hasTransparent, lo, hi);
+
+            uint16 c0 = PackRGB565(static_cast<int32>(hi[0] + 0.5f), static_cast<int32>(hi[1] + 0.5f),
+                                   static_cast<int32>(hi[2] + 0.5f));
+            uint16 c1 = PackRGB565(static_cast<int32>(lo[0] + 0.5f), static_cast<int32>(lo[1] + 0.5f),
+                                   static_cast<int32>(lo[2] + 0.5f));
+
+            // Endpoint order selects the decoding mode:
+            //   c0 >  c1: 4 colors
+            //   c0 <= c1: 3 colors + transparent black (BC1 only)
+            bool threeColorMode = hasTransparent;
+            if (threeColorMode ? (c0 > c1) : (c0 < c1))
+            {
+                std::swap(c0, c1);
+            }
+
+            int32 e0[3], e1[3];
+            UnpackRGB565(c0, e0);
+            UnpackRGB565(c1, e1);
+
+            int32 palette[4][3];
+            for (uint32 c = 0; c < 3; ++c)
+            {
+                palette[0][c] = e0[c];
+                palette[1][c] = e1[c];
+                if (threeColorMode)
+                {
+                    palette[2][c] = (e0[c] + e1[c]) / 2;
+                    palette[3][c] = 0;
+                }
+                else
+                {
+                    palette[2][c] = (2 * e0[c] + e1[c]) / 3;
+                    palette[3][c] = (e0[c] + 2 * e1[c]) / 3;
+                }
+            }
+
+            uint32 indices = 0;
+            if (c0 != c1 || threeColorMode)
+            {
+                uint32 candidates = threeColorMode ? 3 : 4;
+                for (uint32 i = 0; i < 16; ++i)
+                {
+                    const byte* px = &pixels[i * 4];
+                    uint32 best = 0;
+
+                    if (threeColorMode && px[3] < 128)
+                    {
+                        best = 3;
+                    }
+                    else
+                    {
+                        int32 bestDist = ColorDistance(palette[0], px, 3);
+                        for (uint32 p = 1; p < candidates; ++p)
+                        {
+                            int32 dist = ColorDistance(palette[p], px, 3);
+                            if (dist < bestDist)
+                            {
+                                bestDist = dist;
+                                best = p;
+                            }
+                        }
+                    }
+
+                    indices |= best << (i * 2);
+                }
+            }
+
+            out[0] = static_cast<byte>(c0 & 0xFF);
+            out[1] = static_cast<byte>(c0 >> 8);
+            out[2] = static_cast<byte>(c1 & 0xFF);
+            out[3] = static_cast<byte>(c1 >> 8);
+            std::memcpy(&out[4], &indices, sizeof(uint32));
+        }
+
+        void EncodeAlphaBlock(const byte pixels[64], byte out[8])
+        {
+            byte a0 = 0;
+            byte a1 = 255;
+            for (uint32 i = 0; i < 16; ++i)
+            {
+                a0 = std::max(a0, pixels[i * 4 + 3]);
+                a1 = std::min(a1, pixels[i * 4 + 3]);
+            }
+
+            out[0] = a0;
+            out[1] = a1;
+
+            uint64 indices = 0;
+            if (a0 != a1)
+            {
+                // a0 > a1: 8-value palette (a0, a1, 6 interpolated values)
+                int32 palette[8];
+                palette[0] = a0;
+                palette[1] = a1;
+                for (int32 i = 1; i <= 6; ++i)
+                {
+                    palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+                }
+
+                for (uint32 i = 0; i < 16; ++i)
+                {
+                    int32 alpha = pixels[i * 4 + 3];
+                    uint64 best = 0;
+                    int32 bestDist = std::abs(palette[0] - alpha);
+                    for (uint32 p = 1; p < 8; ++p)
+                    {
+                        int32 dist = std::abs(palette[p] - alpha);
+                        if (dist < bestDist)
+                        {
+                            bestDist = dist;
+                            best = p;
+                        }
+                    }
+                    indices |= best << (i * 3);
+                }
+            }
+
+            for (uint32 i = 0; i < 6; ++i)
+            {
+                out[2 + i] = static_cast<byte>((indices >> (i * 8)) & 0xFF);
+            }
+        }
+
+        // =====================================================================
+        // BC7 Helpers
+        // =====================================================================
+
+        constexpr int32 BC7_WEIGHTS_4BIT[16] = {
+            0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64
+        };
+
+        class BitWriter
+        {
+        public:
+            explicit BitWriter(byte* out)
+                : m_Out(out)
+            {
+                std::memset(m_Out, 0, 16);
+            }
+
+            void Write(uint32 value, uint32 bitCount)
+            {
+                for (uint32 i = 0; i < bitCount; ++i)
+                {
+                    if (value & (1u << i))
+                    {
+                        m_Out[m_Position / 8] |= static_cast<byte>(1u << (m_Position % 8));
+                    }
+                    ++m_Position;
+                }
+            }
+
+        private:
+            byte* m_Out;
+            uint32 m_Position = 0;
+        };
+
+        /**
+         * @brief Quantize an 8-bit endpoint to 7 bits + shared p-bit
+         * @return The p-bit that minimizes the reconstruction error
+         */
+        uint32 QuantizeEndpointWithPBit(const float32 value[4], uint32 quantized[4])
+        {
+            uint32 bestP = 0;
+            float32 bestError = 1e30f;
+            uint32 candidate[4];
+
+            for (uint32 p = 0; p < 2; ++p)
+            {
+                float32 error = 0.0f;
+                for (uint32 c = 0; c < 4; ++c)
+                {
+                    int32 q = static_cast<int32>((value[c] - static_cast<float32>(p)) / 2.0f + 0.5f);
+                    q = std::clamp(q, 0, 127);
+                    candidate[c] = static_cast<uint32>(q);
+                    float32 d = static_cast<float32>((q << 1) | static_cast<int32>(p)) - value[c];
+                    error += d * d;
+                }
+                if (error < bestError)
+                {
+                    bestError = error;
+                    bestP = p;
+                    std::memcpy(quantized, candidate, sizeof(candidate));
+                }
+            }
+
+            return bestP;
+        }
+    }
+
+    // =========================================================================
+    // Block Encoders
+    // =========================================================================
+
+    void EncodeBC1Block(const byte pixels[64], byte out[8])
+    {
+        EncodeColorBlock(pixels, out, false);
+    }
+
+    void EncodeBC3Block(const byte pixels[64], byte out[16])
+    {
+        EncodeAlphaBlock(pixels, out);
+        EncodeColorBlock(pixels, out + 8, true);
+    }
+
+    void EncodeBC7Block(const byte pixels[64], byte out[16])
+    {
+        float32 lo[4], hi[4];
+        FindPrincipalEndpoints(pixels, 4, false, lo, hi);
+
+        uint32 q0[4], q1[4];
+        uint32 p0 = QuantizeEndpointWithPBit(lo, q0);
+        uint32 p1 = QuantizeEndpointWithPBit(hi, q1);
+
+        int32 e0[4], e1[4];
+        for (uint32 c = 0; c < 4; ++c)
+        {
+            e0[c] = static_cast<int32>((q0[c] << 1) | p0);
+            e1[c] = static_cast<int32>((q1[c] << 1) | p1);
+        }
+
+        int32 palette[16][4];
+        for (uint32 i = 0; i < 16; ++i)
+        {
+            for (uint32 c = 0; c < 4; ++c)
+            {
+                palette[i][c] = ((64 - BC7_WEIGHTS_4BIT[i]) * e0[c] + BC7_WEIGHTS_4BIT[i] * e1[c] + 32) >> 6;
+            }
+        }
+
+        uint32 indices[16];
+        for (uint32 i = 0; i < 16; ++i)
+        {
+            const byte* px = &pixels[i * 4];
+            uint32 best = 0;
+            int32 bestDist = ColorDistance(palette[0], px, 4);
+            for (uint32 p = 1; p < 16; ++p)
+            {
+                int32 dist = ColorDistance(palette[p], px, 4);
+                if (dist < bestDist)
+                {
+                    bestDist = dist;
+                    best = p;
+                }
+            }
+            indices[i] = best;
+        }
+
+        // The anchor (pixel 0) index is stored with an implicit leading zero bit.
+        // If its MSB is set, swap the endpoints and invert every index.
+        if (indices[0] & 0x8)
+        {
+            std::swap(q0, q1);
+            std::swap(p0, p1);
+            for (uint32& index : indices)
+            {
+                index = 15 - index;
+            }
+        }
+
+        BitWriter writer(out);
+        writer.Write(1u << 6, 7);               // Mode 6
+        for (uint32 c = 0; c < 4; ++c)          // R0 R1 G0 G1 B0 B1 A0 A1
+        {
+            writer.Write(q0[c], 7);
+            writer.Write(q1[c], 7);
+        }
+        writer.Write(p0, 1);
+        writer.Write(p1, 1);
+        writer.Write(indices[0], 3);
+        for (uint32 i = 1; i < 16; ++i)
+        {
+            writer.Write(indices[i], 4);
+        }
+    }
+
+    // =========================================================================
+    // Image Encoding
+    // =========================================================================
+
+    std::vector<byte> CompressImage(const Image& image, CookedTextureFormat format)
+    {
+        if (format == CookedTextureFormat::RGBA8)
+        {
+            return image.Pixels;
+        }
+
+        uint32 blocksX = (image.Width + 3) / 4;
+        uint32 blocksY = (image.Height + 3) / 4;
+        uint32 blockSize = CookedTextureUnitSize(format);
+
+        std::vector<byte> output(static_cast<usize>(blocksX) * blocksY * blockSize);
+        byte blockPixels[64];
+
+        for (uint32 by = 0; by < blocksY; ++by)
+        {
+            for (uint32 bx = 0; bx < blocksX; ++bx)
+            {
+                // Gather the 4x4 footprint, clamping at the image edge
+                for (uint32 py = 0; py < 4; ++py)
+                {
+                    uint32 sy = std::min(by * 4 + py, image.Height - 1);
+                    for (uint32 px = 0; px < 4; ++px)
+                    {
+                        uint32 sx = std::min(bx * 4 + px, image.Width - 1);
+                        std::memcpy(&blockPixels[(py * 4 + px) * 4],
+                                    &image.Pixels[(static_cast<usize>(sy) * image.Width + sx) * 4], 4);
+                    }
+                }
+
+                byte* dst = &output[(static_cast<usize>(by) * blocksX + bx) * blockSize];
+                switch (format)
+                {
+                    case CookedTextureFormat::BC1:  EncodeBC1Block(blockPixels, dst); break;
+                    case CookedTextureFormat::BC3:  EncodeBC3Block(blockPixels, dst); break;
+                    case CookedTextureFormat::BC7:  EncodeBC7Block(blockPixels, dst); break;
+                    case CookedTextureFormat::RGBA8: break;
+                }
+            }
+        }
+
+        return output;
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Core/Types.h"
+#include "Renderer/CookedTexture.h"
+#include "MipChain.h"
+
+#include <vector>
+
+namespace NanSu::Cooker
+{
+    /**
+     * @brief Encode one 4x4 RGBA block as BC1 (8 bytes)
+     * @param pixels 16 RGBA pixels, row-major
+     * @param out Destination for the encoded block
+     *
+     * Blocks containing alpha < 128 use the 3-color punch-through mode.
+     */
+    void EncodeBC1Block(const byte pixels[64], byte out[8]);
+
+    /**
+     * @brief Encode one 4x4 RGBA block as BC3 (16 bytes)
+     * @param pixels 16 RGBA pixels, row-major
+     * @param out Destination for the encoded block
+     */
+    void EncodeBC3Block(const byte pixels[64], byte out[16]);
+
+    /**
+     * @brief Encode one 4x4 RGBA block as BC7 (16 bytes)
+     * @param pixels 16 RGBA pixels, row-major
+     * @param out Destination for the encoded block
+     *
+     * Uses BC7 mode 6 only (single subset, RGBA 7.7.7.7 endpoints with
+     * per-endpoint p-bits, 4-bit indices). This trades some quality on
+     * multi-colored blocks for a simple, fast single-pass encoder.
+     */
+    void EncodeBC7Block(const byte pixels[64], byte out[16]);
+
+    /**
+     * @brief Encode a full image into the given cooked format
+     * @param image Source RGBA8 image
+     * @param format Target format (RGBA8 copies the pixels unchanged)
+     * @return Encoded payload, CookedTextureMipSize() bytes long
+     */
+    std::vector<byte> CompressImage(const Image& image, CookedTextureFormat format);
+}
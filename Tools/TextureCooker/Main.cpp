@@ -0,0 +1,309 @@
+// =============================================================================
+// NanSu TextureCooker
+// =============================================================================
+//
+// Converts source images (PNG, ...) into the engine's cooked texture format
+// (.nstx): a precomputed, gamma-correct mip chain stored as BC1/BC3/BC7
+// blocks or raw RGBA8, ready to be uploaded without any decoding.
+//
+// Usage:
+//   TextureCooker <input file|directory> <output directory>
+//                 [--format auto|rgba8|bc1|bc3|bc7] [--no-mips]
+//
+// Example:
+//   TextureCooker ../../Assets/Textures ../../Assets/Textures
+// =============================================================================
+
+#include "Core/Types.h"
+#include "Renderer/CookedTexture.h"
+#include "MipChain.h"
+#include "BlockCompressor.h"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+using namespace NanSu;
+using namespace NanSu::Cooker;
+
+namespace
+{
+    enum class FormatOption
+    {
+        Auto,
+        Fixed
+    };
+
+    struct CookOptions
+    {
+        FormatOption FormatMode = FormatOption::Auto;
+        CookedTextureFormat Format = CookedTextureFormat::BC3;
+        bool GenerateMips = true;
+    };
+
+    void PrintUsage()
+    {
+        std::printf("Usage: TextureCooker <input file|directory> <output directory>\n");
+        std::printf("                     [--format auto|rgba8|bc1|bc3|bc7] [--no-mips]\n");
+        std::printf("\n");
+        std::printf("  auto   BC1 for opaque images, BC3 for images with alpha (default)\n");
+    }
+
+    const char* FormatToString(CookedTextureFormat format)
+    {
+        switch (format)
+        {
+            case CookedTextureFormat::RGBA8:    return "RGBA8";
+            case CookedTextureFormat::BC1:      return "BC1";
+            case CookedTextureFormat::BC3:      return "BC3";
+            case CookedTextureFormat::BC7:      return "BC7";
+        }
+        return "Unknown";
+    }
+
+    bool ParseFormat(const char* text, CookOptions& options)
+    {
+        struct FormatName
+        {
+            const char* Name;
+            CookedTextureFormat Format;
+        };
+
+        static const FormatName s_Formats[] = {
+            { "rgba8", CookedTextureFormat::RGBA8 },
+            { "bc1", CookedTextureFormat::BC1 },
+            { "bc3", CookedTextureFormat::BC3 },
+            { "bc7", CookedTextureFormat::BC7 }
+        };
+
+        if (std::strcmp(text, "auto") == 0)
+        {
+            options.FormatMode = FormatOption::Auto;
+            return true;
+        }
+
+        for (const auto& entry : s_Formats)
+        {
+            if (std::strcmp(text, entry.Name) == 0)
+            {
+                options.FormatMode = FormatOption::Fixed;
+                options.Format = entry.Format;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool HasAlpha(const Image& image)
+    {
+        for (usize i = 3; i < image.Pixels.size(); i += 4)
+        {
+            if (image.Pixels[i] != 255)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool IsSourceImage(const fs::path& path)
+    {
+        std::string ext = path.extension().string();
+        for (char& c : ext)
+        {
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+        return ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".tga" || ext == ".bmp";
+    }
+
+    uint64 AlignUp(uint64 value, uint64 alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    // =========================================================================
+    // Cooking
+    // =========================================================================
+
+    bool CookTexture(const fs::path& input, const fs::path& outputDir, const CookOptions& options)
+    {
+        int width, height, channels;
+        stbi_uc* data = stbi_load(input.string().c_str(), &width, &height, &channels, STBI_rgb_alpha);
+        if (!data)
+        {
+            std::printf("[ERROR] Failed to load %s: %s\n", input.string().c_str(), stbi_failure_reason());
+            return false;
+        }
+
+        Image base;
+        base.Width = static_cast<uint32>(width);
+        base.Height = static_cast<uint32>(height);
+        base.Pixels.assign(data, data + static_cast<usize>(width) * height * 4);
+        stbi_image_free(data);
+
+        CookedTextureFormat format = options.Format;
+        if (options.FormatMode == FormatOption::Auto)
+        {
+            format = HasAlpha(base) ? CookedTextureFormat::BC3 : CookedTextureFormat::BC1;
+        }
+
+        // The runtime rejects BC textures that are not made of whole 4x4 blocks
+        if (IsBlockCompressed(format) && (base.Width % 4 != 0 || base.Height % 4 != 0))
+        {
+            std::printf("[WARN] %s is %ux%u, not a multiple of 4; storing as RGBA8 instead of %s\n",
+                        input.filename().string().c_str(), base.Width, base.Height, FormatToString(format));
+            format = CookedTextureFormat::RGBA8;
+        }
+
+        std::vector<Image> mips;
+        if (options.GenerateMips)
+        {
+            mips = GenerateMipChain(base);
+        }
+        else
+        {
+            mips.push_back(std::move(base));
+        }
+
+        // Build header, mip table and payloads in memory, then write once
+        CookedTextureHeader header;
+        header.Format = format;
+        header.Width = mips[0].Width;
+        header.Height = mips[0].Height;
+        header.MipCount = static_cast<uint32>(mips.size());
+
+        std::vector<CookedMipEntry> entries(mips.size());
+        std::vector<std::vector<byte>> payloads(mips.size());
+
+        uint64 offset = sizeof(CookedTextureHeader) + sizeof(CookedMipEntry) * entries.size();
+        for (usize i = 0; i < mips.size(); ++i)
+        {
+            payloads[i] = CompressImage(mips[i], format);
+
+            offset = AlignUp(offset, COOKED_TEXTURE_PAYLOAD_ALIGNMENT);
+            entries[i].Width = mips[i].Width;
+            entries[i].Height = mips[i].Height;
+            entries[i].RowPitch = CookedTextureRowPitch(format, mips[i].Width);
+            entries[i].Offset = offset;
+            entries[i].Size = payloads[i].size();
+            offset += payloads[i].size();
+        }
+
+        std::vector<byte> file(offset, 0);
+        std::memcpy(file.data(), &header, sizeof(header));
+        std::memcpy(file.data() + sizeof(header), entries.data(), sizeof(CookedMipEntry) * entries.size());
+        for (usize i = 0; i < payloads.size(); ++i)
+        {
+            std::memcpy(file.data() + entries[i].Offset, payloads[i].data(), payloads[i].size());
+        }
+
+        fs::path outputPath = outputDir / input.filename();
+        outputPath.replace_extension(COOKED_TEXTURE_EXTENSION);
+
+        std::ofstream stream(outputPath, std::ios::binary);
+        if (!stream)
+        {
+            std::printf("[ERROR] Failed to open %s for writing\n", outputPath.string().c_str());
+            return false;
+        }
+        stream.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+
+        uint64 sourceSize = static_cast<uint64>(header.Width) * header.Height * 4;
+        std::printf("[OK] %s -> %s (%ux%u, %s, %u mips, %llu KB, %.1fx smaller than RGBA8 mip 0)\n",
+                    input.filename().string().c_str(), outputPath.filename().string().c_str(),
+                    header.Width, header.Height, FormatToString(format), header.MipCount,
+                    static_cast<unsigned long long>(file.size() / 1024),
+                    static_cast<double>(sourceSize) / static_cast<double>(payloads[0].size()));
+        return true;
+    }
+}
+
+// =============================================================================
+// Entry Point
+// =============================================================================
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    fs::path input = argv[1];
+    fs::path outputDir = argv[2];
+
+    CookOptions options;
+    for (int i = 3; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+        {
+            if (!ParseFormat(argv[++i], options))
+            {
+                std::printf("[ERROR] Unknown format: %s\n", argv[i]);
+                PrintUsage();
+                return 1;
+            }
+        }
+        else if (std::strcmp(argv[i], "--no-mips") == 0)
+        {
+            options.GenerateMips = false;
+        }
+        else
+        {
+            std::printf("[ERROR] Unknown argument: %s\n", argv[i]);
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    // Match the orientation DX11Texture2D uses for runtime-loaded images
+    stbi_set_flip_vertically_on_load(true);
+
+    std::error_code ec;
+    fs::create_directories(outputDir, ec);
+
+    std::vector<fs::path> sources;
+    if (fs::is_directory(input))
+    {
+        for (const auto& entry : fs::directory_iterator(input))
+        {
+            if (entry.is_regular_file() && IsSourceImage(entry.path()))
+            {
+                sources.push_back(entry.path());
+            }
+        }
+    }
+    else
+    {
+        sources.push_back(input);
+    }
+
+    if (sources.empty())
+    {
+        std::printf("[ERROR] No source images found in %s\n", input.string().c_str());
+        return 1;
+    }
+
+    uint32 failed = 0;
+    for (const auto& source : sources)
+    {
+        if (!CookTexture(source, outputDir, options))
+        {
+            ++failed;
+        }
+    }
+
+    std::printf("Cooked %zu texture(s), %u failed\n", sources.size() - failed, failed);
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,215 @@
+#include "MipChain.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#if defined(_M_X64) || defined(__SSE2__)
+    #include <emmintrin.h>
+    #define NS_COOKER_SSE2 1
+#else
+    #define NS_COOKER_SSE2 0
+#endif
+
+namespace NanSu::Cooker
+{
+    namespace
+    {
+        // Resolution of the linear -> sRGB lookup table
+        constexpr uint32 LINEAR_TO_SRGB_TABLE_SIZE = 4096;
+
+        struct ColorSpaceTables
+        {
+            // sRGB byte -> linear [0, 1]
+            std::array<float32, 256> SrgbToLinear;
+            // alpha byte -> [0, 1]
+            std::array<float32, 256> UnormToFloat;
+            // linear [0, 1] quantized -> sRGB byte
+            std::array<byte, LINEAR_TO_SRGB_TABLE_SIZE + 1> LinearToSrgb;
+
+            ColorSpaceTables()
+            {
+                for (uint32 i = 0; i < 256; ++i)
+                {
+                    float32 c = static_cast<float32>(i) / 255.0f;
+                    SrgbToLinear[i] = (c <= 0.04045f)
+                        ? c / 12.92f
+                        : std::pow((c + 0.055f) / 1.055f, 2.4f);
+                    UnormToFloat[i] = c;
+                }
+
+                for (uint32 i = 0; i <= LINEAR_TO_SRGB_TABLE_SIZE; ++i)
+                {
+                    float32 l = static_cast<float32>(i) / static_cast<float32>(LINEAR_TO_SRGB_TABLE_SIZE);
+                    float32 s = (l <= 0.0031308f)
+                        ? l * 12.92f
+                        : 1.055f * std::pow(l, 1.0f / 2.4f) - 0.055f;
+                    LinearToSrgb[i] = static_cast<byte>(std::clamp(s * 255.0f + 0.5f, 0.0f, 255.0f));
+                }
+            }
+        };
+
+        const ColorSpaceTables& GetTables()
+        {
+            static const ColorSpaceTables s_Tables;
+            return s_Tables;
+        }
+
+        byte EncodeLinear(float32 linear)
+        {
+            const auto& tables = GetTables();
+            float32 scaled = std::clamp(linear, 0.0f, 1.0f) * static_cast<float32>(LINEAR_TO_SRGB_TABLE_SIZE);
+            return tables.LinearToSrgb[static_cast<uint32>(scaled + 0.5f)];
+        }
+
+        byte EncodeUnorm(float32 value)
+        {
+            return static_cast<byte>(std::clamp(value * 255.0f + 0.5f, 0.0f, 255.0f));
+        }
+
+        /**
+         * @brief Source texels and weights contributing to one destination texel along one axis
+         */
+        struct FilterTaps
+        {
+            uint32 Count = 0;
+            uint32 Index[3] = {};
+            float32 Weight[3] = {};
+        };
+
+        /**
+         * @brief Box filter taps for halving an axis of the given size
+         *
+         * Even sizes average pairs. Odd sizes (2n+1 -> n) let every
+         * destination texel cover (2n+1)/n source texels, so the middle texel
+         * and the partially covered neighbours are weighted in instead of the
+         * last row/column being dropped.
+         */
+        std::vector<FilterTaps> BuildFilterTaps(uint32 srcSize, uint32 dstSize)
+        {
+            std::vector<FilterTaps> taps(dstSize);
+            for (uint32 i = 0; i < dstSize; ++i)
+            {
+                FilterTaps& tap = taps[i];
+                if (srcSize == 1)
+                {
+                    tap.Count = 1;
+                    tap.Weight[0] = 1.0f;
+                }
+                else if (srcSize % 2 == 0)
+                {
+                    tap.Count = 2;
+                    tap.Index[0] = i * 2;
+                    tap.Index[1] = i * 2 + 1;
+                    tap.Weight[0] = tap.Weight[1] = 0.5f;
+                }
+                else
+                {
+                    float32 inv = 1.0f / static_cast<float32>(srcSize);
+                    tap.Count = 3;
+                    tap.Index[0] = i * 2;
+                    tap.Index[1] = i * 2 + 1;
+                    tap.Index[2] = i * 2 + 2;
+                    tap.Weight[0] = static_cast<float32>(dstSize - i) * inv;
+                    tap.Weight[1] = static_cast<float32>(dstSize) * inv;
+                    tap.Weight[2] = static_cast<float32>(i + 1) * inv;
+                }
+            }
+            return taps;
+        }
+
+        Image Downsample(const Image& src)
+        {
+            const auto& tables = GetTables();
+
+            Image dst;
+            dst.Width = std::max(src.Width / 2, 1u);
+            dst.Height = std::max(src.Height / 2, 1u);
+            dst.Pixels.resize(static_cast<usize>(dst.Width) * dst.Height * 4);
+
+            const std::vector<FilterTaps> columns = BuildFilterTaps(src.Width, dst.Width);
+            const std::vector<FilterTaps> rows = BuildFilterTaps(src.Height, dst.Height);
+
+            for (uint32 y = 0; y < dst.Height; ++y)
+            {
+                const FilterTaps& row = rows[y];
+
+                for (uint32 x = 0; x < dst.Width; ++x)
+                {
+                    const FilterTaps& column = columns[x];
+
+                    alignas(16) float32 avg[4];
+#if NS_COOKER_SSE2
+                    __m128 sum = _mm_setzero_ps();
+                    for (uint32 ty = 0; ty < row.Count; ++ty)
+                    {
+                        const byte* line = &src.Pixels[static_cast<usize>(row.Index[ty]) * src.Width * 4];
+                        for (uint32 tx = 0; tx < column.Count; ++tx)
+                        {
+                            const byte* px = line + static_cast<usize>(column.Index[tx]) * 4;
+                            // _mm_set_ps takes lanes high to low: A, B, G, R
+                            __m128 texel = _mm_set_ps(
+                                tables.UnormToFloat[px[3]],
+                                tables.SrgbToLinear[px[2]],
+                                tables.SrgbToLinear[px[1]],
+                                tables.SrgbToLinear[px[0]]);
+                            sum = _mm_add_ps(sum, _mm_mul_ps(texel, _mm_set1_ps(row.Weight[ty] * column.Weight[tx])));
+                        }
+                    }
+                    _mm_store_ps(avg, sum);
+#else
+                    avg[0] = avg[1] = avg[2] = avg[3] = 0.0f;
+                    for (uint32 ty = 0; ty < row.Count; ++ty)
+                    {
+                        const byte* line = &src.Pixels[static_cast<usize>(row.Index[ty]) * src.Width * 4];
+                        for (uint32 tx = 0; tx < column.Count; ++tx)
+                        {
+                            const byte* px = line + static_cast<usize>(column.Index[tx]) * 4;
+                            float32 weight = row.Weight[ty] * column.Weight[tx];
+                            avg[0] += tables.SrgbToLinear[px[0]] * weight;
+                            avg[1] += tables.SrgbToLinear[px[1]] * weight;
+                            avg[2] += tables.SrgbToLinear[px[2]] * weight;
+                            avg[3] += tables.UnormToFloat[px[3]] * weight;
+                        }
+                    }
+#endif
+
+                    byte* out = &dst.Pixels[(static_cast<usize>(y) * dst.Width + x) * 4];
+                    out[0] = EncodeLinear(avg[0]);
+                    out[1] = EncodeLinear(avg[1]);
+                    out[2] = EncodeLinear(avg[2]);
+                    out[3] = EncodeUnorm(avg[3]);
+                }
+            }
+
+            return dst;
+        }
+    }
+
+    uint32 CalculateMipCount(uint32 width, uint32 height)
+    {
+        uint32 count = 1;
+        uint32 size = std::max(width, height);
+        while (size > 1)
+        {
+            size /= 2;
+            ++count;
+        }
+        return count;
+    }
+
+    std::vector<Image> GenerateMipChain(const Image& base)
+    {
+        std::vector<Image> chain;
+        chain.reserve(CalculateMipCount(base.Width, base.Height));
+        chain.push_back(base);
+
+        while (chain.back().Width > 1 || chain.back().Height > 1)
+        {
+            chain.push_back(Downsample(chain.back()));
+        }
+
+        return chain;
+    }
+}
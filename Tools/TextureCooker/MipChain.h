@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Core/Types.h"
+
+#include <vector>
+
+namespace NanSu::Cooker
+{
+    /**
+     * @brief Uncompressed RGBA8 image (4 bytes per pixel, rows packed)
+     */
+    struct Image
+    {
+        uint32 Width = 0;
+        uint32 Height = 0;
+        std::vector<byte> Pixels;
+    };
+
+    /**
+     * @brief Build a full mip chain down to 1x1
+     * @param base The full-resolution image (mip 0)
+     * @return All mip levels, starting with a copy of the base image
+     *
+     * Color channels are treated as sRGB: each box footprint (2x2, or up to
+     * 3x3 weighted texels on odd dimensions) is converted to linear space,
+     * averaged and re-encoded, so downsampled mips keep the perceived
+     * brightness of the source. Alpha is averaged linearly.
+     * The inner loop processes one RGBA pixel per SSE register.
+     */
+    std::vector<Image> GenerateMipChain(const Image& base);
+
+    /**
+     * @brief Compute the number of mip levels for the given dimensions
+     */
+    uint32 CalculateMipCount(uint32 width, uint32 height);
+}
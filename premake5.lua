@@ -73,12 +73,19 @@ project "Engine"
         flags { "NoPCH" }
     filter {}
 
+    -- ImGui 백엔드는 Win32/DX11 전용 (다른 플랫폼은 헤드리스로 실행)
+    filter "system:not windows"
+        removefiles { "ThirdParty/imgui/backends/**.cpp" }
+    filter {}
+
     -- stb 구현 파일은 PCH 제외
-    filter "files:Source/Engine/Renderer/stb_image.cpp"
+    filter "files:Source/Engine/Renderer/stb_image.cpp or Source/Engine/Renderer/stb_truetype.cpp"
         flags { "NoPCH" }
     filter {}
 
-    buildoptions { "/utf-8" }
+    filter "toolset:msc*"
+        buildoptions { "/utf-8" }
+    filter {}
 
     -- Note: DirectX 11 libraries are linked via #pragma comment(lib, ...) in DX11Context.cpp
 
@@ -110,7 +117,9 @@ project "Editor"
 
     links { "Engine" }
 
-    buildoptions { "/utf-8" }
+    filter "toolset:msc*"
+        buildoptions { "/utf-8" }
+    filter {}
 
 --------------------------------------------------------------------------------
 -- 3. Game (샌드박스)
@@ -140,4 +149,97 @@ project "Game"
 
     links { "Engine" }
 
-    buildoptions { "/utf-8" }
\ No newline at end of file
+    filter "toolset:msc*"
+        buildoptions { "/utf-8" }
+    filter {}
+
+--------------------------------------------------------------------------------
+-- 4. TextureCooker (오프라인 텍스처 쿠킹 도구)
+--------------------------------------------------------------------------------
+project "TextureCooker"
+    location "Tools/TextureCooker"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++20"
+    staticruntime "On"
+
+    targetdir ("Binaries/" .. outputdir .. "/%{prj.name}")
+    objdir ("Build/" .. outputdir .. "/%{prj.name}")
+
+    files {
+        "Tools/TextureCooker/**.h",
+        "Tools/TextureCooker/**.cpp"
+    }
+
+    includedirs {
+        "Source",
+        "Source/Engine",
+        "ThirdParty/stb"
+    }
+
+    filter "toolset:msc*"
+        buildoptions { "/utf-8" }
+    filter {}
+
+
+--------------------------------------------------------------------------------
+-- 5. AssetPacker (에셋 팩 빌드 도구)
+--------------------------------------------------------------------------------
+project "AssetPacker"
+    location "Tools/AssetPacker"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++20"
+    staticruntime "On"
+
+    targetdir ("Binaries/" .. outputdir .. "/%{prj.name}")
+    objdir ("Build/" .. outputdir .. "/%{prj.name}")
+
+    files {
+        "Tools/AssetPacker/**.h",
+        "Tools/AssetPacker/**.cpp"
+    }
+
+    includedirs {
+        "Source",
+        "Source/Engine"
+    }
+
+    -- Reuses the engine's pack format and block compressor
+    links { "Engine" }
+
+    filter "toolset:msc*"
+        buildoptions { "/utf-8" }
+    filter {}
+
+--------------------------------------------------------------------------------
+-- 6. Tests (엔진 단위 테스트, 실패 시 0이 아닌 종료 코드)
+--------------------------------------------------------------------------------
+project "Tests"
+    location "Tests"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++20"
+    staticruntime "On"
+
+    targetdir ("Binaries/" .. outputdir .. "/%{prj.name}")
+    objdir ("Build/" .. outputdir .. "/%{prj.name}")
+
+    files {
+        "Tests/**.h",
+        "Tests/**.cpp"
+    }
+
+    includedirs {
+        "Source",
+        "Source/Engine",
+        "ThirdParty/spdlog/include",
+        "ThirdParty/imgui",
+        "ThirdParty/glm"
+    }
+
+    links { "Engine" }
+
+    filter "toolset:msc*"
+        buildoptions { "/utf-8" }
+    filter {}